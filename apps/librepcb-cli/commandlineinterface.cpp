@@ -29,8 +29,10 @@
 #include <librepcb/common/debug.h>
 #include <librepcb/common/fileio/csvfile.h>
 #include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/sexpression.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/library/elements.h>
+#include <librepcb/library/msg/libraryelementcheckmessage.h>
 #include <librepcb/project/boards/board.h>
 #include <librepcb/project/boards/boardfabricationoutputsettings.h>
 #include <librepcb/project/boards/boardgerberexport.h>
@@ -39,6 +41,7 @@
 #include <librepcb/project/erc/ercmsglist.h>
 #include <librepcb/project/project.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 #include <algorithm>
@@ -52,6 +55,13 @@ namespace cli {
 using namespace librepcb::library;
 using namespace librepcb::project;
 
+/*******************************************************************************
+ *  Static Variables
+ ******************************************************************************/
+
+QThreadStorage<CommandLineInterface::OutputBuffer*>
+    CommandLineInterface::sOutputBuffer;
+
 /*******************************************************************************
  *  Constructors / Destructor
  ******************************************************************************/
@@ -72,6 +82,9 @@ int CommandLineInterface::execute() noexcept {
       {"open-library",
        {tr("Open a library to execute library-related tasks."),
         tr("open-library [command_options]")}},
+      {"batch",
+       {tr("Process several projects in parallel, as listed in a manifest."),
+        tr("batch [command_options]")}},
   };
 
   // Add global options
@@ -141,12 +154,29 @@ int CommandLineInterface::execute() noexcept {
   QCommandLineOption libAllOption(
       "all", tr("Perform the selected action(s) on all elements contained in "
                 "the opened library."));
+  QCommandLineOption libCheckOption(
+      "check", tr("Run the library element checks, print all messages and "
+                  "report failure (exit code = 1) if there are warnings or "
+                  "errors."));
   QCommandLineOption libSaveOption(
       "save", tr("Save library (and contained elements if '--all' is given) "
                  "before closing them (useful to upgrade file format)."));
   QCommandLineOption libStrictOption(
       "strict", tr("Fail if the opened files are not strictly canonical, i.e. "
                    "there would be changes when saving the library elements."));
+  QCommandLineOption libJobsOption(
+      "jobs",
+      tr("Number of library elements to process in parallel (only relevant "
+         "if '--all' is given). Defaults to 1."),
+      tr("count"));
+
+  // Define options for "batch"
+  QCommandLineOption batchJobsOption(
+      "jobs",
+      tr("Number of worker threads used to process the projects (e.g. to "
+         "export Gerber files in parallel). Defaults to the number of CPU "
+         "cores."),
+      tr("count"));
 
   // First parse to get the supplied command (ignoring errors because the parser
   // does not yet know the command-dependent options).
@@ -182,8 +212,18 @@ int CommandLineInterface::execute() noexcept {
     parser.addPositionalArgument("library",
                                  tr("Path to library directory (*.lplib)."));
     parser.addOption(libAllOption);
+    parser.addOption(libCheckOption);
     parser.addOption(libSaveOption);
     parser.addOption(libStrictOption);
+    parser.addOption(libJobsOption);
+  } else if (command == "batch") {
+    parser.clearPositionalArguments();
+    parser.addPositionalArgument(command, commands[command].first,
+                                 commands[command].second);
+    parser.addPositionalArgument(
+        "manifest", tr("Path to the batch manifest file (*.lp). Relative paths "
+                       "in the manifest are relative to its directory."));
+    parser.addOption(batchJobsOption);
   } else if (!command.isEmpty()) {
     printErr(QString(tr("Unknown command '%1'.")).arg(command), 2);
     print(parser.helpText(), 0);
@@ -253,10 +293,45 @@ int CommandLineInterface::execute() noexcept {
       print(parser.helpText(), 0);
       return 1;
     }
-    cmdSuccess = openLibrary(positionalArgs.value(0),       // library directory
-                             parser.isSet(libAllOption),    // all elements
-                             parser.isSet(libSaveOption),   // save
-                             parser.isSet(libStrictOption)  // strict mode
+    int jobs = 1;
+    if (parser.isSet(libJobsOption)) {
+      bool ok = false;
+      jobs    = parser.value(libJobsOption).toInt(&ok);
+      if ((!ok) || (jobs < 1)) {
+        printErr(QString(tr("Invalid job count: '%1'"))
+                     .arg(parser.value(libJobsOption)),
+                 2);
+        print(parser.helpText(), 0);
+        return 1;
+      }
+    }
+    cmdSuccess = openLibrary(positionalArgs.value(0),        // library dir
+                             parser.isSet(libAllOption),     // all elements
+                             parser.isSet(libCheckOption),   // run checks
+                             parser.isSet(libSaveOption),    // save
+                             parser.isSet(libStrictOption),  // strict mode
+                             jobs                            // parallel jobs
+    );
+  } else if (command == "batch") {
+    if (positionalArgs.count() != 1) {
+      printErr(tr("Wrong argument count."), 2);
+      print(parser.helpText(), 0);
+      return 1;
+    }
+    int jobs = QThread::idealThreadCount();
+    if (parser.isSet(batchJobsOption)) {
+      bool ok = false;
+      jobs    = parser.value(batchJobsOption).toInt(&ok);
+      if ((!ok) || (jobs < 1)) {
+        printErr(QString(tr("Invalid job count: '%1'"))
+                     .arg(parser.value(batchJobsOption)),
+                 2);
+        print(parser.helpText(), 0);
+        return 1;
+      }
+    }
+    cmdSuccess = runBatch(positionalArgs.value(0),  // manifest filepath
+                          jobs                      // parallel jobs
     );
   } else {
     printErr(tr("Internal failure."));
@@ -280,6 +355,9 @@ bool CommandLineInterface::openProject(
     const QStringList& exportBoardBomFiles, const QString& bomAttributes,
     bool exportPcbFabricationData, const QString& pcbFabricationSettingsPath,
     const QStringList& boards, bool save, bool strict) const noexcept {
+  // The project creates graphics scenes and exports them (e.g. to PDF), which
+  // is only supported in the GUI thread.
+  Q_ASSERT(QThread::currentThread() == qApp->thread());
   try {
     bool                success = true;
     QMap<FilePath, int> writtenFilesCounter;
@@ -488,14 +566,40 @@ bool CommandLineInterface::openProject(
       }
       foreach (const Board* board, boardList) {
         print("  " % QString(tr("Board '%1':")).arg(*board->getName()));
-        BoardGerberExport grbExport(
-            *board, customSettings ? *customSettings
-                                   : board->getFabricationOutputSettings());
+        const BoardFabricationOutputSettings& settings =
+            customSettings ? *customSettings
+                           : board->getFabricationOutputSettings();
+        BoardGerberExport grbExport(*board, settings);
         grbExport.exportAllLayers();  // can throw
         foreach (const FilePath& fp, grbExport.getWrittenFiles()) {
           print(QString("    => '%1'").arg(prettyPath(fp, projectFile)));
           writtenFilesCounter[fp]++;
         }
+        if (settings.getOptimizeGerberFiles()) {
+          BoardGerberExport::OptimizationReport report =
+              grbExport.getOptimizationReport();
+          print("    " %
+                QString(tr("Gerber optimization: %1 of %2 plane vertices "
+                           "removed, %3 arcs re-fitted (max. deviation %4 "
+                           "µm), %5 duplicate flashes merged"))
+                    .arg(report.regions.inputVertices -
+                         report.regions.outputVertices)
+                    .arg(report.regions.inputVertices)
+                    .arg(report.regions.fittedArcs)
+                    .arg(report.regions.maxDeviation.toMm() * 1000, 0, 'f',
+                         3)
+                    .arg(report.mergedFlashes));
+        }
+        if (settings.getOptimizeDrillPaths()) {
+          DrillPathOptimizer::Report report =
+              grbExport.getOptimizationReport().drills;
+          print("    " %
+                QString(tr("Drill path optimization: Travel distance of %1 "
+                           "drills reduced from %2 mm to %3 mm"))
+                    .arg(report.drills)
+                    .arg(report.travelBefore.toMm(), 0, 'f', 1)
+                    .arg(report.travelAfter.toMm(), 0, 'f', 1));
+        }
       }
     }
 
@@ -543,7 +647,8 @@ bool CommandLineInterface::openProject(
 }
 
 bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
-                                       bool save, bool strict) const noexcept {
+                                       bool check, bool save, bool strict,
+                                       int jobs) const noexcept {
   try {
     bool success = true;
 
@@ -555,107 +660,89 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
         TransactionalFileSystem::open(libFp, save);  // can throw
     Library lib(std::unique_ptr<TransactionalDirectory>(
         new TransactionalDirectory(libFs)));  // can throw
-    processLibraryElement(libDir, *libFs, lib, save, strict,
+    processLibraryElement(libDir, *libFs, lib, check, save, strict,
                           success);  // can throw
 
-    // Open all component categories
-    if (all) {
-      QStringList elements = lib.searchForElements<ComponentCategory>();
-      print(QString(tr("Process %1 component categories..."))
-                .arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        ComponentCategory element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
+    if (!all) {
+      return success;
     }
 
-    // Open all package categories
-    if (all) {
-      QStringList elements = lib.searchForElements<PackageCategory>();
-      print(QString(tr("Process %1 package categories..."))
-                .arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        PackageCategory element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
-    }
-
-    // Open all symbols
-    if (all) {
-      QStringList elements = lib.searchForElements<Symbol>();
-      print(QString(tr("Process %1 symbols...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Symbol element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
-    }
-
-    // Open all packages
-    if (all) {
-      QStringList elements = lib.searchForElements<Package>();
-      print(QString(tr("Process %1 packages...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Package element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
+    // Search all elements (sorted to get a stable output order)
+    QList<QPair<QString, QStringList>> elements = {
+        qMakePair(tr("Process %1 component categories..."),
+                  lib.searchForElements<ComponentCategory>()),
+        qMakePair(tr("Process %1 package categories..."),
+                  lib.searchForElements<PackageCategory>()),
+        qMakePair(tr("Process %1 symbols..."), lib.searchForElements<Symbol>()),
+        qMakePair(tr("Process %1 packages..."),
+                  lib.searchForElements<Package>()),
+        qMakePair(tr("Process %1 components..."),
+                  lib.searchForElements<Component>()),
+        qMakePair(tr("Process %1 devices..."), lib.searchForElements<Device>()),
+    };
+    int elementCount = 0;
+    for (auto& pair : elements) {
+      std::sort(pair.second.begin(), pair.second.end());
+      elementCount += pair.second.count();
     }
 
-    // Open all components
-    if (all) {
-      QStringList elements = lib.searchForElements<Component>();
-      print(QString(tr("Process %1 components...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Component element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
-      }
+    // Start all jobs. They run in a separate thread pool to not block the
+    // global thread pool.
+    QElapsedTimer timer;
+    timer.start();
+    QThreadPool pool;
+    pool.setMaxThreadCount(jobs);
+#if (QT_VERSION < QT_VERSION_CHECK(5, 4, 0))
+    // custom thread pools are not supported, so the global one is used
+    if (jobs != QThreadPool::globalInstance()->maxThreadCount()) {
+      jobs = QThreadPool::globalInstance()->maxThreadCount();
+      printErr(QString(tr("WARNING: Option '%1' is not supported with this "
+                          "Qt version, using %2 parallel job(s) instead."))
+                   .arg("--jobs")
+                   .arg(jobs));
     }
+#endif
+    QList<QList<QFuture<BatchResult>>> futures = {
+        startLibraryElementJobs<ComponentCategory>(
+            elements.at(0).second, libFp, libDir, check, save, strict, pool),
+        startLibraryElementJobs<PackageCategory>(
+            elements.at(1).second, libFp, libDir, check, save, strict, pool),
+        startLibraryElementJobs<Symbol>(elements.at(2).second, libFp, libDir,
+                                        check, save, strict, pool),
+        startLibraryElementJobs<Package>(elements.at(3).second, libFp, libDir,
+                                         check, save, strict, pool),
+        startLibraryElementJobs<Component>(elements.at(4).second, libFp,
+                                           libDir, check, save, strict, pool),
+        startLibraryElementJobs<Device>(elements.at(5).second, libFp, libDir,
+                                        check, save, strict, pool),
+    };
 
-    // Open all devices
-    if (all) {
-      QStringList elements = lib.searchForElements<Device>();
-      print(QString(tr("Process %1 devices...")).arg(elements.count()));
-      foreach (const QString& dir, elements) {
-        FilePath fp = libFp.getPathTo(dir);
-        qInfo() << QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir));
-        std::shared_ptr<TransactionalFileSystem> fs =
-            TransactionalFileSystem::open(fp, save);  // can throw
-        Device element(std::unique_ptr<TransactionalDirectory>(
-            new TransactionalDirectory(fs)));  // can throw
-        processLibraryElement(libDir, *fs, element, save, strict,
-                              success);  // can throw
+    // Print the output of the jobs in the order of the elements
+    for (int i = 0; i < futures.count(); ++i) {
+      print(elements.at(i).first.arg(futures.at(i).count()));
+      for (int k = 0; k < futures.at(i).count(); ++k) {
+        BatchResult result = futures[i][k].result();
+        foreach (const auto& line, result.output) {
+          if (line.first) {
+            printErr(line.second, 0);
+          } else {
+            print(line.second, 0);
+          }
+        }
+        if (!result.success) {
+          success = false;
+        }
       }
     }
 
+    // Print throughput
+    qint64 elapsed = timer.elapsed();
+    print(QString(tr("Processed %1 library element(s) in %2 ms with %3 "
+                     "parallel job(s) (%4 elements/s)."))
+              .arg(elementCount)
+              .arg(elapsed)
+              .arg(jobs)
+              .arg(qRound(elementCount * qreal(1000) / qMax(elapsed, 1LL))));
     return success;
   } catch (const Exception& e) {
     printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
@@ -663,11 +750,158 @@ bool CommandLineInterface::openLibrary(const QString& libDir, bool all,
   }
 }
 
+bool CommandLineInterface::runBatch(const QString& manifestFile,
+                                    int            jobs) const noexcept {
+  // Load manifest
+  FilePath manifestFp(QFileInfo(manifestFile).absoluteFilePath());
+  print(QString(tr("Open batch manifest '%1'..."))
+            .arg(prettyPath(manifestFp, manifestFile)));
+  QList<BatchJob> batchJobs;
+  try {
+    batchJobs = parseBatchManifest(manifestFp);  // can throw
+  } catch (const Exception& e) {
+    printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+    return false;
+  }
+  print(QString(tr("Process %1 project(s) with %2 worker thread(s)..."))
+            .arg(batchJobs.count())
+            .arg(jobs));
+
+  // Projects contain graphics scenes and items, which must only be used in
+  // the GUI thread. So the projects are processed one after another in this
+  // thread, and only the data processing within the jobs (e.g. loading
+  // library elements or generating Gerber files) runs on the global thread
+  // pool, which is limited to the given number of threads.
+  QThreadPool::globalInstance()->setMaxThreadCount(jobs);
+  QElapsedTimer timer;
+  timer.start();
+  int succeeded = 0;
+  for (int i = 0; i < batchJobs.count(); ++i) {
+    BatchResult result = runBatchJob(batchJobs.at(i));
+    print(QString("[%1/%2] ").arg(i + 1).arg(batchJobs.count()) %
+          QString(tr("Project '%1' finished in %2 ms:"))
+              .arg(FilePath(batchJobs.at(i).projectFile)
+                       .toRelative(manifestFp.getParentDir()))
+              .arg(result.elapsed));
+    foreach (const auto& line, result.output) {
+      if (line.first) {
+        printErr(line.second, 0);
+      } else {
+        print(line.second, 0);
+      }
+    }
+    if (result.success) {
+      ++succeeded;
+    }
+  }
+
+  // Print summary
+  int failed = batchJobs.count() - succeeded;
+  print(QString(tr("Processed %1 project(s) in %2 ms: %3 succeeded, %4 "
+                   "failed."))
+            .arg(batchJobs.count())
+            .arg(timer.elapsed())
+            .arg(succeeded)
+            .arg(failed));
+  return failed == 0;
+}
+
+CommandLineInterface::BatchResult CommandLineInterface::runBatchJob(
+    const BatchJob& job) const noexcept {
+  QElapsedTimer timer;
+  timer.start();
+  sOutputBuffer.setLocalData(new OutputBuffer());  // takes ownership
+  BatchResult result;
+  result.success = openProject(
+      job.projectFile, job.runErc, job.exportSchematicsFiles,
+      job.exportBomFiles, job.exportBoardBomFiles, job.bomAttributes,
+      job.exportPcbFabricationData, job.pcbFabricationSettingsPath,
+      job.boards, job.save, job.strict);
+  result.elapsed = timer.elapsed();
+  result.output  = *sOutputBuffer.localData();
+  sOutputBuffer.setLocalData(nullptr);  // deletes the buffer
+  return result;
+}
+
+QList<CommandLineInterface::BatchJob> CommandLineInterface::parseBatchManifest(
+    const FilePath& fp) {
+  SExpression root = SExpression::parse(FileUtils::readFile(fp), fp);
+  QDir        dir(fp.getParentDir().toStr());
+  auto        absPath = [&dir](const SExpression& node) {
+    return dir.absoluteFilePath(node.getValueOfFirstChild<QString>(true));
+  };
+  auto flag = [](const SExpression& node, const QString& name) {
+    const SExpression* child = node.tryGetChildByPath(name);
+    return child ? child->getValueOfFirstChild<bool>() : false;
+  };
+  QList<BatchJob> jobs;
+  foreach (const SExpression& node, root.getChildren("project")) {
+    BatchJob job;
+    job.projectFile = absPath(node);
+    job.runErc      = flag(node, "erc");
+    foreach (const SExpression& child, node.getChildren("export_schematics")) {
+      job.exportSchematicsFiles.append(absPath(child));
+    }
+    foreach (const SExpression& child, node.getChildren("export_bom")) {
+      job.exportBomFiles.append(absPath(child));
+    }
+    foreach (const SExpression& child, node.getChildren("export_board_bom")) {
+      job.exportBoardBomFiles.append(absPath(child));
+    }
+    if (const SExpression* child = node.tryGetChildByPath("bom_attributes")) {
+      job.bomAttributes = child->getValueOfFirstChild<QString>();
+    }
+    job.exportPcbFabricationData = flag(node, "export_pcb_fabrication_data");
+    if (const SExpression* child =
+            node.tryGetChildByPath("pcb_fabrication_settings")) {
+      job.pcbFabricationSettingsPath = absPath(*child);
+    }
+    foreach (const SExpression& child, node.getChildren("board")) {
+      job.boards.append(child.getValueOfFirstChild<QString>(true));
+    }
+    job.save   = flag(node, "save");
+    job.strict = flag(node, "strict");
+    jobs.append(job);
+  }
+  return jobs;
+}
+
 void CommandLineInterface::processLibraryElement(const QString& libDir,
                                                  TransactionalFileSystem& fs,
                                                  LibraryBaseElement& element,
-                                                 bool save, bool strict,
+                                                 bool check, bool save,
+                                                 bool strict,
                                                  bool& success) const {
+  // Run checks
+  if (check) {
+    printVerbose(QString(tr("Check '%1' for library element issues..."))
+                     .arg(prettyPath(fs.getPath(), libDir)));
+
+    QStringList messages;
+    foreach (const auto& msg, element.runChecks()) {  // can throw
+      QString severity;
+      switch (msg->getSeverity()) {
+        case LibraryElementCheckMessage::Severity::Hint:
+          severity = tr("HINT");
+          break;
+        case LibraryElementCheckMessage::Severity::Warning:
+          severity = tr("WARNING");
+          success  = false;
+          break;
+        default:
+          severity = tr("ERROR");
+          success  = false;
+          break;
+      }
+      messages.append(QString("    - [%1] %2: %3")
+                          .arg(severity, prettyPath(fs.getPath(), libDir),
+                               msg->getMessage()));
+    }
+    // sort messages to increases readability of console output
+    std::sort(messages.begin(), messages.end());
+    foreach (const QString& msg, messages) { printErr(msg); }
+  }
+
   // Save element to transactional file system, if needed
   if (strict || save) {
     element.save();  // can throw
@@ -675,8 +909,8 @@ void CommandLineInterface::processLibraryElement(const QString& libDir,
 
   // Check for non-canonical files (strict mode)
   if (strict) {
-    qInfo() << QString(tr("Check '%1' for non-canonical files..."))
-                   .arg(prettyPath(fs.getPath(), libDir));
+    printVerbose(QString(tr("Check '%1' for non-canonical files..."))
+                     .arg(prettyPath(fs.getPath(), libDir)));
 
     QStringList paths = fs.checkForModifications();  // can throw
     // sort file paths to increases readability of console output
@@ -692,8 +926,8 @@ void CommandLineInterface::processLibraryElement(const QString& libDir,
 
   // Save element to file system, if needed
   if (save) {
-    qInfo()
-        << QString(tr("Save '%1'...")).arg(prettyPath(fs.getPath(), libDir));
+    printVerbose(
+        QString(tr("Save '%1'...")).arg(prettyPath(fs.getPath(), libDir)));
     if (failIfFileFormatUnstable()) {
       success = false;
     } else {
@@ -706,6 +940,59 @@ void CommandLineInterface::processLibraryElement(const QString& libDir,
   fs.discardChanges();
 }
 
+template <typename ElementType>
+QList<QFuture<CommandLineInterface::BatchResult>>
+    CommandLineInterface::startLibraryElementJobs(
+        const QStringList& dirs, const FilePath& libFp, const QString& libDir,
+        bool check, bool save, bool strict, QThreadPool& pool) const noexcept {
+  QList<QFuture<BatchResult>> futures;
+  foreach (const QString& dir, dirs) {
+    FilePath fp  = libFp.getPathTo(dir);
+    auto     job = [this, fp, libDir, check, save, strict]() -> BatchResult {
+      return processLibraryElementJob<ElementType>(fp, libDir, check, save,
+                                                   strict);
+    };
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
+    futures.append(QtConcurrent::run(&pool, job));
+#else
+    // custom thread pools are not supported, so the global thread pool is
+    // used (a warning is printed by openLibrary() if the job count differs)
+    Q_UNUSED(pool);
+    futures.append(QtConcurrent::run(job));
+#endif
+  }
+  return futures;
+}
+
+template <typename ElementType>
+CommandLineInterface::BatchResult
+    CommandLineInterface::processLibraryElementJob(const FilePath& fp,
+                                                   const QString&  libDir,
+                                                   bool check, bool save,
+                                                   bool strict) const noexcept {
+  QElapsedTimer timer;
+  timer.start();
+  sOutputBuffer.setLocalData(new OutputBuffer());  // takes ownership
+  BatchResult result;
+  result.success = true;
+  try {
+    printVerbose(QString(tr("Open '%1'...")).arg(prettyPath(fp, libDir)));
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::open(fp, save);  // can throw
+    ElementType element(std::unique_ptr<TransactionalDirectory>(
+        new TransactionalDirectory(fs)));  // can throw
+    processLibraryElement(libDir, *fs, element, check, save, strict,
+                          result.success);  // can throw
+  } catch (const Exception& e) {
+    printErr(QString(tr("ERROR: %1")).arg(e.getMsg()));
+    result.success = false;
+  }
+  result.elapsed = timer.elapsed();
+  result.output  = *sOutputBuffer.localData();
+  sOutputBuffer.setLocalData(nullptr);  // deletes the buffer
+  return result;
+}
+
 QString CommandLineInterface::prettyPath(const FilePath& path,
                                          const QString&  style) noexcept {
   if (QFileInfo(style).isAbsolute()) {
@@ -734,6 +1021,10 @@ bool CommandLineInterface::failIfFileFormatUnstable() noexcept {
 }
 
 void CommandLineInterface::print(const QString& str, int newlines) noexcept {
+  if (OutputBuffer* buffer = sOutputBuffer.localData()) {
+    buffer->append(qMakePair(false, str + QString("\n").repeated(newlines)));
+    return;
+  }
   QTextStream s(stdout);
   s << str;
   for (int i = 0; i < newlines; ++i) {
@@ -741,7 +1032,24 @@ void CommandLineInterface::print(const QString& str, int newlines) noexcept {
   }
 }
 
+void CommandLineInterface::printVerbose(const QString& str) noexcept {
+  if (OutputBuffer* buffer = sOutputBuffer.localData()) {
+    // qInfo() would bypass the buffer and mix up the output of parallel jobs,
+    // so the message is buffered like it would be printed by qInfo()
+    if (Debug::instance()->getDebugLevelStderr() >=
+        Debug::DebugLevel_t::Info) {
+      buffer->append(qMakePair(true, str + "\n"));
+    }
+    return;
+  }
+  qInfo() << str;
+}
+
 void CommandLineInterface::printErr(const QString& str, int newlines) noexcept {
+  if (OutputBuffer* buffer = sOutputBuffer.localData()) {
+    buffer->append(qMakePair(true, str + QString("\n").repeated(newlines)));
+    return;
+  }
   QTextStream s(stderr);
   s << str;
   for (int i = 0; i < newlines; ++i) {
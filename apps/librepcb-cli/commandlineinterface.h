@@ -59,6 +59,29 @@ public:
   // General Methods
   int execute() noexcept;
 
+private:  // Types
+  typedef QVector<QPair<bool, QString>> OutputBuffer;  ///< {isError, text}
+
+  struct BatchJob {
+    QString     projectFile;
+    bool        runErc = false;
+    QStringList exportSchematicsFiles;
+    QStringList exportBomFiles;
+    QStringList exportBoardBomFiles;
+    QString     bomAttributes;
+    bool        exportPcbFabricationData = false;
+    QString     pcbFabricationSettingsPath;
+    QStringList boards;
+    bool        save   = false;
+    bool        strict = false;
+  };
+
+  struct BatchResult {
+    bool         success = false;
+    qint64       elapsed = 0;  ///< Milliseconds
+    OutputBuffer output;
+  };
+
 private:  // Methods
   bool openProject(const QString& projectFile, bool runErc,
                    const QStringList& exportSchematicsFiles,
@@ -68,19 +91,36 @@ private:  // Methods
                    const QString&     pcbFabricationSettingsPath,
                    const QStringList& boards, bool save, bool strict) const
       noexcept;
-  bool openLibrary(const QString& libDir, bool all, bool save,
-                   bool strict) const noexcept;
+  bool openLibrary(const QString& libDir, bool all, bool check, bool save,
+                   bool strict, int jobs) const noexcept;
+  template <typename ElementType>
+  QList<QFuture<BatchResult>> startLibraryElementJobs(
+      const QStringList& dirs, const FilePath& libFp, const QString& libDir,
+      bool check, bool save, bool strict, QThreadPool& pool) const noexcept;
+  template <typename ElementType>
+  BatchResult processLibraryElementJob(const FilePath& fp,
+                                       const QString& libDir, bool check,
+                                       bool save, bool strict) const noexcept;
+  bool        runBatch(const QString& manifestFile, int jobs) const noexcept;
+  BatchResult runBatchJob(const BatchJob& job) const noexcept;
+  static QList<BatchJob> parseBatchManifest(const FilePath& fp);
   void processLibraryElement(const QString& libDir, TransactionalFileSystem& fs,
-                             library::LibraryBaseElement& element, bool save,
-                             bool strict, bool& success) const;
+                             library::LibraryBaseElement& element, bool check,
+                             bool save, bool strict, bool& success) const;
   static QString prettyPath(const FilePath& path,
                             const QString&  style) noexcept;
   static bool    failIfFileFormatUnstable() noexcept;
   static void    print(const QString& str, int newlines = 1) noexcept;
   static void    printErr(const QString& str, int newlines = 1) noexcept;
+  static void    printVerbose(const QString& str) noexcept;
 
 private:  // Data
   const Application& mApp;
+
+  /// If set, #print(), #printErr() and #printVerbose() write into this buffer
+  /// of the calling thread instead of stdout/stderr (used to print the output
+  /// of batch jobs and parallel library element jobs in a stable order)
+  static QThreadStorage<OutputBuffer*> sOutputBuffer;
 };
 
 /*******************************************************************************
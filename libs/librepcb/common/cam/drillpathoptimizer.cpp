@@ -0,0 +1,236 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "drillpathoptimizer.h"
+
+#include <QtCore>
+
+#include <algorithm>
+#include <limits>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+constexpr int DrillPathOptimizer::sTwoOptWindow;
+constexpr int DrillPathOptimizer::sMaxTwoOptPasses;
+
+/*******************************************************************************
+ *  Struct Report
+ ******************************************************************************/
+
+DrillPathOptimizer::Report& DrillPathOptimizer::Report::operator+=(
+    const Report& rhs) noexcept {
+  drills += rhs.drills;
+  travelBefore += rhs.travelBefore;
+  travelAfter += rhs.travelAfter;
+  return *this;
+}
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+DrillPathOptimizer::DrillPathOptimizer() noexcept
+  : mPositionBefore(), mPositionAfter(), mReport() {
+}
+
+DrillPathOptimizer::~DrillPathOptimizer() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+QList<Point> DrillPathOptimizer::optimize(const QList<Point>& drills) noexcept {
+  QList<Point> result = drills;
+  if (drills.count() > 1) {
+    result = sortByNearestNeighbour(mPositionAfter, drills);
+    improveByTwoOpt(mPositionAfter, result);
+    if (calcTravelDistance(mPositionAfter, result) >=
+        calcTravelDistance(mPositionAfter, drills)) {
+      result = drills;  // keep original order if it's already better
+    }
+  }
+  mReport.drills += drills.count();
+  mReport.travelBefore +=
+      Length(qRound64(calcTravelDistance(mPositionBefore, drills)));
+  mReport.travelAfter +=
+      Length(qRound64(calcTravelDistance(mPositionAfter, result)));
+  if (!drills.isEmpty()) {
+    mPositionBefore = drills.last();
+    mPositionAfter  = result.last();
+  }
+  return result;
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+qreal DrillPathOptimizer::calcTravelDistance(
+    const Point& start, const QList<Point>& drills) noexcept {
+  qreal travel   = 0;
+  Point position = start;
+  foreach (const Point& drill, drills) {
+    travel += distance(position, drill);
+    position = drill;
+  }
+  return travel;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QList<Point> DrillPathOptimizer::sortByNearestNeighbour(
+    const Point& start, const QList<Point>& drills) noexcept {
+  // put all drills into a grid of buckets with approx. one drill per bucket
+  qreal minX = std::numeric_limits<qreal>::max();
+  qreal minY = std::numeric_limits<qreal>::max();
+  qreal maxX = std::numeric_limits<qreal>::lowest();
+  qreal maxY = std::numeric_limits<qreal>::lowest();
+  foreach (const Point& drill, drills) {
+    minX = qMin(minX, qreal(drill.getX().toNm()));
+    minY = qMin(minY, qreal(drill.getY().toNm()));
+    maxX = qMax(maxX, qreal(drill.getX().toNm()));
+    maxY = qMax(maxY, qreal(drill.getY().toNm()));
+  }
+  qreal cellSize = qMax(qMax(maxX - minX, maxY - minY) /
+                            qCeil(qSqrt(qreal(drills.count()))),
+                        qreal(1));
+  int   columns  = qFloor((maxX - minX) / cellSize) + 1;
+  int   rows     = qFloor((maxY - minY) / cellSize) + 1;
+  QVector<QVector<int>> cells(columns * rows);
+  auto cellOf = [&](const Point& p, int& column, int& row) {
+    column = qFloor((p.getX().toNm() - minX) / cellSize);
+    row    = qFloor((p.getY().toNm() - minY) / cellSize);
+    column = qBound(0, column, columns - 1);
+    row    = qBound(0, row, rows - 1);
+  };
+  for (int i = 0; i < drills.count(); ++i) {
+    int column, row;
+    cellOf(drills.at(i), column, row);
+    cells[row * columns + column].append(i);
+  }
+
+  // always go to the nearest remaining drill
+  QList<Point> result;
+  result.reserve(drills.count());
+  Point position = start;
+  while (result.count() < drills.count()) {
+    int column, row;
+    cellOf(position, column, row);
+    qreal qx       = position.getX().toNm();
+    qreal qy       = position.getY().toNm();
+    int   best     = -1;
+    int   bestCell = -1;
+    qreal bestDist = std::numeric_limits<qreal>::max();
+    for (int r = 0;; ++r) {
+      // visit all cells on the ring with distance r around the current cell
+      for (int y = row - r; y <= row + r; ++y) {
+        if ((y < 0) || (y >= rows)) continue;
+        int step = ((y == row - r) || (y == row + r)) ? 1 : qMax(2 * r, 1);
+        for (int x = column - r; x <= column + r; x += step) {
+          if ((x < 0) || (x >= columns)) continue;
+          foreach (int index, cells.at(y * columns + x)) {
+            qreal d = distance(position, drills.at(index));
+            if ((d < bestDist) || ((d == bestDist) && (index < best))) {
+              best     = index;
+              bestCell = y * columns + x;
+              bestDist = d;
+            }
+          }
+        }
+      }
+      // drills outside the visited cells are at least this far away
+      bool  complete = true;
+      qreal bound    = std::numeric_limits<qreal>::max();
+      if (column - r > 0) {
+        bound    = qMin(bound, qx - (minX + (column - r) * cellSize));
+        complete = false;
+      }
+      if (column + r < columns - 1) {
+        bound    = qMin(bound, (minX + (column + r + 1) * cellSize) - qx);
+        complete = false;
+      }
+      if (row - r > 0) {
+        bound    = qMin(bound, qy - (minY + (row - r) * cellSize));
+        complete = false;
+      }
+      if (row + r < rows - 1) {
+        bound    = qMin(bound, (minY + (row + r + 1) * cellSize) - qy);
+        complete = false;
+      }
+      if (complete || ((best >= 0) && (bestDist <= bound))) {
+        break;
+      }
+    }
+    Q_ASSERT((best >= 0) && (bestCell >= 0));
+    cells[bestCell].removeOne(best);
+    result.append(drills.at(best));
+    position = drills.at(best);
+  }
+  return result;
+}
+
+void DrillPathOptimizer::improveByTwoOpt(const Point&  start,
+                                         QList<Point>& drills) noexcept {
+  // the start position is fixed, the end of the path is open
+  QVector<Point> path = QVector<Point>() << start << drills.toVector();
+  int            last = path.count() - 1;
+  for (int pass = 0; pass < sMaxTwoOptPasses; ++pass) {
+    bool improved = false;
+    for (int i = 1; i < last; ++i) {
+      for (int j = i + 1; j <= qMin(last, i + sTwoOptWindow); ++j) {
+        // gain of reversing the drills i..j
+        qreal delta = distance(path.at(i - 1), path.at(j)) -
+                      distance(path.at(i - 1), path.at(i));
+        if (j < last) {
+          delta += distance(path.at(i), path.at(j + 1)) -
+                   distance(path.at(j), path.at(j + 1));
+        }
+        if (delta < -1) {  // ignore improvements below 1nm (rounding errors)
+          std::reverse(path.begin() + i, path.begin() + j + 1);
+          improved = true;
+        }
+      }
+    }
+    if (!improved) {
+      break;
+    }
+  }
+  drills = path.mid(1).toList();
+}
+
+qreal DrillPathOptimizer::distance(const Point& p1, const Point& p2) noexcept {
+  qreal dx = p2.getX().toNm() - p1.getX().toNm();
+  qreal dy = p2.getY().toNm() - p1.getY().toNm();
+  return qSqrt(dx * dx + dy * dy);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,110 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_DRILLPATHOPTIMIZER_H
+#define LIBREPCB_DRILLPATHOPTIMIZER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../units/all_length_units.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class DrillPathOptimizer
+ ******************************************************************************/
+
+/**
+ * @brief The DrillPathOptimizer class reorders drills to reduce the travel
+ *        distance of the drill head
+ *
+ * The drills of each tool are passed to #optimize() one tool after another,
+ * in the order they are written to the drill file. The head starts at the
+ * origin and each tool continues where the previous tool stopped. The order
+ * is determined in two steps:
+ *
+ *  1. A nearest neighbour tour is built, using a grid of buckets to find the
+ *     nearest remaining drill quickly even for thousands of drills.
+ *  2. The tour is improved with 2-opt moves (reversing sub-sequences) until
+ *     no more improvement is found. To keep the runtime bounded for large
+ *     boards, only sub-sequences of up to #sTwoOptWindow drills are
+ *     considered and at most #sMaxTwoOptPasses passes are made.
+ *
+ * If the optimized order is not shorter than the original order (e.g.
+ * because the drills were already sorted), the original order is kept.
+ */
+class DrillPathOptimizer final {
+public:
+  // Types
+  struct Report {
+    int    drills       = 0;
+    Length travelBefore = Length(0);  ///< Travel distance of original order
+    Length travelAfter  = Length(0);  ///< Travel distance of optimized order
+
+    Report& operator+=(const Report& rhs) noexcept;
+  };
+
+  // Constructors / Destructor
+  DrillPathOptimizer(const DrillPathOptimizer& other) = delete;
+  DrillPathOptimizer() noexcept;
+  ~DrillPathOptimizer() noexcept;
+
+  // Getters
+  const Report& getReport() const noexcept { return mReport; }
+
+  // General Methods
+  QList<Point> optimize(const QList<Point>& drills) noexcept;
+
+  // Static Methods
+  static qreal calcTravelDistance(const Point&        start,
+                                  const QList<Point>& drills) noexcept;
+
+  // Operator Overloadings
+  DrillPathOptimizer& operator=(const DrillPathOptimizer& rhs) = delete;
+
+  // Static Variables
+  static constexpr int sTwoOptWindow    = 200;
+  static constexpr int sMaxTwoOptPasses = 10;
+
+private:  // Methods
+  static QList<Point> sortByNearestNeighbour(
+      const Point& start, const QList<Point>& drills) noexcept;
+  static void  improveByTwoOpt(const Point&  start,
+                               QList<Point>& drills) noexcept;
+  static qreal distance(const Point& p1, const Point& p2) noexcept;
+
+private:  // Data
+  Point  mPositionBefore;  ///< Head position after the original order
+  Point  mPositionAfter;   ///< Head position after the optimized order
+  Report mReport;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_DRILLPATHOPTIMIZER_H
@@ -35,7 +35,11 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-ExcellonGenerator::ExcellonGenerator() noexcept : mOutput() {
+ExcellonGenerator::ExcellonGenerator() noexcept
+  : mOutput(),
+    mDrillList(),
+    mDrillPathOptimizationEnabled(false),
+    mDrillPathReport() {
 }
 
 ExcellonGenerator::~ExcellonGenerator() noexcept {
@@ -64,6 +68,7 @@ void ExcellonGenerator::saveToFile(const FilePath& filepath) const {
 void ExcellonGenerator::reset() noexcept {
   mOutput.clear();
   mDrillList.clear();
+  mDrillPathReport = DrillPathOptimizer::Report();
 }
 
 /*******************************************************************************
@@ -98,15 +103,21 @@ void ExcellonGenerator::printToolList() noexcept {
 }
 
 void ExcellonGenerator::printDrills() noexcept {
+  DrillPathOptimizer optimizer;
   for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
     mOutput.append(QString("T%1\n").arg(i + 1));  // Select Tool
-    Length dia = mDrillList.uniqueKeys().value(i);
-    foreach (const Point& pos, mDrillList.values(dia)) {
+    Length       dia    = mDrillList.uniqueKeys().value(i);
+    QList<Point> drills = mDrillList.values(dia);
+    if (mDrillPathOptimizationEnabled) {
+      drills = optimizer.optimize(drills);
+    }
+    foreach (const Point& pos, drills) {
       mOutput.append(
           QString("X%1Y%2\n")
               .arg(pos.getX().toMmString(), pos.getY().toMmString()));
     }
   }
+  mDrillPathReport = optimizer.getReport();
 }
 
 void ExcellonGenerator::printFooter() noexcept {
@@ -26,6 +26,7 @@
 #include "../exceptions.h"
 #include "../fileio/filepath.h"
 #include "../units/all_length_units.h"
+#include "drillpathoptimizer.h"
 
 #include <QtCore>
 
@@ -53,6 +54,26 @@ public:
 
   // Getters
   const QString& toStr() const noexcept { return mOutput; }
+  bool           isDrillPathOptimizationEnabled() const noexcept {
+    return mDrillPathOptimizationEnabled;
+  }
+  const DrillPathOptimizer::Report& getDrillPathReport() const noexcept {
+    return mDrillPathReport;
+  }
+
+  // Setters
+
+  /**
+   * @brief Reorder the drills of each tool to reduce the travel distance
+   *
+   * See ::librepcb::DrillPathOptimizer for details. The effect is reported
+   * by #getDrillPathReport() after calling #generate().
+   *
+   * @param enabled   Whether the drill order should be optimized or not
+   */
+  void setDrillPathOptimizationEnabled(bool enabled) noexcept {
+    mDrillPathOptimizationEnabled = enabled;
+  }
 
   // General Methods
   void drill(const Point& pos, const PositiveLength& dia) noexcept;
@@ -72,6 +93,10 @@ private:
   // Excellon Data
   QString                  mOutput;
   QMultiMap<Length, Point> mDrillList;
+
+  // Drill Path Optimization
+  bool                       mDrillPathOptimizationEnabled;
+  DrillPathOptimizer::Report mDrillPathReport;
 };
 
 /*******************************************************************************
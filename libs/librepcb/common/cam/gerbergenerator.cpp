@@ -44,21 +44,34 @@ GerberGenerator::GerberGenerator(const QString& projName, const Uuid& projUuid,
   : mProjectId(escapeString(projName)),
     mProjectUuid(projUuid),
     mProjectRevision(escapeString(projRevision)),
-    mOutput(),
+    mOutputHeader(),
     mContent(),
+    mOutputFooter(),
     mApertureList(new GerberApertureList()),
     mCurrentApertureNumber(-1),
-    mMultiQuadrantArcModeOn(false) {
+    mMultiQuadrantArcModeOn(false),
+    mFlashMergingEnabled(false),
+    mFlashes(),
+    mMergedFlashCount(0) {
 }
 
 GerberGenerator::~GerberGenerator() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+QString GerberGenerator::toStr() const noexcept {
+  return QString::fromLatin1(mOutputHeader + mContent + mOutputFooter);
+}
+
 /*******************************************************************************
  *  Plot Methods
  ******************************************************************************/
 
 void GerberGenerator::setLayerPolarity(LayerPolarity p) noexcept {
+  mFlashes.clear();  // flashes of the other polarity must not be merged
   switch (p) {
     case LayerPolarity::Positive:
       mContent.append("%LPD*%\n");
@@ -165,22 +178,28 @@ void GerberGenerator::flashOctagon(const Point& pos, const UnsignedLength& w,
  ******************************************************************************/
 
 void GerberGenerator::reset() noexcept {
-  mOutput.clear();
+  mOutputHeader.clear();
   mContent.clear();
+  mOutputFooter.clear();
   mApertureList->reset();
   mCurrentApertureNumber = -1;
+  mFlashes.clear();
+  mMergedFlashCount = 0;
 }
 
 void GerberGenerator::generate() {
-  mOutput.clear();
-  printHeader();
-  printApertureList();
-  printContent();
-  printFooter();
+  QString header;
+  printHeader(header);
+  printApertureList(header);
+  header.append("G04 --- BOARD BEGIN --- *\n");
+  mOutputHeader = header.toLatin1();
+  printFooter(calcOutputMd5Checksum(header));
 }
 
 void GerberGenerator::saveToFile(const FilePath& filepath) const {
-  FileUtils::writeFile(filepath, mOutput.toLatin1());  // can throw
+  FileUtils::writeFile(
+      filepath, QVector<QByteArray>{mOutputHeader, mContent,
+                                    mOutputFooter});  // can throw
 }
 
 /*******************************************************************************
@@ -189,7 +208,9 @@ void GerberGenerator::saveToFile(const FilePath& filepath) const {
 
 void GerberGenerator::setCurrentAperture(int number) noexcept {
   if (number != mCurrentApertureNumber) {
-    mContent.append(QString("D%1*\n").arg(number));
+    mContent.append('D');
+    appendNumber(mContent, number);
+    mContent.append("*\n");
     mCurrentApertureNumber = number;
   }
 }
@@ -229,13 +250,13 @@ void GerberGenerator::switchToCircularCcwInterpolationModeG03() noexcept {
 }
 
 void GerberGenerator::moveToPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D02*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendPosition(pos);
+  mContent.append("D02*\n");
 }
 
 void GerberGenerator::linearInterpolateToPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D01*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  appendPosition(pos);
+  mContent.append("D01*\n");
 }
 
 void GerberGenerator::circularInterpolateToPosition(const Point& start,
@@ -245,9 +266,12 @@ void GerberGenerator::circularInterpolateToPosition(const Point& start,
   if (!mMultiQuadrantArcModeOn) {
     diff.makeAbs();  // no sign allowed in single quadrant mode!
   }
-  mContent.append(QString("X%1Y%2I%3J%4D01*\n")
-                      .arg(end.getX().toNmString(), end.getY().toNmString(),
-                           diff.getX().toNmString(), diff.getY().toNmString()));
+  appendPosition(end);
+  mContent.append('I');
+  appendNumber(mContent, diff.getX().toNm());
+  mContent.append('J');
+  appendNumber(mContent, diff.getY().toNm());
+  mContent.append("D01*\n");
 }
 
 void GerberGenerator::interpolateBetween(const Vertex& from, const Vertex& to) noexcept {
@@ -272,12 +296,28 @@ void GerberGenerator::interpolateBetween(const Vertex& from, const Vertex& to) n
 }
 
 void GerberGenerator::flashAtPosition(const Point& pos) noexcept {
-  mContent.append(QString("X%1Y%2D03*\n")
-                      .arg(pos.getX().toNmString(), pos.getY().toNmString()));
+  if (mFlashMergingEnabled) {
+    Flash flash(mCurrentApertureNumber,
+                qMakePair(pos.getX().toNm(), pos.getY().toNm()));
+    if (mFlashes.contains(flash)) {
+      ++mMergedFlashCount;
+      return;
+    }
+    mFlashes.insert(flash);
+  }
+  appendPosition(pos);
+  mContent.append("D03*\n");
 }
 
-void GerberGenerator::printHeader() noexcept {
-  mOutput.append("G04 --- HEADER BEGIN --- *\n");
+void GerberGenerator::appendPosition(const Point& pos) noexcept {
+  mContent.append('X');
+  appendNumber(mContent, pos.getX().toNm());
+  mContent.append('Y');
+  appendNumber(mContent, pos.getY().toNm());
+}
+
+void GerberGenerator::printHeader(QString& output) noexcept {
+  output.append("G04 --- HEADER BEGIN --- *\n");
 
   // add some X2 attributes
   QString appVersion   = qApp->applicationVersion();
@@ -285,57 +325,56 @@ void GerberGenerator::printHeader() noexcept {
   QString projId       = mProjectId.remove(',');
   QString projUuid     = mProjectUuid.toStr();
   QString projRevision = mProjectRevision.remove(',');
-  mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n")
-                     .arg(appVersion));
-  mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate));
-  mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n")
-                     .arg(projId, projUuid, projRevision));
-  mOutput.append("%TF.Part,Single*%\n");  // "Single" means "this is a PCB"
-  // mOutput.append("%TF.FilePolarity,Positive*%\n");
+  output.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n")
+                    .arg(appVersion));
+  output.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate));
+  output.append(QString("%TF.ProjectId,%1,%2,%3*%\n")
+                    .arg(projId, projUuid, projRevision));
+  output.append("%TF.Part,Single*%\n");  // "Single" means "this is a PCB"
+  // output.append("%TF.FilePolarity,Positive*%\n");
 
   // coordinate format specification:
   //  - leading zeros omitted
   //  - absolute coordinates
   //  - coordiante format "6.6" --> allows us to directly use LengthBase_t
   //  (nanometers)!
-  mOutput.append("%FSLAX66Y66*%\n");
+  output.append("%FSLAX66Y66*%\n");
 
   // set unit to millimeters
-  mOutput.append("%MOMM*%\n");
+  output.append("%MOMM*%\n");
 
   // start linear interpolation mode
-  mOutput.append("G01*\n");
+  output.append("G01*\n");
 
   // use single quadrant arc mode
-  mOutput.append("G74*\n");
+  output.append("G74*\n");
 
-  mOutput.append("G04 --- HEADER END --- *\n");
+  output.append("G04 --- HEADER END --- *\n");
 }
 
-void GerberGenerator::printApertureList() noexcept {
-  mOutput.append(mApertureList->generateString());
+void GerberGenerator::printApertureList(QString& output) noexcept {
+  output.append(mApertureList->generateString());
 }
 
-void GerberGenerator::printContent() noexcept {
-  mOutput.append("G04 --- BOARD BEGIN --- *\n");
-  mOutput.append(mContent);
-  mOutput.append("G04 --- BOARD END --- *\n");
-}
+void GerberGenerator::printFooter(const QString& checksum) noexcept {
+  mOutputFooter = "G04 --- BOARD END --- *\n";
 
-void GerberGenerator::printFooter() noexcept {
   // MD5 checksum over content
-  mOutput.append(QString("%TF.MD5,%1*%\n").arg(calcOutputMd5Checksum()));
+  mOutputFooter.append(QString("%TF.MD5,%1*%\n").arg(checksum).toLatin1());
 
   // end of file
-  mOutput.append("M02*\n");
+  mOutputFooter.append("M02*\n");
 }
 
-QString GerberGenerator::calcOutputMd5Checksum() const noexcept {
+QString GerberGenerator::calcOutputMd5Checksum(const QString& header) const
+    noexcept {
   // according to the RS-274C standard, linebreaks are not included in the
   // checksum
-  QString data = QString(mOutput).remove(QChar('\n'));
-  return QString(
-      QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
+  QCryptographicHash hash(QCryptographicHash::Md5);
+  addToChecksum(hash, header.toUtf8());
+  addToChecksum(hash, mContent);
+  addToChecksum(hash, mOutputFooter);  // only contains "BOARD END" yet
+  return QString(hash.result().toHex());
 }
 
 /*******************************************************************************
@@ -356,6 +395,36 @@ QString GerberGenerator::escapeString(const QString& str) noexcept {
   return ret;
 }
 
+void GerberGenerator::appendNumber(QByteArray& output, qint64 number) noexcept {
+  // much faster than QString::number() since no memory is allocated
+  char    buffer[24];
+  char*   end   = buffer + sizeof(buffer);
+  char*   begin = end;
+  quint64 value = (number < 0) ? (0 - static_cast<quint64>(number))
+                               : static_cast<quint64>(number);
+  do {
+    *--begin = static_cast<char>('0' + (value % 10));
+    value /= 10;
+  } while (value > 0);
+  if (number < 0) {
+    *--begin = '-';
+  }
+  output.append(begin, static_cast<int>(end - begin));
+}
+
+void GerberGenerator::addToChecksum(QCryptographicHash& hash,
+                                    const QByteArray&   data) noexcept {
+  // add data without linebreaks, but also without copying the data
+  int start = 0;
+  int end   = data.indexOf('\n');
+  while (end >= 0) {
+    hash.addData(data.constData() + start, end - start);
+    start = end + 1;
+    end   = data.indexOf('\n', start);
+  }
+  hash.addData(data.constData() + start, data.size() - start);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
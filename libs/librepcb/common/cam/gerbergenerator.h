@@ -47,6 +47,14 @@ class Vertex;
 /**
  * @brief The GerberGenerator class
  *
+ * The content is written as ASCII into a byte array while plotting, with
+ * coordinates formatted by a fast integer formatter (the coordinate format
+ * "6.6" in millimeters allows to write nanometers directly). Since the
+ * aperture list has to be written before the content but is only known after
+ * plotting, the file is assembled from three parts (header incl. aperture
+ * list, content, footer) which are written one after another into the file
+ * without concatenating them in memory.
+ *
  * @todo Remove/Escape illegal characters in
  *       ::librepcb::GerberGenerator::mProjectId and
  *       ::librepcb::GerberGenerator::mProjectRevision!
@@ -69,7 +77,24 @@ public:
   ~GerberGenerator() noexcept;
 
   // Getters
-  const QString& toStr() const noexcept { return mOutput; }
+  QString toStr() const noexcept;
+  bool isFlashMergingEnabled() const noexcept { return mFlashMergingEnabled; }
+  int  getMergedFlashCount() const noexcept { return mMergedFlashCount; }
+
+  // Setters
+
+  /**
+   * @brief Skip flashes which are identical to an already plotted flash
+   *
+   * If enabled, flashes with the same aperture at the same position as a
+   * previous flash (since the last layer polarity change) are not written
+   * again since they would not change the image at all.
+   *
+   * @param enabled   Whether identical flashes should be merged or not
+   */
+  void setFlashMergingEnabled(bool enabled) noexcept {
+    mFlashMergingEnabled = enabled;
+  }
 
   // Plot Methods
   void setLayerPolarity(LayerPolarity p) noexcept;
@@ -119,14 +144,20 @@ private:
                                         const Point& end) noexcept;
   void    interpolateBetween(const Vertex& from, const Vertex& to) noexcept;
   void    flashAtPosition(const Point& pos) noexcept;
-  void    printHeader() noexcept;
-  void    printApertureList() noexcept;
-  void    printContent() noexcept;
-  void    printFooter() noexcept;
-  QString calcOutputMd5Checksum() const noexcept;
+  void    appendPosition(const Point& pos) noexcept;
+  void    printHeader(QString& output) noexcept;
+  void    printApertureList(QString& output) noexcept;
+  void    printFooter(const QString& checksum) noexcept;
+  QString calcOutputMd5Checksum(const QString& header) const noexcept;
 
   // Static Methods
   static QString escapeString(const QString& str) noexcept;
+  static void    appendNumber(QByteArray& output, qint64 number) noexcept;
+  static void    addToChecksum(QCryptographicHash& hash,
+                               const QByteArray&   data) noexcept;
+
+  // Types
+  typedef QPair<int, QPair<LengthBase_t, LengthBase_t>> Flash;
 
   // Metadata
   QString mProjectId;
@@ -134,11 +165,17 @@ private:
   QString mProjectRevision;
 
   // Gerber Data
-  QString                            mOutput;
-  QString                            mContent;
+  QByteArray                         mOutputHeader;
+  QByteArray                         mContent;
+  QByteArray                         mOutputFooter;
   QScopedPointer<GerberApertureList> mApertureList;
   int                                mCurrentApertureNumber;
   bool                               mMultiQuadrantArcModeOn;
+
+  // Flash Merging
+  bool        mFlashMergingEnabled;
+  QSet<Flash> mFlashes;  ///< All flashes since the last polarity change
+  int         mMergedFlashCount;
 };
 
 /*******************************************************************************
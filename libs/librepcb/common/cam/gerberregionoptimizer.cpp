@@ -0,0 +1,224 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "gerberregionoptimizer.h"
+
+#include "../toolbox.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Struct Report
+ ******************************************************************************/
+
+GerberRegionOptimizer::Report& GerberRegionOptimizer::Report::operator+=(
+    const Report& rhs) noexcept {
+  paths += rhs.paths;
+  inputVertices += rhs.inputVertices;
+  outputVertices += rhs.outputVertices;
+  fittedArcs += rhs.fittedArcs;
+  maxDeviation = qMax(maxDeviation, rhs.maxDeviation);
+  return *this;
+}
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+GerberRegionOptimizer::GerberRegionOptimizer(
+    const UnsignedLength& tolerance, const UnsignedLength& maxSagitta) noexcept
+  : mTolerance(tolerance), mMaxSagitta(maxSagitta), mReport() {
+}
+
+GerberRegionOptimizer::~GerberRegionOptimizer() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+Path GerberRegionOptimizer::optimize(const Path& path) noexcept {
+  const QVector<Vertex>& input = path.getVertices();
+  QVector<Vertex>        output =
+      (input.count() > 3) ? removeCollinearVertices(fitArcs(input)) : input;
+  mReport.paths += 1;
+  mReport.inputVertices += input.count();
+  mReport.outputVertices += output.count();
+  return Path(output);
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QVector<Vertex> GerberRegionOptimizer::fitArcs(
+    const QVector<Vertex>& vertices) noexcept {
+  QVector<Vertex> result;
+  result.reserve(vertices.count());
+  int i = 0;
+  while (i < vertices.count() - 1) {
+    // extend the arc as long as the vertices still fit (greedy)
+    int   last = -1;
+    Angle angle;
+    qreal deviation = 0;
+    for (int j = i + 3; j < vertices.count(); ++j) {
+      Angle a;
+      qreal d = 0;
+      if (!fitArc(vertices, i, j, a, d)) {
+        break;
+      }
+      last      = j;
+      angle     = a;
+      deviation = d;
+    }
+    if (last > i) {
+      result.append(Vertex(vertices.at(i).getPos(), angle));
+      mReport.fittedArcs += 1;
+      mReport.maxDeviation =
+          qMax(mReport.maxDeviation, Length(qCeil(deviation)));
+      i = last;
+    } else {
+      result.append(vertices.at(i));
+      ++i;
+    }
+  }
+  result.append(vertices.last());
+  return result;
+}
+
+QVector<Vertex> GerberRegionOptimizer::removeCollinearVertices(
+    const QVector<Vertex>& vertices) noexcept {
+  QVector<Vertex> result;
+  result.reserve(vertices.count());
+  result.append(vertices.first());
+  int anchor = 0;
+  for (int i = 1; i < vertices.count() - 1; ++i) {
+    // the vertex can only be removed if it's located between straight segments
+    // and all vertices removed so far are still close to the new segment
+    bool removable = (vertices.at(anchor).getAngle() == 0) &&
+                     (vertices.at(i).getAngle() == 0);
+    Length deviation(0);
+    for (int k = anchor + 1; removable && (k <= i); ++k) {
+      UnsignedLength distance = Toolbox::shortestDistanceBetweenPointAndLine(
+          vertices.at(k).getPos(), vertices.at(anchor).getPos(),
+          vertices.at(i + 1).getPos());
+      removable = (distance <= mTolerance);
+      deviation = qMax(deviation, *distance);
+    }
+    if (removable) {
+      mReport.maxDeviation = qMax(mReport.maxDeviation, deviation);
+    } else {
+      result.append(vertices.at(i));
+      anchor = i;
+    }
+  }
+  result.append(vertices.last());
+  return result;
+}
+
+bool GerberRegionOptimizer::fitArc(const QVector<Vertex>& vertices, int first,
+                                   int last, Angle& angle,
+                                   qreal& deviation) const noexcept {
+  // only straight segments can be replaced
+  for (int i = first; i < last; ++i) {
+    if (vertices.at(i).getAngle() != 0) {
+      return false;
+    }
+  }
+
+  // circumcircle through the first, middle and last vertex (in nanometers,
+  // relative to the first vertex to keep the numbers small)
+  const Point& p0 = vertices.at(first).getPos();
+  Point        pb = vertices.at((first + last) / 2).getPos() - p0;
+  Point        pc = vertices.at(last).getPos() - p0;
+  qreal        bx = pb.getX().toNm(), by = pb.getY().toNm();
+  qreal        cx = pc.getX().toNm(), cy = pc.getY().toNm();
+  qreal        d  = 2 * (bx * cy - by * cx);
+  if (qAbs(d) < 1) {
+    return false;  // collinear
+  }
+  qreal b2 = bx * bx + by * by;
+  qreal c2 = cx * cx + cy * cy;
+  qreal ux = (cy * b2 - by * c2) / d;
+  qreal uy = (bx * c2 - cx * b2) / d;
+  qreal r  = qSqrt(ux * ux + uy * uy);
+
+  // all segments must turn in the same direction and must be short enough
+  // to be a flattened arc rather than a real polygon edge
+  qreal sweep = 0;
+  for (int i = first; i < last; ++i) {
+    Point p1 = vertices.at(i).getPos() - p0;
+    Point p2 = vertices.at(i + 1).getPos() - p0;
+    qreal x1 = p1.getX().toNm() - ux, y1 = p1.getY().toNm() - uy;
+    qreal x2 = p2.getX().toNm() - ux, y2 = p2.getY().toNm() - uy;
+    qreal a  = qAtan2(x1 * y2 - y1 * x2, x1 * x2 + y1 * y2);
+    if ((a == 0) || ((sweep != 0) && ((a > 0) != (sweep > 0)))) {
+      return false;
+    }
+    sweep += a;
+    qreal chord = qSqrt((x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1));
+    if (r - qSqrt(qMax(r * r - chord * chord / 4, qreal(0))) >
+        mMaxSagitta->toNm()) {
+      return false;
+    }
+  }
+  if (qAbs(sweep) > qDegreesToRadians(qreal(179))) {
+    return false;
+  }
+
+  // check the deviation against the arc which will actually be exported
+  angle = Angle::fromRad(sweep);
+  if (angle == 0) {
+    return false;
+  }
+  const Point& p1     = vertices.at(first).getPos();
+  const Point& p2     = vertices.at(last).getPos();
+  Point        center = Toolbox::arcCenter(p1, p2, angle);
+  qreal        radius = (p1 - center).getLength()->toNm();
+  deviation           = 0;
+  for (int i = first; i < last; ++i) {
+    // The distance to the center along a segment is largest at one of its
+    // vertices and smallest at the point closest to the center (e.g. the
+    // middle of a chord), so these points determine the max. deviation
+    // between the segment and the arc.
+    const Point& a = vertices.at(i).getPos();
+    const Point& b = vertices.at(i + 1).getPos();
+    qreal        da = (a - center).getLength()->toNm();
+    qreal        db = (b - center).getLength()->toNm();
+    qreal        dmin =
+        Toolbox::shortestDistanceBetweenPointAndLine(center, a, b)->toNm();
+    deviation = qMax(deviation, qMax(da, db) - radius);
+    deviation = qMax(deviation, radius - dmin);
+  }
+  return deviation <= mTolerance->toNm();
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,115 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_GERBERREGIONOPTIMIZER_H
+#define LIBREPCB_GERBERREGIONOPTIMIZER_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../geometry/path.h"
+#include "../units/all_length_units.h"
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class GerberRegionOptimizer
+ ******************************************************************************/
+
+/**
+ * @brief The GerberRegionOptimizer class reduces the vertex count of flattened
+ *        paths before they are written as Gerber regions (G36/G37)
+ *
+ * Paths calculated by Clipper (e.g. plane fragments) only consist of straight
+ * segments, with all arcs flattened into many short segments. This class
+ * compacts such paths in two steps:
+ *
+ *  1. Runs of at least three consecutive segments which lie on a common
+ *     circle (within #getTolerance()) are re-fitted into a single arc
+ *     segment, which is then written as G02/G03 command. Not only the
+ *     vertices but the whole segments are compared with the arc, i.e. the
+ *     sagitta of each segment must be within the tolerance too, since the arc
+ *     bulges outwards between the vertices. To avoid turning
+ *     real polygon corners into arcs, every replaced segment must be shorter
+ *     than a chord with a sagitta of #getMaxSagitta(). Arcs are limited to
+ *     less than 180° since that's what ::librepcb::Toolbox::arcCenter() is
+ *     able to handle.
+ *  2. Vertices between straight segments which deviate less than
+ *     #getTolerance() from the straight line between their neighbours are
+ *     removed.
+ *
+ * The first and the last vertex of a path are never modified, so closed paths
+ * stay closed.
+ */
+class GerberRegionOptimizer final {
+public:
+  // Types
+  struct Report {
+    int    paths          = 0;
+    int    inputVertices  = 0;
+    int    outputVertices = 0;
+    int    fittedArcs     = 0;
+    Length maxDeviation   = Length(0);  ///< Max. deviation of the outline
+
+    Report& operator+=(const Report& rhs) noexcept;
+  };
+
+  // Constructors / Destructor
+  GerberRegionOptimizer(const GerberRegionOptimizer& other) = delete;
+  GerberRegionOptimizer(
+      const UnsignedLength& tolerance  = UnsignedLength(1000),
+      const UnsignedLength& maxSagitta = UnsignedLength(6000)) noexcept;
+  ~GerberRegionOptimizer() noexcept;
+
+  // Getters
+  const UnsignedLength& getTolerance() const noexcept { return mTolerance; }
+  const UnsignedLength& getMaxSagitta() const noexcept { return mMaxSagitta; }
+  const Report&         getReport() const noexcept { return mReport; }
+
+  // General Methods
+  Path optimize(const Path& path) noexcept;
+
+  // Operator Overloadings
+  GerberRegionOptimizer& operator=(const GerberRegionOptimizer& rhs) = delete;
+
+private:  // Methods
+  QVector<Vertex> fitArcs(const QVector<Vertex>& vertices) noexcept;
+  QVector<Vertex> removeCollinearVertices(
+      const QVector<Vertex>& vertices) noexcept;
+  bool fitArc(const QVector<Vertex>& vertices, int first, int last,
+              Angle& angle, qreal& deviation) const noexcept;
+
+private:  // Data
+  UnsignedLength mTolerance;
+  UnsignedLength mMaxSagitta;
+  Report         mReport;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_GERBERREGIONOPTIMIZER_H
@@ -54,9 +54,11 @@ SOURCES += \
     boarddesignrules.cpp \
     bom/bom.cpp \
     bom/bomcsvwriter.cpp \
+    cam/drillpathoptimizer.cpp \
     cam/excellongenerator.cpp \
     cam/gerberaperturelist.cpp \
     cam/gerbergenerator.cpp \
+    cam/gerberregionoptimizer.cpp \
     debug.cpp \
     dialogs/aboutdialog.cpp \
     dialogs/boarddesignrulesdialog.cpp \
@@ -95,8 +97,11 @@ SOURCES += \
     graphics/circlegraphicsitem.cpp \
     graphics/defaultgraphicslayerprovider.cpp \
     graphics/graphicslayer.cpp \
+    graphics/graphicslevelofdetail.cpp \
+    graphics/graphicsrendercache.cpp \
     graphics/graphicsscene.cpp \
     graphics/graphicsview.cpp \
+    graphics/graphicsviewtilecache.cpp \
     graphics/holegraphicsitem.cpp \
     graphics/linegraphicsitem.cpp \
     graphics/origincrossgraphicsitem.cpp \
@@ -185,9 +190,11 @@ HEADERS += \
     boarddesignrules.h \
     bom/bom.h \
     bom/bomcsvwriter.h \
+    cam/drillpathoptimizer.h \
     cam/excellongenerator.h \
     cam/gerberaperturelist.h \
     cam/gerbergenerator.h \
+    cam/gerberregionoptimizer.h \
     circuitidentifier.h \
     debug.h \
     dialogs/aboutdialog.h \
@@ -236,8 +243,11 @@ HEADERS += \
     graphics/defaultgraphicslayerprovider.h \
     graphics/graphicslayer.h \
     graphics/graphicslayername.h \
+    graphics/graphicslevelofdetail.h \
+    graphics/graphicsrendercache.h \
     graphics/graphicsscene.h \
     graphics/graphicsview.h \
+    graphics/graphicsviewtilecache.h \
     graphics/holegraphicsitem.h \
     graphics/if_graphicsvieweventhandler.h \
     graphics/linegraphicsitem.h \
@@ -52,6 +52,11 @@ QByteArray FileUtils::readFile(const FilePath& filepath) {
 }
 
 void FileUtils::writeFile(const FilePath& filepath, const QByteArray& content) {
+  writeFile(filepath, QVector<QByteArray>{content});  // can throw
+}
+
+void FileUtils::writeFile(const FilePath&            filepath,
+                          const QVector<QByteArray>& chunks) {
   makePath(filepath.getParentDir());  // can throw
   QSaveFile file(filepath.toStr());
   if (!file.open(QIODevice::WriteOnly)) {
@@ -59,12 +64,15 @@ void FileUtils::writeFile(const FilePath& filepath, const QByteArray& content) {
                        QString(tr("Could not open or create file \"%1\": %2"))
                            .arg(filepath.toNative(), file.errorString()));
   }
-  qint64 written = file.write(content);
-  if (written != content.size()) {
-    qDebug() << "only" << written << "of" << content.size() << "bytes written";
-    throw RuntimeError(__FILE__, __LINE__,
-                       QString(tr("Could not write to file \"%1\": %2"))
-                           .arg(filepath.toNative(), file.errorString()));
+  foreach (const QByteArray& content, chunks) {
+    qint64 written = file.write(content);
+    if (written != content.size()) {
+      qDebug() << "only" << written << "of" << content.size()
+               << "bytes written";
+      throw RuntimeError(__FILE__, __LINE__,
+                         QString(tr("Could not write to file \"%1\": %2"))
+                             .arg(filepath.toNative(), file.errorString()));
+    }
   }
   if (!file.commit()) {
     throw RuntimeError(__FILE__, __LINE__,
@@ -76,6 +76,20 @@ public:
    */
   static void writeFile(const FilePath& filepath, const QByteArray& content);
 
+  /**
+   * @brief Write several chunks of data into a file
+   *
+   * Same as #writeFile(const FilePath&, const QByteArray&), but avoids
+   * concatenating large chunks in memory before writing them.
+   *
+   * @param filepath      The file to (over)write
+   * @param chunks        The chunks to write (in this order)
+   *
+   * @throws Exception    If an error occurs.
+   */
+  static void writeFile(const FilePath&            filepath,
+                        const QVector<QByteArray>& chunks);
+
   /**
    * @brief Copy a single file
    *
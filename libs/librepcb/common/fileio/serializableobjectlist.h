@@ -30,7 +30,9 @@
 #include <QtCore>
 
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <vector>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -53,7 +55,7 @@ namespace librepcb {
  *   librepcb::SExpression.
  * - Iterators (for example to use in C++11 range based for loops).
  * - Methods to find elements by UUID and/or name (if supported by template type
- *   `T`).
+ *   `T`). Lookups are accelerated by hash indices, see below.
  * - Method #sortedByUuid() to create a copy of the list with elements sorted by
  *   UUID.
  * - Signals to get notified about added, removed and modified elements.
@@ -86,6 +88,22 @@ namespace librepcb {
  * same address over the whole lifetime. To still minimize the risk of memory
  * leaks, `std::shared_ptr` is used instead of raw pointers.
  *
+ * @note    Lookups by pointer, UUID or name (#indexOf(), #contains(), #find(),
+ * #get(), #take() and #remove()) do not scan the whole list each time. Instead,
+ * the list lazily builds a hash index per key type on the first lookup. The
+ * index always covers a range of elements at the front of the list. Inserting,
+ * removing or renaming an element only shrinks that range to end before the
+ * modified element, so appending elements in a loop or editing elements at
+ * the end of the list never requires a full rebuild. Other edits (e.g. moving
+ * an element) keep the index as it is. Elements
+ * outside the indexed range are only indexed when a lookup requires it. Lists
+ * which are never queried don't allocate an index at all. Since renamed or
+ * re-assigned elements must be re-indexed, changes of the UUID or name of an
+ * element must be notified with its `onEdited` signal. Although the index is
+ * modified by const lookups, they are thread-safe since building the index is
+ * guarded by a mutex. As for Qt containers, modifying the list while other
+ * threads access it still requires external synchronization.
+ *
  * @warning Using Qt's `foreach` keyword on a ::librepcb::SerializableObjectList
  * is not recommended because it always creates a deep copy of the list! You
  * should use range based for loops (since C++11) instead.
@@ -201,28 +219,14 @@ public:
 
   // Element Query
   int indexOf(const T* obj) const noexcept {
-    for (int i = 0; i < count(); ++i) {
-      if (mObjects[i].get() == obj) {
-        return i;
-      }
-    }
-    return -1;
+    return lookup(mPointerIndex, obj, [](const T& o) { return &o; });
   }
   int indexOf(const Uuid& key) const noexcept {
-    for (int i = 0; i < count(); ++i) {
-      if (mObjects[i]->getUuid() == key) {
-        return i;
-      }
-    }
-    return -1;
+    return lookup(mUuidIndex, key, [](const T& o) { return o.getUuid(); });
   }
   int indexOf(const QString& name) const noexcept {
-    for (int i = 0; i < count(); ++i) {
-      if (mObjects[i]->getName() == name) {
-        return i;
-      }
-    }
-    return -1;
+    return lookup(mNameIndex, name,
+                  [](const T& o) { return toNameKey(o.getName()); });
   }
   bool contains(int index) const noexcept {
     return index >= 0 && index < mObjects.count();
@@ -412,13 +416,88 @@ public:
     return *this;
   }
 
+protected:  // Types
+  /**
+   * @brief Hash index for the elements at the front of the list
+   *
+   * Only the first `keys.size()` elements of the list are indexed. For every
+   * key in the indexed range, the index of its first occurrence is stored
+   * (same result as a linear search).
+   */
+  template <typename K>
+  struct LookupIndex {
+    QHash<K, int>              indices;
+    std::vector<K>             keys;   ///< Keys of the indexed elements
+    std::function<K(const T&)> keyOf;  ///< Set on the first lookup
+
+    int  count() const noexcept { return static_cast<int>(keys.size()); }
+    void append(const K& key) noexcept {
+      if (!indices.contains(key)) {
+        indices.insert(key, count());
+      }
+      keys.push_back(key);
+    }
+    void invalidateFrom(int index) noexcept {
+      for (int i = count() - 1; i >= index; --i) {
+        auto it = indices.find(keys.at(i));
+        if ((it != indices.end()) && (*it == i)) {
+          indices.erase(it);
+        }
+      }
+      if (count() > index) {
+        keys.erase(keys.begin() + index, keys.end());
+      }
+    }
+    void elementEdited(int index, const T& obj) noexcept {
+      // most edits (e.g. moving an element) don't change the key, so the
+      // index only needs to be shrunk if the key has actually changed
+      if ((index < count()) && keyOf && (keyOf(obj) != keys.at(index))) {
+        invalidateFrom(index);
+      }
+    }
+  };
+
 protected:  // Methods
+  template <typename K, typename F>
+  int lookup(LookupIndex<K>& index, const K& key, F keyOf) const noexcept {
+    QMutexLocker lock(&mIndexMutex);
+    if (!index.keyOf) {
+      index.keyOf = keyOf;
+    }
+    auto it = index.indices.constFind(key);
+    if (it != index.indices.constEnd()) {
+      return *it;
+    }
+    // not found in the indexed range, so extend the index until found
+    while (index.count() < mObjects.count()) {
+      int i = index.count();
+      index.append(keyOf(*mObjects.at(i)));
+      if (index.keys.back() == key) {
+        return i;
+      }
+    }
+    return -1;
+  }
+  static const QString& toNameKey(const QString& name) noexcept {
+    return name;
+  }
+  template <typename N>
+  static QString toNameKey(const N& name) noexcept {
+    return *name;  // e.g. librepcb::CircuitIdentifier
+  }
+  void invalidateIndices(int index) const noexcept {
+    mPointerIndex.invalidateFrom(index);
+    mUuidIndex.invalidateFrom(index);
+    mNameIndex.invalidateFrom(index);
+  }
   void insertElement(int index, const std::shared_ptr<T>& obj) noexcept {
+    invalidateIndices(index);
     mObjects.insert(index, obj);
     obj->onEdited.attach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementAdded);
   }
   std::shared_ptr<T> takeElement(int index) noexcept {
+    invalidateIndices(index);
     std::shared_ptr<T> obj = mObjects.takeAt(index);
     obj->onEdited.detach(mOnEditedSlot);
     onEdited.notify(index, obj, Event::ElementRemoved);
@@ -427,6 +506,9 @@ protected:  // Methods
   void elementEditedHandler(const T& obj, OnEditedArgs... args) noexcept {
     int index = indexOf(&obj);
     if (contains(index)) {
+      // the UUID or name might have changed
+      mUuidIndex.elementEdited(index, obj);
+      mNameIndex.elementEdited(index, obj);
       onElementEdited.notify(index, at(index), args...);
       onEdited.notify(index, at(index), Event::ElementEdited);
     } else {
@@ -454,8 +536,12 @@ protected:  // Methods
   }
 
 protected:  // Data
-  QVector<std::shared_ptr<T>> mObjects;
-  Slot<T, OnEditedArgs...>    mOnEditedSlot;
+  QVector<std::shared_ptr<T>>   mObjects;
+  Slot<T, OnEditedArgs...>      mOnEditedSlot;
+  mutable LookupIndex<const T*> mPointerIndex;
+  mutable LookupIndex<Uuid>     mUuidIndex;
+  mutable LookupIndex<QString>  mNameIndex;
+  mutable QMutex                mIndexMutex;  ///< Guards the lazy indices
 };
 
 }  // namespace librepcb
@@ -173,7 +173,12 @@ QByteArray TransactionalFileSystem::read(const QString& path) const {
   if (mModifiedFiles.contains(cleanedPath)) {
     return mModifiedFiles.value(cleanedPath);
   } else if (!isRemoved(cleanedPath)) {
-    return FileUtils::readFile(mFilePath.getPathTo(cleanedPath));  // can throw
+    QByteArray content =
+        FileUtils::readFile(mFilePath.getPathTo(cleanedPath));  // can throw
+    QByteArray   hash = calcContentHash(content);
+    QMutexLocker lock(&mDiskFileHashesMutex);
+    mDiskFileHashes.insert(cleanedPath, hash);
+    return content;
   } else {
     throw RuntimeError(__FILE__, __LINE__,
                        QString(tr("File '%1' does not exist."))
@@ -311,10 +316,7 @@ QStringList TransactionalFileSystem::checkForModifications() const {
 
   // new or modified files
   foreach (const QString& filepath, mModifiedFiles.keys()) {
-    FilePath   fp      = mFilePath.getPathTo(filepath);
-    QByteArray content = mModifiedFiles.value(filepath);
-    if ((!fp.isExistingFile()) ||
-        (FileUtils::readFile(fp) != content)) {  // can throw
+    if (isModified(filepath, mModifiedFiles.value(filepath))) {  // can throw
       modifications.append(filepath);
     }
   }
@@ -344,6 +346,12 @@ void TransactionalFileSystem::save() {
     if (fp.isExistingDir()) {
       FileUtils::removeDirRecursively(fp);  // can throw
     }
+    QMutexLocker lock(&mDiskFileHashesMutex);
+    foreach (const QString& filepath, mDiskFileHashes.keys()) {
+      if (dir.isEmpty() || filepath.startsWith(dir)) {
+        mDiskFileHashes.remove(filepath);
+      }
+    }
   }
 
   // remove files
@@ -352,12 +360,22 @@ void TransactionalFileSystem::save() {
     if (fp.isExistingFile()) {
       FileUtils::removeFile(fp);  // can throw
     }
+    QMutexLocker lock(&mDiskFileHashesMutex);
+    mDiskFileHashes.remove(filepath);
   }
 
   // save new or modified files
   foreach (const QString& filepath, mModifiedFiles.keys()) {
-    FileUtils::writeFile(mFilePath.getPathTo(filepath),
-                         mModifiedFiles.value(filepath));  // can throw
+    const QByteArray& content = mModifiedFiles[filepath];
+    {
+      // forget the old hash first, in case writing the file fails
+      QMutexLocker lock(&mDiskFileHashesMutex);
+      mDiskFileHashes.remove(filepath);
+    }
+    FileUtils::writeFile(mFilePath.getPathTo(filepath), content);  // can throw
+    QByteArray   hash = calcContentHash(content);
+    QMutexLocker lock(&mDiskFileHashesMutex);
+    mDiskFileHashes.insert(filepath, hash);
   }
 
   // remove backup
@@ -438,6 +456,30 @@ void TransactionalFileSystem::exportDirToZip(QuaZipFile&     file,
   }
 }
 
+bool TransactionalFileSystem::isModified(const QString&    path,
+                                         const QByteArray& content) const {
+  // if the file was read or written before, compare only the hashes
+  QByteArray diskHash;
+  {
+    QMutexLocker lock(&mDiskFileHashesMutex);
+    diskHash = mDiskFileHashes.value(path);
+  }
+  if (!diskHash.isEmpty()) {
+    return diskHash != calcContentHash(content);
+  }
+
+  // otherwise fall back to compare with the file on the disk
+  FilePath fp = mFilePath.getPathTo(path);
+  if (!fp.isExistingFile()) {
+    return true;
+  }
+  QByteArray diskContent = FileUtils::readFile(fp);  // can throw
+  QByteArray hash        = calcContentHash(diskContent);
+  QMutexLocker lock(&mDiskFileHashesMutex);
+  mDiskFileHashes.insert(path, hash);
+  return diskContent != content;
+}
+
 void TransactionalFileSystem::saveDiff(const QString& type) const {
   QDateTime dt       = QDateTime::currentDateTime();
   FilePath  dir      = mFilePath.getPathTo("." % type);
@@ -504,6 +546,11 @@ void TransactionalFileSystem::removeDiff(const QString& type) {
   FileUtils::removeDirRecursively(dir);  // can throw
 }
 
+QByteArray TransactionalFileSystem::calcContentHash(
+    const QByteArray& content) noexcept {
+  return QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
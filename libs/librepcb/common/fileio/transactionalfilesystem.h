@@ -59,6 +59,12 @@ namespace librepcb {
  *  - Holds all file modifications in memory and allows to write those in an
  *    atomic way to the disk (see @ref doc_project_save).
  *  - Allows to export the whole file system to a ZIP file.
+ *
+ * For every file read from the disk, a hash of its content is memorized. This
+ * allows #checkForModifications() to detect unchanged files without reading
+ * them again from the disk. This assumes that the files on the disk are not
+ * modified by others while the file system is opened, which is anyway
+ * guaranteed by the directory lock in R/W mode.
  */
 class TransactionalFileSystem final : public FileSystem {
   Q_OBJECT
@@ -185,9 +191,11 @@ private:  // Methods
   bool isRemoved(const QString& path) const noexcept;
   void exportDirToZip(QuaZipFile& file, const FilePath& zipFp,
                       const QString& dir) const;
+  bool isModified(const QString& path, const QByteArray& content) const;
   void saveDiff(const QString& type) const;
   void loadDiff(const FilePath& fp);
   void removeDiff(const QString& type);
+  static QByteArray calcContentHash(const QByteArray& content) noexcept;
 
 private:  // Data
   FilePath      mFilePath;
@@ -199,6 +207,11 @@ private:  // Data
   QHash<QString, QByteArray> mModifiedFiles;
   QSet<QString>              mRemovedFiles;
   QSet<QString>              mRemovedDirs;
+
+  /// Content hashes of the files on the disk (only those read or written so
+  /// far), used to detect modifications without reading the files again
+  mutable QHash<QString, QByteArray> mDiskFileHashes;
+  mutable QMutex                     mDiskFileHashesMutex;
 };
 
 /*******************************************************************************
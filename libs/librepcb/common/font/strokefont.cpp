@@ -41,7 +41,10 @@ namespace fb = fontobene;
 
 StrokeFont::StrokeFont(const FilePath&   fontFilePath,
                        const QByteArray& content) noexcept
-  : QObject(nullptr), mFilePath(fontFilePath) {
+  : QObject(nullptr),
+    mFilePath(fontFilePath),
+    mGlyphCacheHits(0),
+    mGlyphCacheMisses(0) {
   // load the font in another thread because it takes some time to load it
   qDebug() << "Start loading font" << mFilePath.toNative();
   mFuture = QtConcurrent::run([content]() {
@@ -70,6 +73,21 @@ Ratio StrokeFont::getLineSpacing() const noexcept {
   return Ratio::fromNormalized(mFont->header.lineSpacing / 9);
 }
 
+int StrokeFont::getGlyphCacheSize() const noexcept {
+  QMutexLocker lock(&mGlyphCacheMutex);
+  return mGlyphCache.count();
+}
+
+int StrokeFont::getGlyphCacheHits() const noexcept {
+  QMutexLocker lock(&mGlyphCacheMutex);
+  return mGlyphCacheHits;
+}
+
+int StrokeFont::getGlyphCacheMisses() const noexcept {
+  QMutexLocker lock(&mGlyphCacheMutex);
+  return mGlyphCacheMisses;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -154,22 +172,19 @@ QVector<Path> StrokeFont::strokeLine(const QString&        text,
   Length        offset = 0;
   width                = 0;  // same as offset, but without last letter spacing
   for (int i = 0; i < text.length(); ++i) {
-    Length        glyphSpacing;
-    QVector<Path> glyphPaths = strokeGlyph(text.at(i), height, glyphSpacing);
-    if (!glyphPaths.isEmpty()) {
-      Point bottomLeft, topRight;
-      computeBoundingRect(glyphPaths, bottomLeft, topRight);
-      Length shift =
-          (i == 0) ? -bottomLeft.getX() : 0;  // left-align first character
-      foreach (const Path& p, glyphPaths) {
+    Glyph glyph = getGlyph(text.at(i), height);
+    if (!glyph.paths.isEmpty()) {
+      Length shift = (i == 0) ? -glyph.bottomLeft.getX()
+                              : Length(0);  // left-align first character
+      foreach (const Path& p, glyph.paths) {
         paths.append(p.translated(Point(offset + shift, Length(0))));
       }
-      width = offset + topRight.getX() +
+      width = offset + glyph.topRight.getX() +
               shift;  // do *not* count glyph spacing as width!
-      offset = width + glyphSpacing + letterSpacing;
-    } else if (glyphSpacing != 0) {
+      offset = width + glyph.spacing + letterSpacing;
+    } else if (glyph.spacing != 0) {
       // it's a whitespace-only glyph -> count additional glyph spacing as width
-      width  = offset + glyphSpacing;
+      width  = offset + glyph.spacing;
       offset = width + letterSpacing;
     }
   }
@@ -179,18 +194,9 @@ QVector<Path> StrokeFont::strokeLine(const QString&        text,
 QVector<Path> StrokeFont::strokeGlyph(const QChar&          glyph,
                                       const PositiveLength& height,
                                       Length& spacing) const noexcept {
-  try {
-    qreal                 glyphSpacing = 0;
-    QVector<fb::Polyline> polylines =
-        accessor().getAllPolylinesOfGlyph(glyph.unicode(),
-                                          &glyphSpacing);  // can throw
-    spacing = convertLength(height, glyphSpacing);
-    return polylines2paths(polylines, height);
-  } catch (const fb::Exception& e) {
-    qWarning() << "Failed to load stroke font glyph" << glyph;
-    spacing = 0;
-    return QVector<Path>();
-  }
+  Glyph g = getGlyph(glyph, height);
+  spacing = g.spacing;
+  return g.paths;
 }
 
 /*******************************************************************************
@@ -202,6 +208,7 @@ void StrokeFont::fontLoaded() noexcept {
 }
 
 const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept {
+  QMutexLocker lock(&mFontMutex);
   if (!mFont) {
     try {
       mFont.reset(new fb::Font(mFuture.result()));  // can throw
@@ -226,6 +233,37 @@ const fb::GlyphListAccessor& StrokeFont::accessor() const noexcept {
   return *mGlyphListAccessor;
 }
 
+StrokeFont::Glyph StrokeFont::getGlyph(const QChar&          glyph,
+                                       const PositiveLength& height) const
+    noexcept {
+  QMutexLocker              lock(&mGlyphCacheMutex);
+  QPair<uint, LengthBase_t> key(glyph.unicode(), height->toNm());
+  auto                      it = mGlyphCache.constFind(key);
+  if (it != mGlyphCache.constEnd()) {
+    ++mGlyphCacheHits;
+    return *it;
+  }
+  ++mGlyphCacheMisses;
+
+  Glyph g;
+  try {
+    qreal                 glyphSpacing = 0;
+    QVector<fb::Polyline> polylines =
+        accessor().getAllPolylinesOfGlyph(glyph.unicode(),
+                                          &glyphSpacing);  // can throw
+    g.spacing = convertLength(height, glyphSpacing);
+    g.paths   = polylines2paths(polylines, height);
+    if (!g.paths.isEmpty()) {
+      computeBoundingRect(g.paths, g.bottomLeft, g.topRight);
+    }
+  } catch (const fb::Exception& e) {
+    qWarning() << "Failed to load stroke font glyph" << glyph;
+    g.spacing = 0;
+  }
+  mGlyphCache.insert(key, g);
+  return g;
+}
+
 QVector<Path> StrokeFont::polylines2paths(
     const QVector<fb::Polyline>& polylines,
     const PositiveLength&        height) noexcept {
@@ -48,6 +48,14 @@ namespace librepcb {
 
 /**
  * @brief The StrokeFont class
+ *
+ * Stroked glyphs are cached per character and height, so texts which are
+ * updated often (e.g. names and values of all components after attributes
+ * have changed) do not convert the same glyphs again and again. Since all
+ * texts using the same font share one StrokeFont object (see
+ * ::librepcb::StrokeFontPool), the cache is shared between them too. Access to
+ * the cache is thread-safe, and so is loading the font, thus a StrokeFont
+ * object can be shared between projects opened in different threads.
  */
 class StrokeFont final : public QObject {
   Q_OBJECT
@@ -61,6 +69,9 @@ public:
   // Getters
   Ratio getLetterSpacing() const noexcept;
   Ratio getLineSpacing() const noexcept;
+  int   getGlyphCacheSize() const noexcept;
+  int   getGlyphCacheHits() const noexcept;
+  int   getGlyphCacheMisses() const noexcept;
 
   // General Methods
   QVector<Path> stroke(const QString& text, const PositiveLength& height,
@@ -79,9 +90,19 @@ public:
   // Operator Overloadings
   StrokeFont& operator=(const StrokeFont& rhs) = delete;
 
+private:  // Types
+  struct Glyph {
+    QVector<Path> paths;
+    Length        spacing;
+    Point         bottomLeft;
+    Point         topRight;
+  };
+
 private:
   void                                fontLoaded() noexcept;
   const fontobene::GlyphListAccessor& accessor() const noexcept;
+  Glyph getGlyph(const QChar& glyph, const PositiveLength& height) const
+      noexcept;
   static QVector<Path>                polylines2paths(
                      const QVector<fontobene::Polyline>& polylines,
                      const PositiveLength&               height) noexcept;
@@ -98,9 +119,16 @@ private:  // Data
   FilePath                                             mFilePath;
   QFuture<fontobene::Font>                             mFuture;
   QFutureWatcher<fontobene::Font>                      mWatcher;
+  mutable QMutex                                       mFontMutex;
   mutable QScopedPointer<fontobene::Font>              mFont;
   mutable QScopedPointer<fontobene::GlyphListCache>    mGlyphListCache;
   mutable QScopedPointer<fontobene::GlyphListAccessor> mGlyphListAccessor;
+
+  // Glyph cache
+  mutable QMutex                                       mGlyphCacheMutex;
+  mutable QHash<QPair<uint, LengthBase_t>, Glyph>      mGlyphCache;
+  mutable int                                          mGlyphCacheHits;
+  mutable int                                          mGlyphCacheMisses;
 };
 
 /*******************************************************************************
@@ -35,15 +35,25 @@ namespace librepcb {
  *  Constructors / Destructor
  ******************************************************************************/
 
-StrokeFontPool::StrokeFontPool(const FileSystem& directory) noexcept {
+StrokeFontPool::StrokeFontPool(const FileSystem&     directory,
+                               const StrokeFontPool* shared) noexcept {
   foreach (const QString& filename, directory.getFiles()) {
     FilePath fp = directory.getAbsPath(filename);
     if (fp.getSuffix() != "bene") continue;
     try {
-      qDebug() << "Load stroke font:" << filename;
-      mFonts.insert(filename, std::make_shared<StrokeFont>(
-                                  fp,
-                                  directory.read(filename)));  // can throw
+      QByteArray content = directory.read(filename);  // can throw
+      QByteArray hash =
+          QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+      std::shared_ptr<StrokeFont> font =
+          shared ? shared->mFontsByHash.value(hash) : nullptr;
+      if (font) {
+        qDebug() << "Reuse already loaded stroke font:" << filename;
+      } else {
+        qDebug() << "Load stroke font:" << filename;
+        font = std::make_shared<StrokeFont>(fp, content);
+      }
+      mFonts.insert(filename, font);
+      mFontsByHash.insert(hash, font);
     } catch (const Exception& e) {
       qCritical() << "Failed to load stroke font" << fp.toNative() << ":"
                   << e.getMsg();
@@ -42,13 +42,19 @@ class FileSystem;
 
 /**
  * @brief The StrokeFontPool class
+ *
+ * If another pool is passed to the constructor, fonts with exactly the same
+ * content as a font of that pool are not loaded again but the already loaded
+ * ::librepcb::StrokeFont object is shared (including its glyph cache). This
+ * avoids loading the same fonts again and again for each opened project.
  */
 class StrokeFontPool final {
   Q_DECLARE_TR_FUNCTIONS(StrokeFontPool)
 
 public:
   // Constructors / Destructor
-  explicit StrokeFontPool(const FileSystem& directory) noexcept;
+  explicit StrokeFontPool(const FileSystem&     directory,
+                          const StrokeFontPool* shared = nullptr) noexcept;
   StrokeFontPool(const StrokeFontPool& other) = delete;
   ~StrokeFontPool() noexcept;
 
@@ -59,7 +65,8 @@ public:
   StrokeFontPool& operator=(const StrokeFontPool& rhs) noexcept;
 
 private:  // Data
-  QHash<QString, std::shared_ptr<StrokeFont>> mFonts;
+  QHash<QString, std::shared_ptr<StrokeFont>>    mFonts;
+  QHash<QByteArray, std::shared_ptr<StrokeFont>> mFontsByHash;  ///< SHA-256
 };
 
 /*******************************************************************************
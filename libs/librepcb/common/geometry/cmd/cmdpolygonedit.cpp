@@ -56,6 +56,16 @@ CmdPolygonEdit::~CmdPolygonEdit() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdPolygonEdit::getApproxMemoryUsage() const noexcept {
+  return sizeof(*this) +
+      (mOldPath.getVertices().capacity() + mNewPath.getVertices().capacity()) *
+      sizeof(Vertex);
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -63,6 +63,11 @@ public:
   // Operator Overloadings
   CmdPolygonEdit& operator=(const CmdPolygonEdit& rhs) = delete;
 
+  // Getters
+
+  /// @copydoc UndoCommand::getApproxMemoryUsage()
+  qint64 getApproxMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
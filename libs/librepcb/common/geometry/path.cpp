@@ -186,7 +186,9 @@ bool Path::close() noexcept {
 }
 
 void Path::serialize(SExpression& root) const {
-  serializeObjectContainer(root, mVertices, "vertex");
+  foreach (const Vertex& vertex, mVertices) {
+    root.appendChild(vertex.serializeToDomElement("vertex"), true);
+  }
 }
 
 /*******************************************************************************
@@ -49,8 +49,12 @@ namespace librepcb {
  *
  * For a valid path, minimum two vertices are required. Paths with less than two
  * vertices are useless and thus considered as invalid.
+ *
+ * The vertices are stored in a contiguous QVector of trivially copyable
+ * ::librepcb::Vertex objects, so paths can be copied and iterated without any
+ * per-vertex overhead.
  */
-class Path final : public SerializableObject {
+class Path final {
 public:
   // Constructors / Destructor
   Path() noexcept : mVertices(), mPainterPathPx() {}
@@ -91,7 +95,7 @@ public:
   bool close() noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
-  void serialize(SExpression& root) const override;
+  void serialize(SExpression& root) const;
 
   // Operator Overloadings
   bool operator==(const Path& rhs) const noexcept {
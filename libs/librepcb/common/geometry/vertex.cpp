@@ -60,12 +60,6 @@ bool Vertex::operator==(const Vertex& rhs) const noexcept {
   return mPos == rhs.mPos && mAngle == rhs.mAngle;
 }
 
-Vertex& Vertex::operator=(const Vertex& rhs) noexcept {
-  mPos   = rhs.mPos;
-  mAngle = rhs.mAngle;
-  return *this;
-}
-
 /*******************************************************************************
  *  Non-Member Functions
  ******************************************************************************/
@@ -23,7 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
-#include "../fileio/serializableobject.h"
+#include "../fileio/sexpression.h"
 #include "../units/all_length_units.h"
 
 #include <QtCore>
@@ -39,17 +39,19 @@ namespace librepcb {
 
 /**
  * @brief The Vertex class
+ *
+ * Like ::librepcb::Point, this is a trivially copyable value type without
+ * vtable pointer to keep ::librepcb::Path objects compact.
  */
-class Vertex final : public SerializableObject {
+class Vertex final {
 public:
   // Constructors / Destructor
   Vertex() noexcept : mPos(), mAngle() {}
-  Vertex(const Vertex& other) noexcept
-    : mPos(other.mPos), mAngle(other.mAngle) {}
+  Vertex(const Vertex& other) noexcept = default;
   explicit Vertex(const Point& pos, const Angle& angle = Angle::deg0()) noexcept
     : mPos(pos), mAngle(angle) {}
   explicit Vertex(const SExpression& node);
-  ~Vertex() noexcept {}
+  ~Vertex() noexcept = default;
 
   // Getters
   const Point& getPos() const noexcept { return mPos; }
@@ -60,13 +62,20 @@ public:
   void setAngle(const Angle& angle) noexcept { mAngle = angle; }
 
   // General Methods
+  /// @copydoc librepcb::SerializableObject::serializeToDomElement()
+  SExpression serializeToDomElement(const QString& name) const {
+    SExpression root = SExpression::createList(name);
+    serialize(root);
+    return root;
+  }
+
   /// @copydoc librepcb::SerializableObject::serialize()
-  void serialize(SExpression& root) const override;
+  void serialize(SExpression& root) const;
 
   // Operator Overloadings
   bool operator==(const Vertex& rhs) const noexcept;
   bool operator!=(const Vertex& rhs) const noexcept { return !(*this == rhs); }
-  Vertex& operator=(const Vertex& rhs) noexcept;
+  Vertex& operator=(const Vertex& rhs) noexcept = default;
 
 private:  // Data
   Point mPos;
@@ -84,10 +93,16 @@ inline uint qHash(const Vertex& key, uint seed = 0) noexcept {
   return ::qHash(qMakePair(key.getPos(), key.getAngle()), seed);
 }
 
+// Make sure that the Vertex class does not contain a vptr (only padding).
+static_assert(sizeof(Vertex) < sizeof(Point) + sizeof(Angle) + sizeof(void*),
+              "Vertex must not contain a vptr!");
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
 
 }  // namespace librepcb
 
+Q_DECLARE_TYPEINFO(librepcb::Vertex, Q_PRIMITIVE_TYPE);
+
 #endif  // LIBREPCB_VERTEX_H
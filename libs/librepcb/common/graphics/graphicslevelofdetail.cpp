@@ -0,0 +1,152 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "graphicslevelofdetail.h"
+
+#include "graphicsview.h"
+
+#include <QtCore>
+#include <QtWidgets>
+
+#include <cmath>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+GraphicsLevelOfDetail::GraphicsLevelOfDetail() noexcept
+  : mEnabled(true), mMinTextHeightPx(8), mMinItemSizePx(4) {
+}
+
+GraphicsLevelOfDetail::GraphicsLevelOfDetail(bool  enabled,
+                                             qreal minTextHeightPx,
+                                             qreal minItemSizePx) noexcept
+  : mEnabled(enabled),
+    mMinTextHeightPx(minTextHeightPx),
+    mMinItemSizePx(minItemSizePx) {
+}
+
+GraphicsLevelOfDetail::GraphicsLevelOfDetail(
+    const GraphicsLevelOfDetail& other) noexcept
+  : mEnabled(other.mEnabled),
+    mMinTextHeightPx(other.mMinTextHeightPx),
+    mMinItemSizePx(other.mMinItemSizePx) {
+}
+
+GraphicsLevelOfDetail::~GraphicsLevelOfDetail() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+qreal GraphicsLevelOfDetail::getOutlineTolerancePx(qreal lod) const noexcept {
+  if ((!mEnabled) || (lod <= 0)) {
+    return 0;
+  }
+  return qPow(2, qFloor(std::log2(qreal(0.5) / lod)));
+}
+
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+QPolygonF GraphicsLevelOfDetail::simplifyPolygon(const QPolygonF& polygon,
+                                                 qreal tolerance) noexcept {
+  if ((polygon.count() < 3) || (tolerance <= 0)) {
+    return polygon;
+  }
+
+  // Douglas-Peucker, with an explicit stack since polygons may be huge
+  QVector<bool> keep(polygon.count(), false);
+  keep.first() = true;
+  keep.last()  = true;
+  QVector<QPair<int, int>> ranges;
+  ranges.append(qMakePair(0, polygon.count() - 1));
+  while (!ranges.isEmpty()) {
+    QPair<int, int> range = ranges.takeLast();
+    const QPointF&  p1    = polygon.at(range.first);
+    QPointF         d     = polygon.at(range.second) - p1;
+    qreal           len   = qSqrt(d.x() * d.x() + d.y() * d.y());
+    int             index = -1;
+    qreal           max   = tolerance;
+    for (int i = range.first + 1; i < range.second; ++i) {
+      QPointF v    = polygon.at(i) - p1;
+      qreal   dist = (len > 0) ? qAbs(d.x() * v.y() - d.y() * v.x()) / len
+                               : qSqrt(v.x() * v.x() + v.y() * v.y());
+      if (dist > max) {
+        index = i;
+        max   = dist;
+      }
+    }
+    if (index >= 0) {
+      keep[index] = true;
+      ranges.append(qMakePair(range.first, index));
+      ranges.append(qMakePair(index, range.second));
+    }
+  }
+
+  QPolygonF result;
+  for (int i = 0; i < polygon.count(); ++i) {
+    if (keep.at(i)) {
+      result.append(polygon.at(i));
+    }
+  }
+  return result;
+}
+
+const GraphicsLevelOfDetail& GraphicsLevelOfDetail::fromWidget(
+    const QWidget* widget) noexcept {
+  // The widget passed to QGraphicsItem::paint() is the viewport of the view.
+  const GraphicsView* view =
+      widget ? qobject_cast<const GraphicsView*>(widget->parentWidget())
+             : nullptr;
+  if (view) {
+    return view->getLevelOfDetail();
+  } else {
+    static const GraphicsLevelOfDetail fullDetail(false, 0, 0);
+    return fullDetail;
+  }
+}
+
+/*******************************************************************************
+ *  Operator Overloadings
+ ******************************************************************************/
+
+GraphicsLevelOfDetail& GraphicsLevelOfDetail::operator=(
+    const GraphicsLevelOfDetail& rhs) noexcept {
+  mEnabled         = rhs.mEnabled;
+  mMinTextHeightPx = rhs.mMinTextHeightPx;
+  mMinItemSizePx   = rhs.mMinItemSizePx;
+  return *this;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
@@ -0,0 +1,176 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_GRAPHICSLEVELOFDETAIL_H
+#define LIBREPCB_GRAPHICSLEVELOFDETAIL_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class GraphicsLevelOfDetail
+ ******************************************************************************/
+
+/**
+ * @brief The GraphicsLevelOfDetail class decides whether graphics items are
+ *        painted with full details or with a simplified representation
+ *
+ * When zoomed out, many items (texts, footprints, symbols, traces) are only a
+ * few pixels large on the screen, so painting their full geometry is a waste
+ * of time. Graphics items can ask this class (with the level of detail from
+ * QStyleOptionGraphicsItem::levelOfDetailFromTransform()) whether they are
+ * large enough to be painted in detail, or whether a simplified
+ * representation (e.g. a bounding box) is sufficient. Large outlines (e.g.
+ * plane fragments) can be simplified with #simplifyPolygon() using the
+ * tolerance returned by #getOutlineTolerancePx().
+ *
+ * Each ::librepcb::GraphicsView holds its own settings (configured from the
+ * workspace settings). Use #fromWidget() in QGraphicsItem::paint() to get the
+ * settings of the view which is currently painted. Painting on other devices
+ * (printers, images, ...) always uses full details.
+ */
+class GraphicsLevelOfDetail final {
+public:
+  // Constructors / Destructor
+  GraphicsLevelOfDetail() noexcept;
+  GraphicsLevelOfDetail(bool enabled, qreal minTextHeightPx,
+                        qreal minItemSizePx) noexcept;
+  GraphicsLevelOfDetail(const GraphicsLevelOfDetail& other) noexcept;
+  ~GraphicsLevelOfDetail() noexcept;
+
+  // Getters
+  bool  isEnabled() const noexcept { return mEnabled; }
+  qreal getMinTextHeightPx() const noexcept { return mMinTextHeightPx; }
+  qreal getMinItemSizePx() const noexcept { return mMinItemSizePx; }
+
+  // Setters
+  void setEnabled(bool enabled) noexcept { mEnabled = enabled; }
+  void setMinTextHeightPx(qreal px) noexcept { mMinTextHeightPx = px; }
+  void setMinItemSizePx(qreal px) noexcept { mMinItemSizePx = px; }
+
+  // General Methods
+
+  /**
+   * @brief Check whether a text is large enough to be painted
+   *
+   * @param lod             Level of detail of the painter transformation
+   * @param textHeightPx    Height of the text in scene pixels
+   *
+   * @return False if the text should be skipped or replaced by a box
+   */
+  bool isTextDetailed(qreal lod, qreal textHeightPx) const noexcept {
+    return (!mEnabled) || (lod * textHeightPx >= mMinTextHeightPx);
+  }
+
+  /**
+   * @brief Check whether an item is large enough to be painted in detail
+   *
+   * @param lod     Level of detail of the painter transformation
+   * @param rect    Bounding rect of the item in scene pixels
+   *
+   * @return False if a simplified representation should be painted
+   */
+  bool isItemDetailed(qreal lod, const QRectF& rect) const noexcept {
+    return (!mEnabled) ||
+           (lod * qMax(rect.width(), rect.height()) >= mMinItemSizePx);
+  }
+
+  /**
+   * @brief Check whether a line is wide enough to be painted with its width
+   *
+   * Lines thinner than one device pixel look the same as cosmetic lines, but
+   * are much more expensive to rasterize.
+   *
+   * @param lod       Level of detail of the painter transformation
+   * @param widthPx   Line width in scene pixels
+   *
+   * @return False if the line should be painted as a cosmetic line
+   */
+  bool isLineDetailed(qreal lod, qreal widthPx) const noexcept {
+    return (!mEnabled) || (lod * widthPx >= 1);
+  }
+
+  /**
+   * @brief Get the tolerance to simplify outlines with
+   *
+   * The tolerance corresponds to half a device pixel, rounded down to a power
+   * of two. So the result only changes at discrete zoom levels, which allows
+   * callers to cache simplified outlines per tolerance.
+   *
+   * @param lod     Level of detail of the painter transformation
+   *
+   * @return Max. deviation in scene pixels, or 0 if outlines must not be
+   *         simplified
+   */
+  qreal getOutlineTolerancePx(qreal lod) const noexcept;
+
+  // Static Methods
+
+  /**
+   * @brief Remove vertices which deviate less than a tolerance from the
+   *        simplified outline (Douglas-Peucker algorithm)
+   *
+   * The first and the last vertex are always kept, so closed polygons stay
+   * closed.
+   *
+   * @param polygon     The polygon to simplify
+   * @param tolerance   Max. deviation of removed vertices
+   *
+   * @return The simplified polygon
+   */
+  static QPolygonF simplifyPolygon(const QPolygonF& polygon,
+                                   qreal            tolerance) noexcept;
+
+  /**
+   * @brief Get the settings to use for painting on a specific widget
+   *
+   * @param widget  The widget passed to QGraphicsItem::paint() (may be
+   *                nullptr)
+   *
+   * @return The settings of the ::librepcb::GraphicsView the widget belongs
+   *         to, or settings with disabled simplifications if the widget is not
+   *         a viewport of a ::librepcb::GraphicsView.
+   */
+  static const GraphicsLevelOfDetail& fromWidget(
+      const QWidget* widget) noexcept;
+
+  // Operator Overloadings
+  GraphicsLevelOfDetail& operator=(const GraphicsLevelOfDetail& rhs) noexcept;
+
+private:  // Data
+  bool  mEnabled;
+  qreal mMinTextHeightPx;
+  qreal mMinItemSizePx;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_GRAPHICSLEVELOFDETAIL_H
@@ -0,0 +1,143 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "graphicsrendercache.h"
+
+#include <QtCore>
+#include <QtGui>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Struct GraphicsRenderCache::Primitive
+ ******************************************************************************/
+
+GraphicsRenderCache::Primitive::Primitive(
+    const QPainterPath& path, const GraphicsLayer* strokeLayer,
+    qreal lineWidthPx, const GraphicsLayer* fillLayer) noexcept
+  : path(path),
+    pen(Qt::NoPen),
+    penHighlighted(Qt::NoPen),
+    brush(Qt::NoBrush),
+    brushHighlighted(Qt::NoBrush) {
+  if (strokeLayer && strokeLayer->isVisible()) {
+    pen = QPen(strokeLayer->getColor(false), lineWidthPx, Qt::SolidLine,
+               Qt::RoundCap, Qt::RoundJoin);
+    penHighlighted = QPen(strokeLayer->getColor(true), lineWidthPx,
+                          Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin);
+  }
+  if (fillLayer && fillLayer->isVisible()) {
+    brush            = QBrush(fillLayer->getColor(false), Qt::SolidPattern);
+    brushHighlighted = QBrush(fillLayer->getColor(true), Qt::SolidPattern);
+  }
+}
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+GraphicsRenderCache::GraphicsRenderCache(
+    const IF_GraphicsLayerProvider& layers) noexcept
+  : mLayers(layers),
+    mOnLayerEditedSlot(*this, &GraphicsRenderCache::layerEdited),
+    mHitCount(0),
+    mMissCount(0) {
+}
+
+GraphicsRenderCache::~GraphicsRenderCache() noexcept {
+}
+
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+int GraphicsRenderCache::getEntryCount() const noexcept {
+  int count = 0;
+  foreach (const auto& entry, mEntries) {
+    if (!entry.expired()) ++count;
+  }
+  return count;
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+GraphicsLayer* GraphicsRenderCache::getLayer(const QString& name) noexcept {
+  GraphicsLayer* layer = mLayers.getLayer(name);
+  if (layer) {
+    layer->onEdited.attach(mOnLayerEditedSlot);  // no-op if already attached
+  }
+  return layer;
+}
+
+std::shared_ptr<const GraphicsRenderCache::Entry> GraphicsRenderCache::get(
+    const void* element, int variant, const Builder& builder) noexcept {
+  Key                          key(element, variant);
+  std::shared_ptr<const Entry> entry = mEntries.value(key).lock();
+  if (entry) {
+    ++mHitCount;
+  } else {
+    ++mMissCount;
+    std::shared_ptr<Entry> newEntry = std::make_shared<Entry>();
+    builder(*newEntry);
+    entry = newEntry;
+    mEntries.insert(key, entry);
+  }
+  return entry;
+}
+
+void GraphicsRenderCache::invalidate() noexcept {
+  mEntries.clear();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void GraphicsRenderCache::layerEdited(const GraphicsLayer& layer,
+                                      GraphicsLayer::Event event) noexcept {
+  Q_UNUSED(layer);
+  switch (event) {
+    case GraphicsLayer::Event::ColorChanged:
+    case GraphicsLayer::Event::HighlightColorChanged:
+    case GraphicsLayer::Event::VisibleChanged:
+    case GraphicsLayer::Event::EnabledChanged:
+    case GraphicsLayer::Event::Destroyed:
+      invalidate();
+      break;
+    default:
+      qWarning() << "Unhandled switch-case in "
+                    "GraphicsRenderCache::layerEdited():"
+                 << static_cast<int>(event);
+      break;
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
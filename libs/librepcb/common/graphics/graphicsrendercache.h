@@ -0,0 +1,188 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_GRAPHICSRENDERCACHE_H
+#define LIBREPCB_GRAPHICSRENDERCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "graphicslayer.h"
+
+#include <QtCore>
+#include <QtGui>
+
+#include <functional>
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class GraphicsRenderCache
+ ******************************************************************************/
+
+/**
+ * @brief The GraphicsRenderCache class records the drawing of library elements
+ *        once and shares it between all graphics items which draw them
+ *
+ * Typically many graphics items (e.g. all symbols of a schematic which are
+ * instances of the same library symbol) draw exactly the same polygons and
+ * circles. Instead of resolving layers, creating pens/brushes and converting
+ * paths on every paint event of every item, the graphics items request an
+ * ::librepcb::GraphicsRenderCache::Entry from this cache. The entry contains
+ * a prepared display list (painter paths with resolved pens and brushes) as
+ * well as the bounding rect and shape of the element. It is built only once
+ * per element and variant (e.g. mirrored or not) and then replayed by every
+ * item.
+ *
+ * The cache listens to all layers used while building entries and drops all
+ * entries as soon as the color or visibility of one of these layers changes.
+ *
+ * Entries are reference counted: The cache only keeps weak references, so an
+ * entry is released automatically as soon as no graphics item uses it anymore.
+ * This makes sure a destroyed library element can never be confused with a
+ * new one allocated at the same address.
+ */
+class GraphicsRenderCache final {
+public:
+  // Types
+
+  /**
+   * @brief A single, fully resolved drawing operation
+   */
+  struct Primitive {
+    QPainterPath path;
+    QPen         pen;
+    QPen         penHighlighted;
+    QBrush       brush;
+    QBrush       brushHighlighted;
+
+    /**
+     * @brief Constructor
+     *
+     * @param path          The path to draw (in item coordinates)
+     * @param strokeLayer   The layer used for the outline. If nullptr or
+     *                      not visible, no outline will be drawn.
+     * @param lineWidthPx   Width of the outline
+     * @param fillLayer     The layer used to fill the path. If nullptr or
+     *                      not visible, the path won't be filled.
+     */
+    Primitive(const QPainterPath& path, const GraphicsLayer* strokeLayer,
+              qreal lineWidthPx, const GraphicsLayer* fillLayer) noexcept;
+
+    void draw(QPainter& painter, bool highlighted) const noexcept {
+      painter.setPen(highlighted ? penHighlighted : pen);
+      painter.setBrush(highlighted ? brushHighlighted : brush);
+      painter.drawPath(path);
+    }
+  };
+
+  /**
+   * @brief A cached element drawing
+   */
+  struct Entry {
+    QVector<Primitive> primitives;
+    QRectF             boundingRect;
+    QPainterPath       shape;
+
+    void draw(QPainter& painter, bool highlighted) const noexcept {
+      for (const Primitive& primitive : primitives) {
+        primitive.draw(painter, highlighted);
+      }
+    }
+  };
+
+  /**
+   * @brief Callback to build a new entry
+   */
+  typedef std::function<void(Entry&)> Builder;
+
+  // Constructors / Destructor
+  GraphicsRenderCache()                                 = delete;
+  GraphicsRenderCache(const GraphicsRenderCache& other) = delete;
+  explicit GraphicsRenderCache(const IF_GraphicsLayerProvider& layers) noexcept;
+  ~GraphicsRenderCache() noexcept;
+
+  // Getters
+  int getEntryCount() const noexcept;
+  int getHitCount() const noexcept { return mHitCount; }
+  int getMissCount() const noexcept { return mMissCount; }
+
+  // General Methods
+
+  /**
+   * @brief Get a layer by name and track it for invalidation
+   *
+   * Builder callbacks must use this method to get their layers, otherwise
+   * changes of the layer are not detected.
+   *
+   * @param name  Name of the layer
+   *
+   * @return The layer, or nullptr if it doesn't exist
+   */
+  GraphicsLayer* getLayer(const QString& name) noexcept;
+
+  /**
+   * @brief Get (or build) the cached entry of an element
+   *
+   * @param element   Pointer to the drawn element (e.g. a library symbol)
+   * @param variant   Additional key to distinguish different drawings of the
+   *                  same element (e.g. mirrored or not)
+   * @param builder   Callback which builds the entry if it is not cached
+   *
+   * @return The shared entry (never nullptr)
+   */
+  std::shared_ptr<const Entry> get(const void* element, int variant,
+                                   const Builder& builder) noexcept;
+
+  /**
+   * @brief Drop all cached entries
+   *
+   * Graphics items still holding an entry keep it alive until they request
+   * a new one.
+   */
+  void invalidate() noexcept;
+
+  // Operator Overloadings
+  GraphicsRenderCache& operator=(const GraphicsRenderCache& rhs) = delete;
+
+private:  // Methods
+  void layerEdited(const GraphicsLayer& layer,
+                   GraphicsLayer::Event event) noexcept;
+
+private:  // Data
+  typedef QPair<const void*, int> Key;
+
+  const IF_GraphicsLayerProvider&        mLayers;
+  GraphicsLayer::OnEditedSlot            mOnLayerEditedSlot;
+  QHash<Key, std::weak_ptr<const Entry>> mEntries;
+  int                                    mHitCount;
+  int                                    mMissCount;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_GRAPHICSRENDERCACHE_H
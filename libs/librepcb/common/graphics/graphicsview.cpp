@@ -25,6 +25,7 @@
 #include "../gridproperties.h"
 #include "QtOpenGL"
 #include "graphicsscene.h"
+#include "graphicsviewtilecache.h"
 #include "if_graphicsvieweventhandler.h"
 
 #include <QtCore>
@@ -49,6 +50,8 @@ GraphicsView::GraphicsView(QWidget*                     parent,
     mSceneRectMarker(),
     mOriginCrossVisible(true),
     mUseOpenGl(false),
+    mLevelOfDetail(),
+    mBackgroundTileCache(nullptr),
     mPanningActive(false) {
   setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
   setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
@@ -110,6 +113,22 @@ void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept {
   viewport()->grabGesture(Qt::PinchGesture);
 }
 
+void GraphicsView::setLevelOfDetail(
+    const GraphicsLevelOfDetail& lod) noexcept {
+  mLevelOfDetail = lod;
+  viewport()->update();
+}
+
+void GraphicsView::setBackgroundTileCacheEnabled(bool enabled) noexcept {
+  if (enabled && (!mBackgroundTileCache)) {
+    mBackgroundTileCache = new GraphicsViewTileCache(this);
+  } else if ((!enabled) && mBackgroundTileCache) {
+    delete mBackgroundTileCache;
+    mBackgroundTileCache = nullptr;
+  }
+  viewport()->update();
+}
+
 void GraphicsView::setGridProperties(
     const GridProperties& properties) noexcept {
   *mGridProperties = properties;
@@ -186,6 +205,62 @@ void GraphicsView::handleMouseWheelEvent(
   event->setAccepted(true);
 }
 
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
+
+void GraphicsView::drawGrid(QPainter& painter, const QRectF& rect,
+                            const QBrush&         background,
+                            const GridProperties& grid,
+                            qreal                 scaleFactor) noexcept {
+  painter.save();
+  QPen gridPen(Qt::gray);
+  gridPen.setCosmetic(true);
+
+  // draw background color
+  painter.setPen(Qt::NoPen);
+  painter.setBrush(background);
+  painter.fillRect(rect, background);
+
+  // draw background grid lines
+  gridPen.setWidth((grid.getType() == GridProperties::Type_t::Dots) ? 2 : 1);
+  painter.setPen(gridPen);
+  painter.setBrush(Qt::NoBrush);
+  qreal gridIntervalPixels = grid.getInterval()->toPx();
+  if (gridIntervalPixels * scaleFactor >= (qreal)5) {
+    qreal left, right, top, bottom;
+    left   = qFloor(rect.left() / gridIntervalPixels) * gridIntervalPixels;
+    right  = rect.right();
+    top    = rect.top();
+    bottom = qFloor(rect.bottom() / gridIntervalPixels) * gridIntervalPixels;
+    switch (grid.getType()) {
+      case GridProperties::Type_t::Lines: {
+        QVarLengthArray<QLineF, 500> lines;
+        for (qreal x = left; x < right; x += gridIntervalPixels)
+          lines.append(QLineF(x, rect.top(), x, rect.bottom()));
+        for (qreal y = bottom; y > top; y -= gridIntervalPixels)
+          lines.append(QLineF(rect.left(), y, rect.right(), y));
+        painter.setOpacity(0.5);
+        painter.drawLines(lines.data(), lines.size());
+        break;
+      }
+
+      case GridProperties::Type_t::Dots: {
+        QVarLengthArray<QPointF, 2000> dots;
+        for (qreal x = left; x < right; x += gridIntervalPixels)
+          for (qreal y = bottom; y > top; y -= gridIntervalPixels)
+            dots.append(QPointF(x, y));
+        painter.drawPoints(dots.data(), dots.size());
+        break;
+      }
+
+      default:
+        break;
+    }
+  }
+  painter.restore();
+}
+
 /*******************************************************************************
  *  Public Slots
  ******************************************************************************/
@@ -329,51 +404,19 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event) {
 }
 
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect) {
-  QPen gridPen(Qt::gray);
-  gridPen.setCosmetic(true);
-
-  // draw background color
-  painter->setPen(Qt::NoPen);
-  painter->setBrush(backgroundBrush());
-  painter->fillRect(rect, backgroundBrush());
-
-  // draw background grid lines
-  gridPen.setWidth(
-      (mGridProperties->getType() == GridProperties::Type_t::Dots) ? 2 : 1);
-  painter->setPen(gridPen);
-  painter->setBrush(Qt::NoBrush);
-  qreal gridIntervalPixels = mGridProperties->getInterval()->toPx();
-  qreal scaleFactor        = width() / rect.width();
-  if (gridIntervalPixels * scaleFactor >= (qreal)5) {
-    qreal left, right, top, bottom;
-    left   = qFloor(rect.left() / gridIntervalPixels) * gridIntervalPixels;
-    right  = rect.right();
-    top    = rect.top();
-    bottom = qFloor(rect.bottom() / gridIntervalPixels) * gridIntervalPixels;
-    switch (mGridProperties->getType()) {
-      case GridProperties::Type_t::Lines: {
-        QVarLengthArray<QLineF, 500> lines;
-        for (qreal x = left; x < right; x += gridIntervalPixels)
-          lines.append(QLineF(x, rect.top(), x, rect.bottom()));
-        for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-          lines.append(QLineF(rect.left(), y, rect.right(), y));
-        painter->setOpacity(0.5);
-        painter->drawLines(lines.data(), lines.size());
-        break;
-      }
-
-      case GridProperties::Type_t::Dots: {
-        QVarLengthArray<QPointF, 2000> dots;
-        for (qreal x = left; x < right; x += gridIntervalPixels)
-          for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-            dots.append(QPointF(x, y));
-        painter->drawPoints(dots.data(), dots.size());
-        break;
-      }
-
-      default:
-        break;
-    }
+  if (mBackgroundTileCache) {
+#if (QT_VERSION >= QT_VERSION_CHECK(5, 6, 0))
+    qreal devicePixelRatio = viewport()->devicePixelRatioF();
+#else
+    qreal devicePixelRatio = viewport()->devicePixelRatio();
+#endif
+    mBackgroundTileCache->setParameters(backgroundBrush().color(),
+                                        *mGridProperties, transform().m11(),
+                                        devicePixelRatio);
+    mBackgroundTileCache->draw(*painter, rect);
+  } else {
+    drawGrid(*painter, rect, backgroundBrush(), *mGridProperties,
+             width() / rect.width());
   }
 }
 
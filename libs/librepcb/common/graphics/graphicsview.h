@@ -24,6 +24,7 @@
  *  Includes
  ******************************************************************************/
 #include "../units/all_length_units.h"
+#include "graphicslevelofdetail.h"
 
 #include <QtCore>
 #include <QtWidgets>
@@ -35,6 +36,7 @@ namespace librepcb {
 
 class IF_GraphicsViewEventHandler;
 class GraphicsScene;
+class GraphicsViewTileCache;
 class GridProperties;
 
 /*******************************************************************************
@@ -61,9 +63,25 @@ public:
   const GridProperties& getGridProperties() const noexcept {
     return *mGridProperties;
   }
+  const GraphicsLevelOfDetail& getLevelOfDetail() const noexcept {
+    return mLevelOfDetail;
+  }
+  bool isBackgroundTileCacheEnabled() const noexcept {
+    return mBackgroundTileCache != nullptr;
+  }
 
   // Setters
   void setUseOpenGl(bool useOpenGl) noexcept;
+  void setLevelOfDetail(const GraphicsLevelOfDetail& lod) noexcept;
+
+  /**
+   * @brief Enable or disable the tiled off-screen cache for the background
+   *
+   * @see ::librepcb::GraphicsViewTileCache
+   *
+   * @param enabled   Whether the cache should be used or not
+   */
+  void setBackgroundTileCacheEnabled(bool enabled) noexcept;
   void setGridProperties(const GridProperties& properties) noexcept;
   void setScene(GraphicsScene* scene) noexcept;
   void setVisibleSceneRect(const QRectF& rect) noexcept;
@@ -87,6 +105,23 @@ public:
                                bool mapToGrid) const noexcept;
   void  handleMouseWheelEvent(QGraphicsSceneWheelEvent* event) noexcept;
 
+  // Static Methods
+
+  /**
+   * @brief Draw the background color and grid of a scene rect
+   *
+   * This method is thread-safe as long as the painter is not shared.
+   *
+   * @param painter       Painter with the scene transformation applied
+   * @param rect          Scene rect to draw
+   * @param background    Background brush
+   * @param grid          Grid properties
+   * @param scaleFactor   Scale factor from scene pixels to view pixels
+   */
+  static void drawGrid(QPainter& painter, const QRectF& rect,
+                       const QBrush& background, const GridProperties& grid,
+                       qreal scaleFactor) noexcept;
+
 public slots:
 
   // Public Slots
@@ -127,6 +162,8 @@ private:
   QRectF                       mSceneRectMarker;
   bool                         mOriginCrossVisible;
   bool                         mUseOpenGl;
+  GraphicsLevelOfDetail        mLevelOfDetail;
+  GraphicsViewTileCache*       mBackgroundTileCache;
   volatile bool                mPanningActive;
   QCursor                      mCursorBeforePanning;
 
@@ -0,0 +1,238 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "graphicsviewtilecache.h"
+
+#include "graphicsview.h"
+
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore>
+#include <QtGui>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+
+constexpr int GraphicsViewTileCache::sTileSize;
+constexpr int GraphicsViewTileCache::sMaxTiles;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+GraphicsViewTileCache::GraphicsViewTileCache(QObject* parent) noexcept
+  : QObject(parent),
+    mBackground(),
+    mGrid(),
+    mScale(0),
+    mDevicePixelRatio(1),
+    mGeneration(0),
+    mUseCounter(0) {
+}
+
+GraphicsViewTileCache::~GraphicsViewTileCache() noexcept {
+  // The worker threads do not access this object, but wait for them anyway
+  // to not leave running jobs behind.
+  foreach (QFutureWatcher<QImage>* watcher, mWatchers) {
+    watcher->waitForFinished();
+  }
+}
+
+/*******************************************************************************
+ *  Setters
+ ******************************************************************************/
+
+void GraphicsViewTileCache::setParameters(const QColor&         background,
+                                          const GridProperties& grid,
+                                          qreal                 scale,
+                                          qreal devicePixelRatio) noexcept {
+  if ((background != mBackground) || (grid.getType() != mGrid.getType()) ||
+      (grid.getInterval() != mGrid.getInterval()) || (scale != mScale) ||
+      (devicePixelRatio != mDevicePixelRatio)) {
+    mBackground       = background;
+    mGrid             = grid;
+    mScale            = scale;
+    mDevicePixelRatio = devicePixelRatio;
+    invalidate();
+  }
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+void GraphicsViewTileCache::invalidate() noexcept {
+  ++mGeneration;  // discard results of all running jobs
+  mTiles.clear();
+  mPendingTiles.clear();
+}
+
+QRect GraphicsViewTileCache::getTileRange(const QRectF& rect) const noexcept {
+  qreal tileSize = getTileSceneSize();
+  int   left     = qFloor(rect.left() / tileSize);
+  int   top      = qFloor(rect.top() / tileSize);
+  int   right    = qMax(qCeil(rect.right() / tileSize) - 1, left);
+  int   bottom   = qMax(qCeil(rect.bottom() / tileSize) - 1, top);
+  return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+QRectF GraphicsViewTileCache::getTileSceneRect(const QPoint& index) const
+    noexcept {
+  qreal tileSize = getTileSceneSize();
+  return QRectF(index.x() * tileSize, index.y() * tileSize, tileSize,
+                tileSize);
+}
+
+void GraphicsViewTileCache::draw(QPainter& painter,
+                                 const QRectF& rect) noexcept {
+  if (mScale <= 0) {
+    return;
+  }
+
+  // draw cached tiles, or paint the background directly if not cached yet
+  QTransform transform = painter.worldTransform();
+  QRect      range     = getTileRange(rect);
+  for (int x = range.left(); x <= range.right(); ++x) {
+    for (int y = range.top(); y <= range.bottom(); ++y) {
+      TileIndex index(x, y);
+      QRectF    tileRect = getTileSceneRect(QPoint(x, y));
+      auto      it       = mTiles.find(index);
+      if (it != mTiles.end()) {
+        it->lastUsed = ++mUseCounter;
+        // Snap the tile to device pixels and draw it unscaled. All tiles have
+        // the same sub-pixel offset, so neighbouring tiles are seamless.
+        QPoint devicePos =
+            (transform.map(tileRect.topLeft()) * mDevicePixelRatio).toPoint();
+        painter.save();
+        painter.resetTransform();
+        painter.drawImage(QPointF(devicePos) / mDevicePixelRatio, it->image);
+        painter.restore();
+      } else {
+        QRectF exposedRect = tileRect.intersected(rect);
+        painter.save();
+        painter.setClipRect(exposedRect);
+        GraphicsView::drawGrid(painter, exposedRect, mBackground, mGrid,
+                               mScale);
+        painter.restore();
+        startRendering(index);
+      }
+    }
+  }
+
+  // prefetch the tiles around the visible area
+  for (int x = range.left() - 1; x <= range.right() + 1; ++x) {
+    for (int y = range.top() - 1; y <= range.bottom() + 1; ++y) {
+      TileIndex index(x, y);
+      if (!mTiles.contains(index)) {
+        startRendering(index);
+      }
+    }
+  }
+
+  removeLeastRecentlyUsedTiles();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+qreal GraphicsViewTileCache::getTileSceneSize() const noexcept {
+  return sTileSize / (mScale * mDevicePixelRatio);
+}
+
+void GraphicsViewTileCache::startRendering(const TileIndex& index) noexcept {
+  if (mPendingTiles.contains(index)) {
+    return;
+  }
+  mPendingTiles.insert(index);
+
+  // copy all parameters since the job runs in another thread
+  QPoint         tile(index.first, index.second);
+  quint64        generation = mGeneration;
+  QRectF         sceneRect  = getTileSceneRect(tile);
+  qreal          scale      = mScale;
+  qreal          ratio      = mDevicePixelRatio;
+  QColor         background = mBackground;
+  GridProperties grid       = mGrid;
+
+  QFutureWatcher<QImage>* watcher = new QFutureWatcher<QImage>(this);
+  mWatchers.insert(watcher);
+  connect(watcher, &QFutureWatcher<QImage>::finished, this,
+          [this, watcher, generation, index]() {
+            tileRendered(generation, index, watcher->result());
+            mWatchers.remove(watcher);
+            watcher->deleteLater();
+          });
+  watcher->setFuture(
+      QtConcurrent::run([sceneRect, scale, ratio, background, grid]() {
+        return renderTile(sceneRect, scale, ratio, background, grid);
+      }));
+}
+
+void GraphicsViewTileCache::tileRendered(quint64          generation,
+                                         const TileIndex& index,
+                                         const QImage&    image) noexcept {
+  if (generation == mGeneration) {
+    mPendingTiles.remove(index);
+    mTiles.insert(index, Tile{image, ++mUseCounter});
+  }
+}
+
+void GraphicsViewTileCache::removeLeastRecentlyUsedTiles() noexcept {
+  if (mTiles.count() > sMaxTiles) {
+    QList<quint64> usage;
+    foreach (const Tile& tile, mTiles) { usage.append(tile.lastUsed); }
+    std::sort(usage.begin(), usage.end());
+    quint64 threshold = usage.at(mTiles.count() - sMaxTiles);
+    for (auto it = mTiles.begin(); it != mTiles.end();) {
+      if (it->lastUsed < threshold) {
+        it = mTiles.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+QImage GraphicsViewTileCache::renderTile(const QRectF& sceneRect, qreal scale,
+                                         qreal         devicePixelRatio,
+                                         const QColor& background,
+                                         const GridProperties& grid) noexcept {
+  // The painter works in logical pixels, so cosmetic pens get the same width
+  // as when painting the background directly.
+  QImage image(sTileSize, sTileSize, QImage::Format_ARGB32_Premultiplied);
+  image.setDevicePixelRatio(devicePixelRatio);
+  image.fill(background);
+  QPainter painter(&image);
+  painter.setRenderHints(QPainter::Antialiasing);
+  painter.scale(scale, scale);
+  painter.translate(-sceneRect.topLeft());
+  GraphicsView::drawGrid(painter, sceneRect, background, grid, scale);
+  return image;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
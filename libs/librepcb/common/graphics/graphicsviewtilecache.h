@@ -0,0 +1,170 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_GRAPHICSVIEWTILECACHE_H
+#define LIBREPCB_GRAPHICSVIEWTILECACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../gridproperties.h"
+
+#include <QtCore>
+#include <QtGui>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+/*******************************************************************************
+ *  Class GraphicsViewTileCache
+ ******************************************************************************/
+
+/**
+ * @brief The GraphicsViewTileCache class is an off-screen backing store for
+ *        the static background layer of a ::librepcb::GraphicsView
+ *
+ * The background (color and grid) is rendered into square image tiles of
+ * #sTileSize device pixels. Tiles are aligned to the scene origin, so they
+ * stay valid while scrolling and only need to be re-rendered when the zoom
+ * factor, the device pixel ratio, the grid or the background color changes.
+ * When drawn, tiles are snapped to device pixels and are never scaled, so
+ * they stay sharp and seamless also on high-DPI screens.
+ *
+ * Missing tiles are painted directly (so there is never a visible gap) and
+ * rendered into the cache on worker threads in parallel. The tiles around
+ * the visible area are prefetched as well, so panning mostly hits the cache.
+ * Only QImage and QPainter are used on the worker threads, which are
+ * thread-safe for this use case.
+ *
+ * Scene items are not cached since QGraphicsItem::paint() may only be called
+ * from the GUI thread. They are always painted live on top of the tiles.
+ * The cache is optional (see
+ * ::librepcb::GraphicsView::setBackgroundTileCacheEnabled()).
+ */
+class GraphicsViewTileCache final : public QObject {
+  Q_OBJECT
+
+public:
+  // Constructors / Destructor
+  GraphicsViewTileCache(const GraphicsViewTileCache& other) = delete;
+  explicit GraphicsViewTileCache(QObject* parent = nullptr) noexcept;
+  ~GraphicsViewTileCache() noexcept;
+
+  // Getters
+  int getTileCount() const noexcept { return mTiles.count(); }
+  int getPendingTileCount() const noexcept { return mPendingTiles.count(); }
+
+  // Setters
+
+  /**
+   * @brief Set the parameters used to render tiles
+   *
+   * If anything changed, all cached tiles are discarded.
+   *
+   * @param background        Background color
+   * @param grid              Grid properties
+   * @param scale             Scale factor from scene pixels to logical
+   *                          (device independent) pixels
+   * @param devicePixelRatio  Ratio between device pixels and logical pixels
+   */
+  void setParameters(const QColor& background, const GridProperties& grid,
+                     qreal scale, qreal devicePixelRatio) noexcept;
+
+  // General Methods
+
+  /**
+   * @brief Discard all cached tiles
+   */
+  void invalidate() noexcept;
+
+  /**
+   * @brief Get the indices of all tiles intersecting a scene rect
+   *
+   * Each tile covers the half-open scene rect returned by
+   * #getTileSceneRect(), so a rect ending exactly at a tile border does not
+   * touch the next tile.
+   *
+   * @param rect  The scene rect
+   *
+   * @return Inclusive range of tile indices (x = column, y = row)
+   */
+  QRect getTileRange(const QRectF& rect) const noexcept;
+
+  /**
+   * @brief Get the scene rect covered by a tile
+   *
+   * @param index   Column and row of the tile
+   *
+   * @return The scene rect of the tile
+   */
+  QRectF getTileSceneRect(const QPoint& index) const noexcept;
+
+  /**
+   * @brief Draw the background of a scene rect
+   *
+   * @param painter   Painter with the scene transformation of the view
+   * @param rect      The exposed scene rect
+   */
+  void draw(QPainter& painter, const QRectF& rect) noexcept;
+
+  // Operator Overloadings
+  GraphicsViewTileCache& operator=(const GraphicsViewTileCache& rhs) = delete;
+
+  // Static Variables
+  static constexpr int sTileSize = 256;  ///< Tile size in device pixels
+  static constexpr int sMaxTiles = 256;  ///< Max. count of cached tiles
+
+private:  // Types
+  typedef QPair<int, int> TileIndex;
+  struct Tile {
+    QImage  image;
+    quint64 lastUsed;
+  };
+
+private:  // Methods
+  qreal  getTileSceneSize() const noexcept;
+  void   startRendering(const TileIndex& index) noexcept;
+  void   tileRendered(quint64 generation, const TileIndex& index,
+                      const QImage& image) noexcept;
+  void   removeLeastRecentlyUsedTiles() noexcept;
+  static QImage renderTile(const QRectF& sceneRect, qreal scale,
+                           qreal devicePixelRatio, const QColor& background,
+                           const GridProperties& grid) noexcept;
+
+private:  // Data
+  QColor                        mBackground;
+  GridProperties                mGrid;
+  qreal                         mScale;
+  qreal                         mDevicePixelRatio;
+  quint64                       mGeneration;
+  quint64                       mUseCounter;
+  QHash<TileIndex, Tile>        mTiles;
+  QSet<TileIndex>               mPendingTiles;
+  QSet<QFutureWatcher<QImage>*> mWatchers;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace librepcb
+
+#endif  // LIBREPCB_GRAPHICSVIEWTILECACHE_H
@@ -26,6 +26,7 @@
 #include "../font/strokefontpool.h"
 #include "../graphics/graphicslayer.h"
 #include "../toolbox.h"
+#include "graphicslevelofdetail.h"
 #include "origincrossgraphicsitem.h"
 
 #include <QtCore>
@@ -75,6 +76,18 @@ QPainterPath StrokeTextGraphicsItem::shape() const noexcept {
   return PrimitivePathGraphicsItem::shape() + mOriginCrossGraphicsItem->shape();
 }
 
+void StrokeTextGraphicsItem::paint(QPainter*                       painter,
+                                   const QStyleOptionGraphicsItem* option,
+                                   QWidget* widget) noexcept {
+  // Skip texts which are too small to be readable anyway.
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  if (GraphicsLevelOfDetail::fromWidget(widget).isTextDetailed(
+          lod, mText.getHeight()->toPx())) {
+    PrimitivePathGraphicsItem::paint(painter, option, widget);
+  }
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
@@ -59,6 +59,8 @@ public:
 
   // Inherited from QGraphicsItem
   QPainterPath shape() const noexcept override;
+  void         paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+                     QWidget* widget = 0) noexcept override;
 
   // Operator Overloadings
   StrokeTextGraphicsItem& operator=(const StrokeTextGraphicsItem& rhs) = delete;
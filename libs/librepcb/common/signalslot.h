@@ -25,7 +25,11 @@
  ******************************************************************************/
 #include <QtCore>
 
+#include <algorithm>
 #include <functional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -35,6 +39,9 @@ namespace librepcb {
 template <typename Tsender, typename... Args>
 class Slot;
 
+template <typename Tsender, typename... Args>
+class SignalBatch;
+
 /*******************************************************************************
  *  Class Signal
  ******************************************************************************/
@@ -55,6 +62,19 @@ class Slot;
  *   - Always synchronous, no queued connections are possible
  *   - No endless loop detection
  *
+ * Since signals are emitted for every modification of geometry objects (also
+ * while loading files or during bulk edits), emitting them needs to be cheap.
+ * Therefore the slots are stored in a small array with preallocated space for
+ * a few slots (most signals have only one or two slots attached), and
+ * #notify() neither copies the array nor allocates memory. Slots attached
+ * from within a callback are not called by the currently running
+ * notification. Slots detached from within a callback are only marked as
+ * detached (and not called anymore), and are removed from the array after
+ * the outermost notification returned.
+ *
+ * To coalesce many equal notifications (e.g. during bulk edits), use a
+ * ::librepcb::SignalBatch.
+ *
  * @see ::librepcb::Slot
  *
  * @tparam Tsender  Type of the sender object
@@ -64,6 +84,7 @@ class Slot;
 template <typename Tsender, typename... Args>
 class Signal {
   friend class Slot<Tsender, Args...>;
+  friend class SignalBatch<Tsender, Args...>;
 
 public:
   // Constructors / Destructor
@@ -75,7 +96,12 @@ public:
    *
    * @param sender  Reference to the sender object of the signal
    */
-  explicit Signal(const Tsender& sender) noexcept : mSender(sender) {}
+  explicit Signal(const Tsender& sender) noexcept
+    : mSender(sender),
+      mSlots(),
+      mDetachedSlots(0),
+      mNotifyDepth(0),
+      mBatch(nullptr) {}
 
   /**
    * @brief Destructor
@@ -84,7 +110,9 @@ public:
    */
   ~Signal() noexcept {
     for (auto slot : mSlots) {
-      slot->mSignals.remove(this);
+      if (slot) {
+        slot->removeSignal(this);
+      }
     }
   }
 
@@ -93,16 +121,20 @@ public:
    *
    * @return Count of registered slots
    */
-  int getSlotCount() const noexcept { return mSlots.count(); }
+  int getSlotCount() const noexcept { return mSlots.count() - mDetachedSlots; }
 
   /**
    * @brief Attach a slot
    *
+   * Attaching an already attached slot has no effect.
+   *
    * @param slot  Reference to the slot to attach
    */
   void attach(Slot<Tsender, Args...>& slot) const noexcept {
-    slot.mSignals.insert(this);
-    mSlots.insert(&slot);
+    if (std::find(mSlots.begin(), mSlots.end(), &slot) == mSlots.end()) {
+      mSlots.append(&slot);
+      slot.addSignal(this);
+    }
   }
 
   /**
@@ -111,37 +143,76 @@ public:
    * @param slot  Reference to the slot to detach
    */
   void detach(Slot<Tsender, Args...>& slot) const noexcept {
-    slot.mSignals.remove(this);
-    mSlots.remove(&slot);
+    slot.removeSignal(this);
+    removeSlot(&slot);
   }
 
   /**
    * @brief Notify all attached slots
    *
+   * If a ::librepcb::SignalBatch is active for this signal, the notification
+   * is deferred until the batch ends.
+   *
    * @param args  Arguments passed to the slots
    */
   void notify(Args... args) noexcept {
-    // Note: A "foreach" loop with a Qt container first creates an implicitly
-    // shared copy of the container (see
-    // https://doc.qt.io/qt-5/containers.html#foreach). This is very important
-    // since the callback might modify the container while iterating over it!
-    // With std containers this would be much more complicated (or less
-    // efficient).
-    foreach (const auto& slot, mSlots) {
-      // Check existence of the slot again because we must not call it if it
-      // was detached (i.e. removed from the container) in the meantime.
-      if (mSlots.contains(slot)) {
-        slot->mCallback(mSender, args...);
-      }
+    if (mBatch) {
+      mBatch->record(args...);
+    } else {
+      dispatch(args...);
     }
   }
 
   // Operator Overloadings
   Signal& operator=(Signal const& other) = delete;
 
-private:
+private:  // Methods
+  void dispatch(Args... args) noexcept {
+    // Note: Iterate by index since the callbacks might modify the array (e.g.
+    // attaching slots reallocates it). Slots appended during the loop are not
+    // called, detached slots are replaced by nullptr until the loop is done.
+    const int count = mSlots.count();
+    ++mNotifyDepth;
+    for (int i = 0; i < count; ++i) {
+      if (Slot<Tsender, Args...>* slot = mSlots.at(i)) {
+        slot->mCallback(mSender, args...);
+      }
+    }
+    if ((--mNotifyDepth == 0) && (mDetachedSlots > 0)) {
+      mSlots.erase(
+          std::remove(mSlots.begin(), mSlots.end(),
+                      static_cast<Slot<Tsender, Args...>*>(nullptr)),
+          mSlots.end());
+      mDetachedSlots = 0;
+    }
+  }
+
+  void removeSlot(Slot<Tsender, Args...>* slot) const noexcept {
+    auto it = std::find(mSlots.begin(), mSlots.end(), slot);
+    if (it == mSlots.end()) {
+      return;
+    } else if (mNotifyDepth > 0) {
+      *it = nullptr;  // removed when the notification is done
+      ++mDetachedSlots;
+    } else {
+      mSlots.erase(it);
+    }
+  }
+
+private:  // Data
   const Tsender& mSender;  ///< Reference to the sender object
-  mutable QSet<Slot<Tsender, Args...>*> mSlots;  ///< All attached slots
+
+  /// All attached slots (nullptr for slots detached during a notification)
+  mutable QVarLengthArray<Slot<Tsender, Args...>*, 4> mSlots;
+
+  /// Count of nullptr entries in #mSlots
+  mutable int mDetachedSlots;
+
+  /// Count of currently running notifications (recursion depth)
+  int mNotifyDepth;
+
+  /// The outermost active batch (nullptr if there is none)
+  SignalBatch<Tsender, Args...>* mBatch;
 };
 
 /*******************************************************************************
@@ -219,7 +290,7 @@ public:
    */
   void detachAll() noexcept {
     for (auto signal : mSignals) {
-      signal->mSlots.remove(this);
+      signal->removeSlot(this);
     }
     mSignals.clear();
   }
@@ -227,14 +298,117 @@ public:
   // Operator Overloadings
   Slot& operator=(Slot const& other) = delete;
 
-private:
+private:  // Methods
+  void addSignal(const Signal<Tsender, Args...>* signal) noexcept {
+    mSignals.append(signal);
+  }
+  void removeSignal(const Signal<Tsender, Args...>* signal) noexcept {
+    auto it = std::find(mSignals.begin(), mSignals.end(), signal);
+    if (it != mSignals.end()) {
+      mSignals.erase(it);
+    }
+  }
+
+private:  // Data
   /// All signals this slot is attached to
-  QSet<const Signal<Tsender, Args...>*> mSignals;
+  QVarLengthArray<const Signal<Tsender, Args...>*, 1> mSignals;
 
   /// The registered callback function
   std::function<void(const Tsender&, Args...)> mCallback;
 };
 
+/*******************************************************************************
+ *  Class SignalBatch
+ ******************************************************************************/
+
+/**
+ * @brief The SignalBatch class coalesces notifications of a
+ *        ::librepcb::Signal during bulk operations
+ *
+ * As long as a SignalBatch object exists for a signal, ::librepcb::Signal::
+ * notify() does not call the slots, but only records the notification. Equal
+ * notifications (i.e. with equal arguments) are recorded only once. When the
+ * batch object is destroyed, all recorded notifications are emitted in the
+ * order of their first occurrence. This avoids that slots are called many
+ * times with the same arguments during bulk edits, for example:
+ *
+ * @code
+ * Footprint& Footprint::operator=(const Footprint& rhs) noexcept {
+ *   SignalBatch<Footprint, Event> batch(onEdited);  // emit every event once
+ *   mPads = rhs.mPads;  // emits Event::PadsEdited for every pad
+ *   ...
+ * }
+ * @endcode
+ *
+ * Batches can be nested, only the outermost batch emits the recorded
+ * notifications. Note that slots see the final state of the sender when the
+ * notifications are emitted, not the intermediate states.
+ *
+ * @warning The batch must not outlive the signal.
+ *
+ * @tparam Tsender  Type of the sender object
+ * @tparam Args     Arguments of the signal. They must be copyable and
+ *                  comparable with `operator==`.
+ */
+template <typename Tsender, typename... Args>
+class SignalBatch final {
+  friend class Signal<Tsender, Args...>;
+
+public:
+  // Constructors / Destructor
+  SignalBatch()                         = delete;
+  SignalBatch(const SignalBatch& other) = delete;
+
+  /**
+   * @brief Constructor
+   *
+   * @param signal  The signal whose notifications shall be coalesced
+   */
+  explicit SignalBatch(Signal<Tsender, Args...>& signal) noexcept
+    : mSignal(signal), mIsOutermost(!signal.mBatch) {
+    if (mIsOutermost) {
+      mSignal.mBatch = this;
+    }
+  }
+
+  /**
+   * @brief Destructor
+   *
+   * Emits all recorded notifications (if this is the outermost batch).
+   */
+  ~SignalBatch() noexcept {
+    if (mIsOutermost) {
+      mSignal.mBatch = nullptr;  // notifications from slots are not deferred
+      for (const auto& notification : mNotifications) {
+        notification();
+      }
+    }
+  }
+
+  // Operator Overloadings
+  SignalBatch& operator=(const SignalBatch& rhs) = delete;
+
+private:  // Methods
+  void record(Args... args) noexcept {
+    std::tuple<typename std::decay<Args>::type...> key(args...);
+    if (std::find(mKeys.begin(), mKeys.end(), key) == mKeys.end()) {
+      mKeys.push_back(key);
+      mNotifications.push_back(std::bind(&Signal<Tsender, Args...>::dispatch,
+                                         &mSignal, args...));
+    }
+  }
+
+private:  // Data
+  Signal<Tsender, Args...>& mSignal;
+  bool                      mIsOutermost;
+
+  /// Arguments of all recorded notifications (to detect duplicates)
+  std::vector<std::tuple<typename std::decay<Args>::type...>> mKeys;
+
+  /// All recorded notifications, in the order of their first occurrence
+  std::vector<std::function<void()>> mNotifications;
+};
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -41,6 +41,19 @@ UndoCommand::~UndoCommand() noexcept {
   Q_ASSERT(qAbs(mRedoCount - mUndoCount) <= 1);
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 UndoCommand::getApproxMemoryUsage() const noexcept {
+  return sizeof(UndoCommand) + mText.capacity() * sizeof(QChar);
+}
+
+bool UndoCommand::canMergeWith(const UndoCommand& other) const noexcept {
+  Q_UNUSED(other);
+  return false;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -75,6 +88,24 @@ void UndoCommand::redo() {
   mRedoCount++;
 }
 
+void UndoCommand::mergeWith(const UndoCommand& other) {
+  if ((!isCurrentlyExecuted()) || (!other.isCurrentlyExecuted()) ||
+      (!canMergeWith(other))) {
+    throw LogicError(__FILE__, __LINE__);
+  }
+
+  performMerge(other);  // can throw
+}
+
+/*******************************************************************************
+ *  Protected Methods
+ ******************************************************************************/
+
+void UndoCommand::performMerge(const UndoCommand& other) {
+  Q_UNUSED(other);
+  throw LogicError(__FILE__, __LINE__);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
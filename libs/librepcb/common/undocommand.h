@@ -75,6 +75,27 @@ public:
    */
   bool isCurrentlyExecuted() const noexcept { return mRedoCount > mUndoCount; }
 
+  /**
+   * @brief Get the approximate amount of memory used by this command
+   *
+   * This is used by librepcb::UndoStack to limit the memory of the undo
+   * history. Commands which keep large objects alive (e.g. removed items)
+   * should override this method. The returned value must not change while
+   * the command is on the undo stack, except by #mergeWith().
+   *
+   * @return Approximate memory usage in bytes
+   */
+  virtual qint64 getApproxMemoryUsage() const noexcept;
+
+  /**
+   * @brief Check whether a command can be merged into this command
+   *
+   * @param other   A command which was executed right after this command.
+   *
+   * @return True if #mergeWith() is possible (default: false)
+   */
+  virtual bool canMergeWith(const UndoCommand& other) const noexcept;
+
   // General Methods
 
   /**
@@ -96,6 +117,17 @@ public:
    */
   virtual void redo() final;
 
+  /**
+   * @brief Merge a command into this command
+   *
+   * Afterwards, this command contains the changes of both commands, i.e.
+   * #undo() reverts both of them and @p other can be deleted.
+   *
+   * @param other   A command for which #canMergeWith() returned true. Both
+   *                commands must be currently executed.
+   */
+  void mergeWith(const UndoCommand& other);
+
   // Operator Overloadings
   UndoCommand& operator=(const UndoCommand& rhs) = delete;
 
@@ -127,6 +159,16 @@ protected:
    */
   virtual void performRedo() = 0;
 
+  /**
+   * @brief Merge a command into this command
+   *
+   * @note This method must be implemented in all derived classes which
+   *       override #canMergeWith().
+   *
+   * @param other   The command to merge (#canMergeWith() returned true).
+   */
+  virtual void performMerge(const UndoCommand& other);
+
 private:
   QString mText;
   bool    mIsExecuted;  ///< @brief Shows whether #execute() was called or not
@@ -26,6 +26,8 @@
 
 #include <QtCore>
 
+#include <typeinfo>
+
 /*******************************************************************************
  *  Namespace
  ******************************************************************************/
@@ -46,6 +48,33 @@ UndoCommandGroup::~UndoCommandGroup() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 UndoCommandGroup::getApproxMemoryUsage() const noexcept {
+  qint64 usage = UndoCommand::getApproxMemoryUsage();
+  foreach (const UndoCommand* cmd, mChilds) {
+    usage += cmd->getApproxMemoryUsage();
+  }
+  return usage;
+}
+
+bool UndoCommandGroup::canMergeWith(const UndoCommand& other) const noexcept {
+  const UndoCommandGroup* group = dynamic_cast<const UndoCommandGroup*>(&other);
+  if ((!group) || (typeid(*this) != typeid(other)) ||
+      (getText() != other.getText()) ||
+      (mChilds.count() != group->mChilds.count())) {
+    return false;
+  }
+  for (int i = 0; i < mChilds.count(); ++i) {
+    if (!mChilds.at(i)->canMergeWith(*group->mChilds.at(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -111,6 +140,13 @@ void UndoCommandGroup::performRedo() {
   sgl.dismiss();
 }
 
+void UndoCommandGroup::performMerge(const UndoCommand& other) {
+  const UndoCommandGroup& group = dynamic_cast<const UndoCommandGroup&>(other);
+  for (int i = 0; i < mChilds.count(); ++i) {
+    mChilds.at(i)->mergeWith(*group.mChilds.at(i));  // can throw
+  }
+}
+
 /*******************************************************************************
  *  Protected Methods
  ******************************************************************************/
@@ -53,6 +53,21 @@ public:
   // Getters
   int getChildCount() const noexcept { return mChilds.count(); }
 
+  /// @copydoc UndoCommand::getApproxMemoryUsage()
+  virtual qint64 getApproxMemoryUsage() const noexcept override;
+
+  /**
+   * @brief Check whether a command group can be merged into this group
+   *
+   * This is the case if @p other is of the same type, has the same text and
+   * all child commands can be merged pairwise.
+   *
+   * @param other   A command which was executed right after this command.
+   *
+   * @return True if #mergeWith() is possible
+   */
+  virtual bool canMergeWith(const UndoCommand& other) const noexcept override;
+
   // General Methods
 
   /**
@@ -85,6 +100,9 @@ protected:
   /// @copydoc UndoCommand::performRedo()
   virtual void performRedo() override;
 
+  /// @copydoc UndoCommand::performMerge()
+  virtual void performMerge(const UndoCommand& other) override;
+
   /**
    * @brief Helper method for derived classes to execute and add new child
    * commands
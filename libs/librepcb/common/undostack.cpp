@@ -33,6 +33,9 @@
  ******************************************************************************/
 namespace librepcb {
 
+constexpr qint64 UndoStack::sDefaultMaxMemoryUsage;
+constexpr int    UndoStack::sDefaultMergeInterval;
+
 /*******************************************************************************
  *  Class UndoStackTransaction
  ******************************************************************************/
@@ -77,7 +80,12 @@ UndoStack::UndoStack() noexcept
   : QObject(nullptr),
     mCurrentIndex(0),
     mCleanIndex(0),
-    mActiveCommandGroup(nullptr) {
+    mActiveCommandGroup(nullptr),
+    mMemoryUsage(0),
+    mMaxCommandCount(0),
+    mMaxMemoryUsage(sDefaultMaxMemoryUsage),
+    mMergeInterval(sDefaultMergeInterval),
+    mLastCommandTimer() {
 }
 
 UndoStack::~UndoStack() noexcept {
@@ -126,10 +134,25 @@ void UndoStack::setClean() noexcept {
   if (isClean()) return;
 
   mCleanIndex = mCurrentIndex;
+  mLastCommandTimer.invalidate();
 
   emit cleanChanged(true);
 }
 
+void UndoStack::setMaxCommandCount(int count) noexcept {
+  mMaxCommandCount = qMax(count, 0);
+  dropOldestCmds();
+}
+
+void UndoStack::setMaxMemoryUsage(qint64 bytes) noexcept {
+  mMaxMemoryUsage = qMax(bytes, qint64(0));
+  dropOldestCmds();
+}
+
+void UndoStack::setMergeInterval(int ms) noexcept {
+  mMergeInterval = ms;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -158,14 +181,33 @@ bool UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd) {
     // impossible)
     // --> in reverse order (from top to bottom)!
     while (mCurrentIndex < mCommands.count()) {
-      delete mCommands.takeLast();
+      UndoCommand* redoCmd = mCommands.takeLast();
+      mMemoryUsage -= redoCmd->getApproxMemoryUsage();
+      delete redoCmd;
     }
     Q_ASSERT(mCurrentIndex == mCommands.count());
 
+    // merge the command into the last command if possible (it will be deleted
+    // by the scope guard)
+    if ((!forceKeepCmd) && mergeWithLastCmd(*cmd)) {
+      emit redoTextChanged(tr("Redo"));
+      emit canRedoChanged(false);
+      emit stateModified();
+      return commandHasDoneSomething;
+    }
+
     // add command to the command stack
     mCommands.append(
         cmdScopeGuard.take());  // move ownership of "cmd" to "mCommands"
     mCurrentIndex++;
+    if (forceKeepCmd) {
+      // the active command group is added to the memory usage when committed
+      mLastCommandTimer.invalidate();
+    } else {
+      mMemoryUsage += cmd->getApproxMemoryUsage();
+      mLastCommandTimer.start();
+      dropOldestCmds();
+    }
 
     // emit signals
     emit undoTextChanged(QString(tr("Undo: %1")).arg(cmd->getText()));
@@ -234,7 +276,9 @@ bool UndoStack::commitCmdGroup() {
 
   // To finish the active command group, we only need to reset the pointer to
   // the currently active command group
+  mMemoryUsage += mActiveCommandGroup->getApproxMemoryUsage();
   mActiveCommandGroup = nullptr;
+  dropOldestCmds();
 
   // emit signals
   emit canUndoChanged(canUndo());
@@ -279,6 +323,7 @@ void UndoStack::undo() {
   try {
     mCommands[mCurrentIndex - 1]->undo();  // can throw (but should usually not)
     mCurrentIndex--;
+    mLastCommandTimer.invalidate();
   } catch (Exception& e) {
     qCritical() << "UndoCommand::undo() has thrown an exception:" << e.getMsg();
     throw;
@@ -301,6 +346,7 @@ void UndoStack::redo() {
   try {
     mCommands[mCurrentIndex]->redo();  // can throw (but should usually not)
     mCurrentIndex++;
+    mLastCommandTimer.invalidate();
   } catch (Exception& e) {
     qCritical() << "UndoCommand::redo() has thrown an exception:" << e.getMsg();
     throw;
@@ -337,6 +383,8 @@ void UndoStack::clear() noexcept {
   mCurrentIndex       = 0;
   mCleanIndex         = 0;
   mActiveCommandGroup = nullptr;
+  mMemoryUsage        = 0;
+  mLastCommandTimer.invalidate();
 
   // emit signals
   emit undoTextChanged(tr("Undo"));
@@ -346,6 +394,51 @@ void UndoStack::clear() noexcept {
   emit cleanChanged(true);
 }
 
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+bool UndoStack::mergeWithLastCmd(const UndoCommand& cmd) noexcept {
+  // Only merge into the command on top of the stack, and only if it was
+  // pushed recently. Never merge into the clean state since it would get
+  // lost.
+  if ((mMergeInterval < 0) || (!mLastCommandTimer.isValid()) ||
+      (mLastCommandTimer.elapsed() > mMergeInterval) ||
+      (isCommandGroupActive()) || (mCurrentIndex == 0) ||
+      (mCurrentIndex != mCommands.count()) || (mCleanIndex == mCurrentIndex)) {
+    return false;
+  }
+  UndoCommand* lastCmd = mCommands.last();
+  if (!lastCmd->canMergeWith(cmd)) {
+    return false;
+  }
+
+  try {
+    mMemoryUsage -= lastCmd->getApproxMemoryUsage();
+    lastCmd->mergeWith(cmd);  // can throw (but should not)
+    mMemoryUsage += lastCmd->getApproxMemoryUsage();
+    mLastCommandTimer.start();
+    return true;
+  } catch (const Exception& e) {
+    qCritical() << "Failed to merge undo commands:" << e.getMsg();
+    mMemoryUsage += lastCmd->getApproxMemoryUsage();
+    return false;
+  }
+}
+
+void UndoStack::dropOldestCmds() noexcept {
+  // the command on top of the undo history is always kept
+  while ((mCurrentIndex > 1) &&
+         (((mMaxCommandCount > 0) && (mCommands.count() > mMaxCommandCount)) ||
+          ((mMaxMemoryUsage > 0) && (mMemoryUsage > mMaxMemoryUsage)))) {
+    UndoCommand* cmd = mCommands.takeFirst();
+    mMemoryUsage -= cmd->getApproxMemoryUsage();
+    delete cmd;
+    mCurrentIndex--;
+    mCleanIndex = (mCleanIndex > 0) ? (mCleanIndex - 1) : -1;
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
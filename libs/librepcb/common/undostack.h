@@ -101,6 +101,14 @@ private:
  *    QUndoStack#endMacro())</b>: I think we do need this feature (but we have a
  * similar mechanism, see next line)...
  *  - <b>Added support for exclusive macro command creation:</b>
+ *  - <b>Bounded history:</b> The oldest commands are dropped if the stack
+ *    contains more than #getMaxCommandCount() commands or if the commands use
+ *    more than #getMaxMemoryUsage() bytes (see
+ *    ::librepcb::UndoCommand::getApproxMemoryUsage()).
+ *  - <b>Merging:</b> A command executed within #getMergeInterval()
+ *    milliseconds after the previous one is merged into it if possible (see
+ *    ::librepcb::UndoCommand::canMergeWith()), e.g. to get only one undo step
+ *    for several small moves of the same items.
  *
  * @see ::librepcb::UndoCommand, ::librepcb::UndoCommandGroup
  */
@@ -167,6 +175,40 @@ public:
    */
   bool isCommandGroupActive() const noexcept;
 
+  /**
+   * @brief Get the number of commands on the stack (undo and redo)
+   */
+  int getCommandCount() const noexcept { return mCommands.count(); }
+
+  /**
+   * @brief Get the approximate memory used by all commands on the stack
+   *
+   * @return Sum of UndoCommand#getApproxMemoryUsage() in bytes (without the
+   *         currently active command group)
+   */
+  qint64 getMemoryUsage() const noexcept { return mMemoryUsage; }
+
+  /**
+   * @brief Get the maximum number of commands on the stack
+   *
+   * @return Max. number of commands (0 means unlimited)
+   */
+  int getMaxCommandCount() const noexcept { return mMaxCommandCount; }
+
+  /**
+   * @brief Get the maximum memory usage of all commands on the stack
+   *
+   * @return Max. memory usage in bytes (0 means unlimited)
+   */
+  qint64 getMaxMemoryUsage() const noexcept { return mMaxMemoryUsage; }
+
+  /**
+   * @brief Get the time interval for merging subsequent commands
+   *
+   * @return Interval in milliseconds (negative means merging is disabled)
+   */
+  int getMergeInterval() const noexcept { return mMergeInterval; }
+
   // Setters
 
   /**
@@ -174,6 +216,27 @@ public:
    */
   void setClean() noexcept;
 
+  /**
+   * @brief Set the maximum number of commands on the stack
+   *
+   * @param count   Max. number of commands (0 means unlimited)
+   */
+  void setMaxCommandCount(int count) noexcept;
+
+  /**
+   * @brief Set the maximum memory usage of all commands on the stack
+   *
+   * @param bytes   Max. memory usage in bytes (0 means unlimited)
+   */
+  void setMaxMemoryUsage(qint64 bytes) noexcept;
+
+  /**
+   * @brief Set the time interval for merging subsequent commands
+   *
+   * @param ms      Interval in milliseconds (negative disables merging)
+   */
+  void setMergeInterval(int ms) noexcept;
+
   // General Methods
 
   /**
@@ -280,6 +343,10 @@ public:
    */
   void clear() noexcept;
 
+  // Static Variables
+  static constexpr qint64 sDefaultMaxMemoryUsage = 256 * 1024 * 1024;
+  static constexpr int    sDefaultMergeInterval  = 500;
+
 signals:
   void undoTextChanged(const QString& text);
   void redoTextChanged(const QString& text);
@@ -290,7 +357,11 @@ signals:
   void commandGroupAborted();
   void stateModified();
 
-private:
+private:  // Methods
+  bool mergeWithLastCmd(const UndoCommand& cmd) noexcept;
+  void dropOldestCmds() noexcept;
+
+private:  // Data
   /**
    * @brief This list holds all commands of the undo stack
    *
@@ -324,6 +395,23 @@ private:
    * nullptr.
    */
   UndoCommandGroup* mActiveCommandGroup;
+
+  /**
+   * @brief Sum of the memory usage of all commands in #mCommands, except
+   * #mActiveCommandGroup
+   */
+  qint64 mMemoryUsage;
+
+  int    mMaxCommandCount;  ///< See #getMaxCommandCount()
+  qint64 mMaxMemoryUsage;   ///< See #getMaxMemoryUsage()
+  int    mMergeInterval;    ///< See #getMergeInterval()
+
+  /**
+   * @brief Time since the last command was pushed or merged
+   *
+   * Invalid if the last command must not be merged anymore (e.g. after undo).
+   */
+  QElapsedTimer mLastCommandTimer;
 };
 
 /*******************************************************************************
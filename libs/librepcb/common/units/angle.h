@@ -91,7 +91,7 @@ public:
    *
    * @param angle         Another Angle object
    */
-  Angle(const Angle& angle) noexcept : mMicrodegrees(angle.mMicrodegrees) {}
+  Angle(const Angle& angle) noexcept = default;
 
   /**
    * @brief Constructor with an angle in microdegrees
@@ -104,7 +104,7 @@ public:
   /**
    * @brief Destructor
    */
-  ~Angle() noexcept {}
+  ~Angle() noexcept = default;
 
   // Setters
 
@@ -307,10 +307,7 @@ public:
   static Angle deg315() noexcept { return Angle(315000000); }  ///< 315 degrees
 
   // Operators
-  Angle& operator=(const Angle& rhs) {
-    mMicrodegrees = rhs.mMicrodegrees;
-    return *this;
-  }
+  Angle& operator=(const Angle& rhs) = default;
   Angle& operator+=(const Angle& rhs) {
     mMicrodegrees = (mMicrodegrees + rhs.mMicrodegrees) % 360000000;
     return *this;
@@ -421,5 +418,6 @@ inline uint qHash(const Angle& key, uint seed = 0) noexcept {
 }  // namespace librepcb
 
 Q_DECLARE_METATYPE(librepcb::Angle)
+Q_DECLARE_TYPEINFO(librepcb::Angle, Q_PRIMITIVE_TYPE);
 
 #endif  // LIBREPCB_ANGLE_H
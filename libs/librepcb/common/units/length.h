@@ -97,8 +97,7 @@ public:
    *
    * @param length        Another Length object
    */
-  constexpr Length(const Length& length) noexcept
-    : mNanometers(length.mNanometers) {}
+  constexpr Length(const Length& length) noexcept = default;
 
   /**
    * @brief Constructor with length in nanometers
@@ -473,10 +472,7 @@ public:
   static Length max() noexcept;
 
   // Operators
-  Length& operator=(const Length& rhs) {
-    mNanometers = rhs.mNanometers;
-    return *this;
-  }
+  Length& operator=(const Length& rhs) = default;
   Length& operator+=(const Length& rhs) {
     mNanometers += rhs.mNanometers;
     return *this;
@@ -968,5 +964,6 @@ inline uint qHash(const PositiveLength& key, uint seed = 0) noexcept {
 }  // namespace librepcb
 
 Q_DECLARE_METATYPE(librepcb::Length)
+Q_DECLARE_TYPEINFO(librepcb::Length, Q_PRIMITIVE_TYPE);
 
 #endif  // LIBREPCB_LENGTH_H
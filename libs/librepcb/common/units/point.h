@@ -23,7 +23,7 @@
 /*******************************************************************************
  *  Includes
  ******************************************************************************/
-#include "../fileio/serializableobject.h"
+#include "../fileio/sexpression.h"
 #include "length.h"
 
 #include <QtCore>
@@ -73,9 +73,16 @@ class Angle;
  * pixels is also wrong! You should use Point.toPxQPointF().y() instead for this
  * purpose.
  *
+ * @note Point is a trivially copyable value type without virtual methods (i.e.
+ * no vtable pointer), so it only consists of the two coordinates. This keeps
+ * large containers of points and vertices (e.g. plane fragments) compact and
+ * allows Qt containers to copy them with memcpy(). Therefore it's not derived
+ * from ::librepcb::SerializableObject, but provides the same (non-virtual)
+ * serialization methods.
+ *
  * @see class Length
  */
-class Point final : public SerializableObject {
+class Point final {
 public:
   // Constructors / Destructor
 
@@ -91,7 +98,7 @@ public:
    *
    * @param point     Another Point object
    */
-  Point(const Point& point) noexcept : mX(point.mX), mY(point.mY) {}
+  Point(const Point& point) noexcept = default;
 
   /**
    * @brief Constructor for passing two Length objects
@@ -106,7 +113,7 @@ public:
   /**
    * @brief Destructor
    */
-  ~Point() noexcept {}
+  ~Point() noexcept = default;
 
   // Setters
 
@@ -384,8 +391,15 @@ public:
   Point& mirror(Qt::Orientation orientation,
                 const Point&    center = Point(0, 0)) noexcept;
 
+  /// @copydoc librepcb::SerializableObject::serializeToDomElement()
+  SExpression serializeToDomElement(const QString& name) const {
+    SExpression root = SExpression::createList(name);
+    serialize(root);
+    return root;
+  }
+
   /// @copydoc librepcb::SerializableObject::serialize()
-  void serialize(SExpression& root) const override;
+  void serialize(SExpression& root) const;
 
   // Static Functions
 
@@ -409,11 +423,7 @@ public:
   static Point fromPx(const QPointF& pixels);
 
   // Operators
-  Point& operator=(const Point& rhs) {
-    mX = rhs.mX;
-    mY = rhs.mY;
-    return *this;
-  }
+  Point& operator=(const Point& rhs) = default;
   Point& operator+=(const Point& rhs) {
     mX += rhs.mX;
     mY += rhs.mY;
@@ -508,6 +518,11 @@ inline uint qHash(const Point& key, uint seed = 0) noexcept {
   return ::qHash(qMakePair(key.getX(), key.getY()), seed);
 }
 
+// Make sure that the Point class does not contain anything else than the
+// coordinates (e.g. no vptr), see class documentation.
+static_assert(sizeof(Point) == 2 * sizeof(Length),
+              "Point must only contain the coordinates!");
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -515,5 +530,6 @@ inline uint qHash(const Point& key, uint seed = 0) noexcept {
 }  // namespace librepcb
 
 Q_DECLARE_METATYPE(librepcb::Point)
+Q_DECLARE_TYPEINFO(librepcb::Point, Q_PRIMITIVE_TYPE);
 
 #endif  // LIBREPCB_POINT_H
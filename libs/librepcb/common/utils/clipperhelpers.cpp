@@ -153,6 +153,7 @@ QVector<Path> ClipperHelpers::convert(const ClipperLib::Paths& paths) noexcept {
 
 Path ClipperHelpers::convert(const ClipperLib::Path& path) noexcept {
   Path p;
+  p.getVertices().reserve(static_cast<int>(path.size()) + 1);  // incl. close()
   for (const ClipperLib::IntPoint& point : path) {
     p.addVertex(convert(point));
   }
@@ -178,6 +179,7 @@ ClipperLib::Paths ClipperHelpers::convert(
 ClipperLib::Path ClipperHelpers::convert(
     const Path& path, const PositiveLength& maxArcTolerance) noexcept {
   ClipperLib::Path p;
+  p.reserve(path.getVertices().count());  // more points needed for arcs
   for (int i = 0; i < path.getVertices().count(); ++i) {
     const Vertex& v  = path.getVertices().at(i);
     const Vertex& v0 = path.getVertices().at(qMax(i - 1, 0));
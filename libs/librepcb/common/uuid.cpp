@@ -22,7 +22,6 @@
  ******************************************************************************/
 #include "uuid.h"
 
-#include <QRegularExpressionValidator>
 #include <QtCore>
 
 /*******************************************************************************
@@ -31,81 +30,52 @@
 namespace librepcb {
 
 /*******************************************************************************
- *  Static Methods
+ *  Getters
  ******************************************************************************/
 
-bool Uuid::isValid(const QString& str) noexcept {
-  // Note: This used to be done using a RegEx, but when profiling and
-  // optimizing the library rescan code we found that a manually unrolled
-  // comparison loop performs much better than the previous RegEx.
-  // See https://github.com/LibrePCB/LibrePCB/pull/651 for more details.
-  if (str.length() != 36) return false;
-
-  // Helper function
-  auto isLowerHex = [](const QChar& chr) {
-    return (chr >= QChar('0') && chr <= QChar('9')) ||
-           (chr >= QChar('a') && chr <= QChar('f'));
-  };
-
-  if (!isLowerHex(str[0])) return false;
-  if (!isLowerHex(str[1])) return false;
-  if (!isLowerHex(str[2])) return false;
-  if (!isLowerHex(str[3])) return false;
-  if (!isLowerHex(str[4])) return false;
-  if (!isLowerHex(str[5])) return false;
-  if (!isLowerHex(str[6])) return false;
-  if (!isLowerHex(str[7])) return false;
-  if (str[8] != QChar('-')) return false;
-  if (!isLowerHex(str[9])) return false;
-  if (!isLowerHex(str[10])) return false;
-  if (!isLowerHex(str[11])) return false;
-  if (!isLowerHex(str[12])) return false;
-  if (str[13] != QChar('-')) return false;
-  if (!isLowerHex(str[14])) return false;
-  if (!isLowerHex(str[15])) return false;
-  if (!isLowerHex(str[16])) return false;
-  if (!isLowerHex(str[17])) return false;
-  if (str[18] != QChar('-')) return false;
-  if (!isLowerHex(str[19])) return false;
-  if (!isLowerHex(str[20])) return false;
-  if (!isLowerHex(str[21])) return false;
-  if (!isLowerHex(str[22])) return false;
-  if (str[23] != QChar('-')) return false;
-  if (!isLowerHex(str[24])) return false;
-  if (!isLowerHex(str[25])) return false;
-  if (!isLowerHex(str[26])) return false;
-  if (!isLowerHex(str[27])) return false;
-  if (!isLowerHex(str[28])) return false;
-  if (!isLowerHex(str[29])) return false;
-  if (!isLowerHex(str[30])) return false;
-  if (!isLowerHex(str[31])) return false;
-  if (!isLowerHex(str[32])) return false;
-  if (!isLowerHex(str[33])) return false;
-  if (!isLowerHex(str[34])) return false;
-  if (!isLowerHex(str[35])) return false;
+QString Uuid::toStr() const noexcept {
+  static const char hexDigits[] = "0123456789abcdef";
+  QString           str(36, Qt::Uninitialized);
+  QChar*            out = str.data();
+  for (int i = 0; i < 32; ++i) {
+    if ((i == 8) || (i == 12) || (i == 16) || (i == 20)) {
+      *out++ = QLatin1Char('-');
+    }
+    quint64 value = (i < 16) ? mHigh : mLow;
+    int     shift = 60 - ((i % 16) * 4);
+    *out++        = QLatin1Char(hexDigits[(value >> shift) & 0xF]);
+  }
+  return str;
+}
 
-  // check type of uuid
-  QUuid quuid(str);
-  if (quuid.isNull()) return false;
-  if (quuid.variant() != QUuid::DCE) return false;
-  if (quuid.version() != QUuid::Random) return false;
+/*******************************************************************************
+ *  Static Methods
+ ******************************************************************************/
 
-  return true;
+bool Uuid::isValid(const QString& str) noexcept {
+  return tryFromString(str).has_value();
 }
 
 Uuid Uuid::createRandom() noexcept {
-  QString str =
-      QUuid::createUuid().toString().remove("{").remove("}").toLower();
-  if (isValid(str)) {
-    return Uuid(str);
+  // QUuid::toRfc4122() returns the 16 bytes in big-endian order
+  QByteArray bytes = QUuid::createUuid().toRfc4122();
+  quint64    high  = 0;
+  quint64    low   = 0;
+  for (int i = 0; i < 8; ++i) {
+    high = (high << 8) | static_cast<quint8>(bytes.at(i));
+    low  = (low << 8) | static_cast<quint8>(bytes.at(i + 8));
+  }
+  if (isValid(high, low)) {
+    return Uuid(high, low);
   } else {
     qFatal("Not able to generate valid random UUID!");  // calls abort()!
   }
 }
 
 Uuid Uuid::fromString(const QString& str) {
-  if (isValid(str)) {
-    return Uuid(str);
+  tl::optional<Uuid> uuid = tryFromString(str);
+  if (uuid) {
+    return *uuid;
   } else {
     throw RuntimeError(
         __FILE__, __LINE__,
@@ -114,11 +84,38 @@ Uuid Uuid::fromString(const QString& str) {
 }
 
 tl::optional<Uuid> Uuid::tryFromString(const QString& str) noexcept {
-  if (isValid(str)) {
-    return Uuid(str);
-  } else {
-    return tl::nullopt;
+  // Note: This used to be done using a RegEx, but when profiling and
+  // optimizing the library rescan code we found that a manually written
+  // comparison loop performs much better than the previous RegEx.
+  // See https://github.com/LibrePCB/LibrePCB/pull/651 for more details.
+  // Now the string is parsed into the binary value in the same loop.
+  if (str.length() != 36) return tl::nullopt;
+
+  const QChar* chars     = str.constData();
+  quint64      values[2] = {0, 0};
+  int          nibble    = 0;
+  for (int i = 0; i < 36; ++i) {
+    ushort chr = chars[i].unicode();
+    if ((i == 8) || (i == 13) || (i == 18) || (i == 23)) {
+      if (chr != '-') return tl::nullopt;
+      continue;
+    }
+    quint64 digit;
+    if ((chr >= '0') && (chr <= '9')) {
+      digit = chr - '0';
+    } else if ((chr >= 'a') && (chr <= 'f')) {
+      digit = chr - 'a' + 10;
+    } else {
+      return tl::nullopt;  // note: uppercase characters are invalid too
+    }
+    values[nibble / 16] = (values[nibble / 16] << 4) | digit;
+    ++nibble;
   }
+
+  // check type of uuid
+  if (!isValid(values[0], values[1])) return tl::nullopt;
+
+  return Uuid(values[0], values[1]);
 }
 
 /*******************************************************************************
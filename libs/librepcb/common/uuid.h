@@ -52,6 +52,12 @@ namespace librepcb {
  * can be created (in opposite to QUuid which allows "Null UUIDs")! If you need
  * a nullable UUID, use tl::optional<librepcb::Uuid> instead.
  *
+ * Internally, the UUID is stored as a 128-bit binary value (two 64-bit
+ * integers, most significant bits first) instead of a string. This avoids a
+ * heap allocation per UUID and makes comparing and hashing UUIDs (e.g. in
+ * QHash or QMap keys) as cheap as comparing two integers. The ordering is the
+ * same as the ordering of the string representations.
+ *
  * @see https://de.wikipedia.org/wiki/Universally_Unique_Identifier
  * @see https://tools.ietf.org/html/rfc4122
  */
@@ -71,7 +77,7 @@ public:
    *
    * @param other     Another ::librepcb::Uuid object
    */
-  Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+  Uuid(const Uuid& other) noexcept : mHigh(other.mHigh), mLow(other.mLow) {}
 
   /**
    * @brief Destructor
@@ -85,7 +91,7 @@ public:
    *
    * @return The UUID as a string
    */
-  QString toStr() const noexcept { return mUuid; }
+  QString toStr() const noexcept;
 
   //@{
   /**
@@ -93,18 +99,24 @@ public:
    *
    * @param rhs   The other object to compare
    *
-   * @return Result of comparing the UUIDs as strings
+   * @return Result of comparing the UUIDs (same result as comparing the
+   *         UUIDs as strings)
    */
   Uuid& operator=(const Uuid& rhs) noexcept {
-    mUuid = rhs.mUuid;
+    mHigh = rhs.mHigh;
+    mLow  = rhs.mLow;
     return *this;
   }
-  bool operator==(const Uuid& rhs) const noexcept { return mUuid == rhs.mUuid; }
-  bool operator!=(const Uuid& rhs) const noexcept { return mUuid != rhs.mUuid; }
-  bool operator<(const Uuid& rhs) const noexcept { return mUuid < rhs.mUuid; }
-  bool operator>(const Uuid& rhs) const noexcept { return mUuid > rhs.mUuid; }
-  bool operator<=(const Uuid& rhs) const noexcept { return mUuid <= rhs.mUuid; }
-  bool operator>=(const Uuid& rhs) const noexcept { return mUuid >= rhs.mUuid; }
+  bool operator==(const Uuid& rhs) const noexcept {
+    return (mHigh == rhs.mHigh) && (mLow == rhs.mLow);
+  }
+  bool operator!=(const Uuid& rhs) const noexcept { return !(*this == rhs); }
+  bool operator<(const Uuid& rhs) const noexcept {
+    return (mHigh < rhs.mHigh) || ((mHigh == rhs.mHigh) && (mLow < rhs.mLow));
+  }
+  bool operator>(const Uuid& rhs) const noexcept { return rhs < *this; }
+  bool operator<=(const Uuid& rhs) const noexcept { return !(rhs < *this); }
+  bool operator>=(const Uuid& rhs) const noexcept { return !(*this < rhs); }
   //@}
 
   // Static Methods
@@ -150,14 +162,30 @@ public:
 
 private:  // Methods
   /**
-   * @brief Constructor which creates a Uuid object from a string
+   * @brief Constructor which creates a Uuid object from its binary value
+   *
+   * @param high      The most significant 64 bits of the UUID
+   * @param low       The least significant 64 bits of the UUID
+   */
+  Uuid(quint64 high, quint64 low) noexcept : mHigh(high), mLow(low) {}
+
+  /**
+   * @brief Check if a binary value is a DCE UUID of version 4
+   *
+   * @param high      The most significant 64 bits of the UUID
+   * @param low       The least significant 64 bits of the UUID
    *
-   * @param str       The uuid as a string (lowercase and without braces)
+   * @return Whether the value is a valid UUID for this class
    */
-  explicit Uuid(const QString& str) noexcept : mUuid(str) {}
+  static bool isValid(quint64 high, quint64 low) noexcept {
+    return (((high >> 12) & 0xF) == 4) && ((low >> 62) == 2);
+  }
+
+  friend uint qHash(const Uuid& key, uint seed) noexcept;
 
 private:          // Data
-  QString mUuid;  ///< Guaranteed to always contain a valid UUID
+  quint64 mHigh;  ///< Most significant 64 bits (always a valid UUID)
+  quint64 mLow;   ///< Least significant 64 bits (always a valid UUID)
 };
 
 /*******************************************************************************
@@ -206,7 +234,8 @@ inline QDebug operator<<(QDebug stream, const Uuid& uuid) noexcept {
 }
 
 inline uint qHash(const Uuid& key, uint seed) noexcept {
-  return ::qHash(key.toStr(), seed);
+  // the bits of random UUIDs are (almost) uniformly distributed already
+  return ::qHash(key.mHigh ^ key.mLow, seed);
 }
 
 /*******************************************************************************
@@ -160,6 +160,8 @@ bool ComponentSymbolVariant::operator==(const ComponentSymbolVariant& rhs) const
 
 ComponentSymbolVariant& ComponentSymbolVariant::operator=(
     const ComponentSymbolVariant& rhs) noexcept {
+  // the item list emits an event for every added and removed item
+  SignalBatch<ComponentSymbolVariant, Event> batch(onEdited);
   if (mUuid != rhs.mUuid) {
     mUuid = rhs.mUuid;
     onEdited.notify(Event::UuidChanged);
@@ -173,6 +173,8 @@ bool ComponentSymbolVariantItem::operator==(
 
 ComponentSymbolVariantItem& ComponentSymbolVariantItem::operator=(
     const ComponentSymbolVariantItem& rhs) noexcept {
+  // the pin-signal-map emits an event for every added and removed item
+  SignalBatch<ComponentSymbolVariantItem, Event> batch(onEdited);
   if (mUuid != rhs.mUuid) {
     mUuid = rhs.mUuid;
     onEdited.notify(Event::UuidChanged);
@@ -57,7 +57,9 @@ public:
 
   // Getters
   Severity       getSeverity() const noexcept { return mSeverity; }
-  const QPixmap& getSeverityPixmap() const noexcept { return mSeverityPixmap; }
+  QPixmap        getSeverityPixmap() const noexcept {
+    return getSeverityPixmap(mSeverity);
+  }
   const QString& getMessage() const noexcept { return mMessage; }
   const QString& getDescription() const noexcept { return mDescription; }
 
@@ -72,6 +74,13 @@ public:
   }
 
   // Static Methods
+
+  /**
+   * @brief Get the icon of a severity
+   *
+   * @note Must only be called from the GUI thread. Messages are also created
+   *       in worker threads, so they don't hold the pixmap themselves.
+   */
   static QPixmap getSeverityPixmap(Severity severity) noexcept;
 
   // Operator Overloads
@@ -87,7 +96,6 @@ protected:  // Methods
 
 protected:  // Data
   Severity mSeverity;
-  QPixmap  mSeverityPixmap;
   QString  mMessage;
   QString  mDescription;
 };
@@ -175,6 +175,8 @@ bool Footprint::operator==(const Footprint& rhs) const noexcept {
 }
 
 Footprint& Footprint::operator=(const Footprint& rhs) noexcept {
+  // the lists emit an event for every added and removed element
+  SignalBatch<Footprint, Event> batch(onEdited);
   if (mUuid != rhs.mUuid) {
     mUuid = rhs.mUuid;
     onEdited.notify(Event::UuidChanged);
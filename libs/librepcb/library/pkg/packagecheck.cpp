@@ -46,7 +46,7 @@ namespace library {
  ******************************************************************************/
 
 PackageCheck::PackageCheck(const Package& package) noexcept
-  : LibraryElementCheck(package), mPackage(package) {
+  : LibraryElementCheck(package), mPackage(package), mFootprintCache(nullptr) {
 }
 
 PackageCheck::~PackageCheck() noexcept {
@@ -124,52 +124,76 @@ void PackageCheck::checkWrongTextLayers(MsgList& msgs) const {
 }
 
 void PackageCheck::checkPadsOverlapWithPlacement(MsgList& msgs) const {
-  for (auto itFtp = mPackage.getFootprints().begin();
-       itFtp != mPackage.getFootprints().end(); ++itFtp) {
-    std::shared_ptr<const Footprint> footprint = itFtp.ptr();
-
-    QPainterPath topPlacement;
-    QPainterPath botPlacement;
-    for (const Polygon& polygon : footprint->getPolygons()) {
-      QPen pen(Qt::NoPen);
-      if (polygon.getLineWidth() > 0) {
-        pen.setStyle(Qt::SolidLine);
-        pen.setWidthF(polygon.getLineWidth()->toPx());
-      }
-      QBrush brush(Qt::NoBrush);
-      if (polygon.isFilled() && polygon.getPath().isClosed()) {
-        brush.setStyle(Qt::SolidPattern);
-      }
-      QPainterPath area = Toolbox::shapeFromPath(
-          polygon.getPath().toQPainterPathPx(), pen, brush);
-      if (polygon.getLayerName() == GraphicsLayer::sTopPlacement) {
-        topPlacement.addPath(area);
-      } else if (polygon.getLayerName() == GraphicsLayer::sBotPlacement) {
-        botPlacement.addPath(area);
-      }
+  if (!mFootprintCache) {
+    for (auto it = mPackage.getFootprints().begin();
+         it != mPackage.getFootprints().end(); ++it) {
+      checkPadsOverlapWithPlacement(it.ptr(), msgs);
     }
+    return;
+  }
 
-    for (auto it = (*itFtp).getPads().begin(); it != (*itFtp).getPads().end();
-         ++it) {
-      std::shared_ptr<const FootprintPad> pad = it.ptr();
-      std::shared_ptr<const PackagePad>   pkgPad =
-          mPackage.getPads().find(pad->getUuid());
-      Length clearance(150000);  // 150 µm
-      Length tolerance(10);      // 0.01 µm, to avoid rounding issues
-      Path   stopMaskPath = pad->getOutline(clearance - tolerance);
-      stopMaskPath.rotate(pad->getRotation()).translate(pad->getPosition());
-      QPainterPath stopMask = stopMaskPath.toQPainterPathPx();
-      if (pad->isOnLayer(GraphicsLayer::sTopCopper) &&
-          stopMask.intersects(topPlacement)) {
-        msgs.append(std::make_shared<MsgPadOverlapsWithPlacement>(
-            footprint, pad, pkgPad ? *pkgPad->getName() : QString(),
-            clearance));
-      } else if (pad->isOnLayer(GraphicsLayer::sBotCopper) &&
-                 stopMask.intersects(botPlacement)) {
-        msgs.append(std::make_shared<MsgPadOverlapsWithPlacement>(
-            footprint, pad, pkgPad ? *pkgPad->getName() : QString(),
-            clearance));
-      }
+  // only check footprints which are not in the cache yet
+  SExpression pads = SExpression::createList("pads");
+  mPackage.getPads().serialize(pads);
+  QByteArray     padsContent = pads.toByteArray();
+  FootprintCache usedEntries;
+  for (auto it = mPackage.getFootprints().begin();
+       it != mPackage.getFootprints().end(); ++it) {
+    QByteArray key = QCryptographicHash::hash(
+        padsContent + (*it).serializeToDomElement("footprint").toByteArray(),
+        QCryptographicHash::Sha256);
+    if (!mFootprintCache->contains(key)) {
+      MsgList footprintMsgs;
+      checkPadsOverlapWithPlacement(it.ptr(), footprintMsgs);
+      mFootprintCache->insert(key, footprintMsgs);
+    }
+    usedEntries.insert(key, mFootprintCache->value(key));
+    msgs += usedEntries.value(key);
+  }
+  *mFootprintCache = usedEntries;
+}
+
+void PackageCheck::checkPadsOverlapWithPlacement(
+    std::shared_ptr<const Footprint> footprint, MsgList& msgs) const {
+  QPainterPath topPlacement;
+  QPainterPath botPlacement;
+  for (const Polygon& polygon : footprint->getPolygons()) {
+    QPen pen(Qt::NoPen);
+    if (polygon.getLineWidth() > 0) {
+      pen.setStyle(Qt::SolidLine);
+      pen.setWidthF(polygon.getLineWidth()->toPx());
+    }
+    QBrush brush(Qt::NoBrush);
+    if (polygon.isFilled() && polygon.getPath().isClosed()) {
+      brush.setStyle(Qt::SolidPattern);
+    }
+    QPainterPath area = Toolbox::shapeFromPath(
+        polygon.getPath().toQPainterPathPx(), pen, brush);
+    if (polygon.getLayerName() == GraphicsLayer::sTopPlacement) {
+      topPlacement.addPath(area);
+    } else if (polygon.getLayerName() == GraphicsLayer::sBotPlacement) {
+      botPlacement.addPath(area);
+    }
+  }
+
+  for (auto it = footprint->getPads().begin(); it != footprint->getPads().end();
+       ++it) {
+    std::shared_ptr<const FootprintPad> pad = it.ptr();
+    std::shared_ptr<const PackagePad>   pkgPad =
+        mPackage.getPads().find(pad->getUuid());
+    Length clearance(150000);  // 150 µm
+    Length tolerance(10);      // 0.01 µm, to avoid rounding issues
+    Path   stopMaskPath = pad->getOutline(clearance - tolerance);
+    stopMaskPath.rotate(pad->getRotation()).translate(pad->getPosition());
+    QPainterPath stopMask = stopMaskPath.toQPainterPathPx();
+    if (pad->isOnLayer(GraphicsLayer::sTopCopper) &&
+        stopMask.intersects(topPlacement)) {
+      msgs.append(std::make_shared<MsgPadOverlapsWithPlacement>(
+          footprint, pad, pkgPad ? *pkgPad->getName() : QString(), clearance));
+    } else if (pad->isOnLayer(GraphicsLayer::sBotCopper) &&
+               stopMask.intersects(botPlacement)) {
+      msgs.append(std::make_shared<MsgPadOverlapsWithPlacement>(
+          footprint, pad, pkgPad ? *pkgPad->getName() : QString(), clearance));
     }
   }
 }
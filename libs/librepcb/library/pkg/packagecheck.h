@@ -33,6 +33,7 @@
 namespace librepcb {
 namespace library {
 
+class Footprint;
 class Package;
 
 /*******************************************************************************
@@ -44,12 +45,29 @@ class Package;
  */
 class PackageCheck : public LibraryElementCheck {
 public:
+  // Types
+
+  /**
+   * @brief Cache for the results of the expensive per-footprint checks
+   *
+   * The key is a hash of everything these checks depend on (the footprint and
+   * the package pads), so only modified footprints need to be checked again.
+   * After each run, the cache contains only the entries of the current
+   * footprints.
+   */
+  typedef QHash<QByteArray, LibraryElementCheckMessageList> FootprintCache;
+
   // Constructors / Destructor
   PackageCheck()                          = delete;
   PackageCheck(const PackageCheck& other) = delete;
   explicit PackageCheck(const Package& package) noexcept;
   virtual ~PackageCheck() noexcept;
 
+  // Setters
+  void setFootprintCache(FootprintCache* cache) noexcept {
+    mFootprintCache = cache;
+  }
+
   // General Methods
   virtual LibraryElementCheckMessageList runChecks() const override;
 
@@ -62,9 +80,12 @@ protected:  // Methods
   void checkMissingTexts(MsgList& msgs) const;
   void checkWrongTextLayers(MsgList& msgs) const;
   void checkPadsOverlapWithPlacement(MsgList& msgs) const;
+  void checkPadsOverlapWithPlacement(std::shared_ptr<const Footprint> footprint,
+                                     MsgList& msgs) const;
 
 private:  // Data
-  const Package& mPackage;
+  const Package&  mPackage;
+  FootprintCache* mFootprintCache;  ///< Optional, may be nullptr
 };
 
 /*******************************************************************************
@@ -247,11 +247,14 @@ bool ComponentEditorWidget::isInterfaceBroken() const noexcept {
   return false;
 }
 
-bool ComponentEditorWidget::runChecks(
-    LibraryElementCheckMessageList& msgs) const {
-  msgs = mComponent->runChecks();  // can throw
+std::function<LibraryElementCheckMessageList()>
+    ComponentEditorWidget::createCheckJob() const {
+  return createSnapshotCheckJob(*mComponent);
+}
+
+void ComponentEditorWidget::setCheckMessages(
+    const LibraryElementCheckMessageList& msgs) noexcept {
   mUi->lstMessages->setMessages(msgs);
-  return true;
 }
 
 template <>
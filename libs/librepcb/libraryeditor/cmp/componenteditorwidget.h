@@ -81,7 +81,6 @@ private:  // Methods
          ComponentSymbolVariant& variant) noexcept override;
   void memorizeComponentInterface() noexcept;
   bool isInterfaceBroken() const noexcept override;
-  bool runChecks(LibraryElementCheckMessageList& msgs) const override;
   template <typename MessageType>
   void fixMsg(const MessageType& msg);
   template <typename MessageType>
@@ -90,6 +89,10 @@ private:  // Methods
   bool processCheckMessage(
       std::shared_ptr<const LibraryElementCheckMessage> msg,
       bool                                              applyFix) override;
+  std::function<LibraryElementCheckMessageList()> createCheckJob()
+      const override;
+  void setCheckMessages(
+      const LibraryElementCheckMessageList& msgs) noexcept override;
 
 private:  // Data
   QScopedPointer<Ui::ComponentEditorWidget>         mUi;
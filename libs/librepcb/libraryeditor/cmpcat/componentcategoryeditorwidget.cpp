@@ -157,11 +157,14 @@ QString ComponentCategoryEditorWidget::commitMetadata() noexcept {
   return QString();
 }
 
-bool ComponentCategoryEditorWidget::runChecks(
-    LibraryElementCheckMessageList& msgs) const {
-  msgs = mCategory->runChecks();  // can throw
+std::function<LibraryElementCheckMessageList()>
+    ComponentCategoryEditorWidget::createCheckJob() const {
+  return createSnapshotCheckJob(*mCategory);
+}
+
+void ComponentCategoryEditorWidget::setCheckMessages(
+    const LibraryElementCheckMessageList& msgs) noexcept {
   mUi->lstMessages->setMessages(msgs);
-  return true;
 }
 
 template <>
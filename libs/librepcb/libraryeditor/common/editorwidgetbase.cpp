@@ -30,6 +30,7 @@
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/workspace/workspace.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 #include <QtWidgets>
 
@@ -55,7 +56,25 @@ EditorWidgetBase::EditorWidgetBase(const Context& context, const FilePath& fp,
     mUndoStackActionGroup(nullptr),
     mToolsActionGroup(nullptr),
     mStatusBar(nullptr),
-    mIsInterfaceBroken(false) {
+    mIsInterfaceBroken(false),
+    mCheckTimer(),
+    mCheckWatcher(),
+    mCheckRevision(0),
+    mRunningCheckRevision(-1) {
+  // Don't run checks immediately when requested. Sometimes when the undo
+  // stack reports changes, it's just in the middle of a bigger change, so the
+  // whole change is not done yet. In that case, running checks would lead to
+  // wrong results. Instead, wait until there were no more changes for some
+  // time to get more stable messages. But also don't wait too long, otherwise
+  // it would feel like a lagging user interface.
+  mCheckTimer.setSingleShot(true);
+  mCheckTimer.setInterval(50);
+  connect(&mCheckTimer, &QTimer::timeout, this,
+          &EditorWidgetBase::updateCheckMessages);
+  connect(&mCheckWatcher,
+          &QFutureWatcher<LibraryElementCheckMessageList>::finished, this,
+          &EditorWidgetBase::checkJobFinished);
+
   mUndoStack.reset(new UndoStack());
   connect(mUndoStack.data(), &UndoStack::cleanChanged, this,
           &EditorWidgetBase::undoStackCleanChanged);
@@ -247,35 +266,49 @@ void EditorWidgetBase::undoStackCleanChanged(bool clean) noexcept {
 }
 
 void EditorWidgetBase::scheduleLibraryElementChecks() noexcept {
-  // Don't run check immediately when requested. Sometimes when the undo stack
-  // reports changes, it's just in the middle of a bigger change, so the whole
-  // change is not done yet. In that case, running checks would lead to wrong
-  // results. Instead, just delay checks for some time to get more stable
-  // messages. But also don't wait too long, otherwise it would feel like a
-  // lagging user interface.
-#if (QT_VERSION >= QT_VERSION_CHECK(5, 4, 0))
-  QTimer::singleShot(50, this, &EditorWidgetBase::updateCheckMessages);
-#else
-  QTimer::singleShot(50, this, SLOT(updateCheckMessages()));
-#endif
+  // Results of a currently running check job are outdated now.
+  ++mCheckRevision;
+  mCheckTimer.start();  // restarts the timer if it's already active
 }
 
 void EditorWidgetBase::updateCheckMessages() noexcept {
+  if (mCheckWatcher.isRunning()) {
+    // Start the next job as soon as the running job is finished.
+    return;
+  }
+
+  std::function<LibraryElementCheckMessageList()> job = createCheckJob();
+  if (job) {
+    mRunningCheckRevision = mCheckRevision;
+    mCheckWatcher.setFuture(QtConcurrent::run(job));
+  } else {
+    // Failed to run checks (for example because a command is active), try it
+    // later again.
+    mCheckTimer.start();
+  }
+}
+
+void EditorWidgetBase::checkJobFinished() noexcept {
+  if (mRunningCheckRevision != mCheckRevision) {
+    // The element was modified while the checks were running, so discard the
+    // results and run the checks again.
+    if (!mCheckTimer.isActive()) {
+      mCheckTimer.start();
+    }
+    return;
+  }
+
   try {
-    LibraryElementCheckMessageList msgs;
-    if (runChecks(msgs)) {  // can throw
-      int errors = 0;
-      foreach (const auto& msg, msgs) {
-        if (msg->getSeverity() == LibraryElementCheckMessage::Severity::Error) {
-          ++errors;
-        }
+    LibraryElementCheckMessageList msgs =
+        mCheckWatcher.future().result();  // can throw
+    setCheckMessages(msgs);
+    int errors = 0;
+    foreach (const auto& msg, msgs) {
+      if (msg->getSeverity() == LibraryElementCheckMessage::Severity::Error) {
+        ++errors;
       }
-      emit errorsAvailableChanged(errors > 0);
-    } else {
-      // Failed to run checks (for example because a command is active), try it
-      // later again.
-      scheduleLibraryElementChecks();
     }
+    emit errorsAvailableChanged(errors > 0);
   } catch (const Exception& e) {
     qCritical() << "Failed to run checks:" << e.getMsg();
   }
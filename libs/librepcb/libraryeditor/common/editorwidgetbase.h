@@ -25,13 +25,18 @@
  ******************************************************************************/
 #include "../common/libraryelementchecklistwidget.h"
 
+#include <librepcb/common/application.h>
+#include <librepcb/common/fileio/transactionaldirectory.h>
 #include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/fileio/versionfile.h>
 #include <librepcb/common/undostack.h>
 #include <librepcb/common/units/all_length_units.h>
 
 #include <QtCore>
 #include <QtWidgets>
 
+#include <functional>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -59,6 +64,13 @@ namespace editor {
 
 /**
  * @brief The EditorWidgetBase class
+ *
+ * The library element checks are run in a worker thread whenever the element
+ * was modified (debounced, see #scheduleLibraryElementChecks()). Since the
+ * edited element must not be accessed from another thread, the check job
+ * works on a snapshot of the element (see #createSnapshotCheckJob()). Only
+ * one check job is running at a time, and results of jobs which were started
+ * before the latest modification are discarded.
  */
 class EditorWidgetBase : public QWidget,
                          protected IF_LibraryElementCheckHandler {
@@ -137,13 +149,75 @@ protected:  // Methods
     Q_UNUSED(newTool);
     return false;
   }
-  virtual bool       runChecks(LibraryElementCheckMessageList& msgs) const = 0;
   void               undoStackStateModified() noexcept;
   const QStringList& getLibLocaleOrder() const noexcept;
   QString            getWorkspaceSettingsUserName() noexcept;
 
+  /**
+   * @brief Create a job which runs the checks of the edited library element
+   *
+   * The job is executed in a worker thread, thus it must not access any
+   * object owned by the editor. Use #createSnapshotCheckJob() to check a copy
+   * of the element instead.
+   *
+   * @return The check job, or an empty function if the checks can't be run
+   *         at the moment (e.g. because a tool is active). In the latter
+   *         case, the checks are scheduled again later.
+   */
+  virtual std::function<LibraryElementCheckMessageList()> createCheckJob()
+      const = 0;
+
+  /**
+   * @brief Display the messages of a finished check job
+   *
+   * @param msgs  The check messages.
+   */
+  virtual void setCheckMessages(
+      const LibraryElementCheckMessageList& msgs) noexcept = 0;
+
+  /**
+   * @brief Create a check job for a snapshot of a library element
+   *
+   * The element is serialized immediately, the job then loads a copy of the
+   * element from the serialized data and runs the checks on that copy.
+   *
+   * @tparam T        Type of the library element.
+   * @param element   The element to check.
+   * @param checkFunc Function to run the checks on the copy of the element.
+   *
+   * @return The check job (see #createCheckJob()).
+   */
+  template <typename T>
+  std::function<LibraryElementCheckMessageList()> createSnapshotCheckJob(
+      const T&                                                element,
+      std::function<LibraryElementCheckMessageList(const T&)> checkFunc) const {
+    QString    dirName = mFilePath.getFilename();
+    QByteArray content =
+        element.serializeToDomElement("librepcb_" % T::getLongElementName())
+            .toByteArray();
+    return [dirName, content,
+            checkFunc]() -> LibraryElementCheckMessageList {
+      TransactionalDirectory                  root;
+      std::unique_ptr<TransactionalDirectory> dir(
+          new TransactionalDirectory(root, dirName));
+      dir->write(T::getLongElementName() % ".lp", content);
+      dir->write(".librepcb-" % T::getShortElementName(),
+                 VersionFile(qApp->getFileFormatVersion()).toByteArray());
+      T copy(std::move(dir));  // can throw
+      return checkFunc(copy);  // can throw
+    };
+  }
+
+  /// @overload Runs the default checks of the element (T::runChecks())
+  template <typename T>
+  std::function<LibraryElementCheckMessageList()> createSnapshotCheckJob(
+      const T& element) const {
+    return createSnapshotCheckJob<T>(element, &T::runChecks);
+  }
+
 private slots:
   void updateCheckMessages() noexcept;
+  void checkJobFinished() noexcept;
 
 private:  // Methods
   /**
@@ -186,6 +260,16 @@ protected:  // Data
   StatusBar*                               mStatusBar;
   QScopedPointer<ToolBarProxy>             mCommandToolBarProxy;
   bool                                     mIsInterfaceBroken;
+
+private:  // Data
+  QTimer                                         mCheckTimer;
+  QFutureWatcher<LibraryElementCheckMessageList> mCheckWatcher;
+
+  /// Incremented on every modification of the element
+  int mCheckRevision;
+
+  /// The revision of the element checked by the running check job
+  int mRunningCheckRevision;
 };
 
 /*******************************************************************************
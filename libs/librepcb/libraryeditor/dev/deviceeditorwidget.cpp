@@ -412,10 +412,14 @@ bool DeviceEditorWidget::isInterfaceBroken() const noexcept {
   return false;
 }
 
-bool DeviceEditorWidget::runChecks(LibraryElementCheckMessageList& msgs) const {
-  msgs = mDevice->runChecks();  // can throw
+std::function<LibraryElementCheckMessageList()>
+    DeviceEditorWidget::createCheckJob() const {
+  return createSnapshotCheckJob(*mDevice);
+}
+
+void DeviceEditorWidget::setCheckMessages(
+    const LibraryElementCheckMessageList& msgs) noexcept {
   mUi->lstMessages->setMessages(msgs);
-  return true;
 }
 
 template <>
@@ -92,7 +92,6 @@ private:  // Methods
   void    updatePackagePreview() noexcept;
   void    memorizeDeviceInterface() noexcept;
   bool    isInterfaceBroken() const noexcept override;
-  bool    runChecks(LibraryElementCheckMessageList& msgs) const override;
   template <typename MessageType>
   void fixMsg(const MessageType& msg);
   template <typename MessageType>
@@ -101,6 +100,10 @@ private:  // Methods
   bool processCheckMessage(
       std::shared_ptr<const LibraryElementCheckMessage> msg,
       bool                                              applyFix) override;
+  std::function<LibraryElementCheckMessageList()> createCheckJob()
+      const override;
+  void setCheckMessages(
+      const LibraryElementCheckMessageList& msgs) noexcept override;
 
 private:  // Data
   QScopedPointer<Ui::DeviceEditorWidget>            mUi;
@@ -237,11 +237,14 @@ QString LibraryOverviewWidget::commitMetadata() noexcept {
   return QString();
 }
 
-bool LibraryOverviewWidget::runChecks(
-    LibraryElementCheckMessageList& msgs) const {
-  msgs = mLibrary->runChecks();  // can throw
+std::function<LibraryElementCheckMessageList()>
+    LibraryOverviewWidget::createCheckJob() const {
+  return createSnapshotCheckJob(*mLibrary);
+}
+
+void LibraryOverviewWidget::setCheckMessages(
+    const LibraryElementCheckMessageList& msgs) noexcept {
   mUi->lstMessages->setMessages(msgs);
-  return true;
 }
 
 template <>
@@ -106,7 +106,6 @@ private:  // Methods
   void    updateMetadata() noexcept;
   QString commitMetadata() noexcept;
   bool    isInterfaceBroken() const noexcept override { return false; }
-  bool    runChecks(LibraryElementCheckMessageList& msgs) const override;
   template <typename MessageType>
   void fixMsg(const MessageType& msg);
   template <typename MessageType>
@@ -115,6 +114,10 @@ private:  // Methods
   bool processCheckMessage(
       std::shared_ptr<const LibraryElementCheckMessage> msg,
       bool                                              applyFix) override;
+  std::function<LibraryElementCheckMessageList()> createCheckJob()
+      const override;
+  void setCheckMessages(
+      const LibraryElementCheckMessageList& msgs) noexcept override;
   void updateElementLists() noexcept;
   template <typename ElementType>
   void updateElementList(QListWidget& listWidget, const QIcon& icon) noexcept;
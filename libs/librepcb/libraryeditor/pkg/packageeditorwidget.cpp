@@ -61,7 +61,8 @@ PackageEditorWidget::PackageEditorWidget(const Context&  context,
                                          const FilePath& fp, QWidget* parent)
   : EditorWidgetBase(context, fp, parent),
     mUi(new Ui::PackageEditorWidget),
-    mGraphicsScene(new GraphicsScene()) {
+    mGraphicsScene(new GraphicsScene()),
+    mCheckFootprintCache(std::make_shared<PackageCheck::FootprintCache>()) {
   mUi->setupUi(this);
   mUi->lstMessages->setHandler(this);
   setupErrorNotificationWidget(*mUi->errorNotificationWidget);
@@ -429,18 +430,28 @@ bool PackageEditorWidget::isInterfaceBroken() const noexcept {
   return false;
 }
 
-bool PackageEditorWidget::runChecks(
-    LibraryElementCheckMessageList& msgs) const {
+std::function<LibraryElementCheckMessageList()>
+    PackageEditorWidget::createCheckJob() const {
   if ((mFsm->getCurrentTool() != NONE) && (mFsm->getCurrentTool() != SELECT)) {
     // Do not run checks if a tool is active because it could lead to annoying,
     // flickering messages. For example when placing pads, they always overlap
     // right after placing them, so we have to wait until the user has moved the
     // cursor to place the pad at a different position.
-    return false;
+    return nullptr;
   }
-  msgs = mPackage->runChecks();  // can throw
+  std::shared_ptr<PackageCheck::FootprintCache> cache = mCheckFootprintCache;
+  return createSnapshotCheckJob<Package>(
+      *mPackage,
+      [cache](const Package& package) -> LibraryElementCheckMessageList {
+        PackageCheck check(package);
+        check.setFootprintCache(cache.get());
+        return check.runChecks();  // can throw
+      });
+}
+
+void PackageEditorWidget::setCheckMessages(
+    const LibraryElementCheckMessageList& msgs) noexcept {
   mUi->lstMessages->setMessages(msgs);
-  return true;
 }
 
 template <>
@@ -484,10 +495,11 @@ void PackageEditorWidget::fixMsg(const MsgMissingFootprintValue& msg) {
 
 template <>
 void PackageEditorWidget::fixMsg(const MsgWrongFootprintTextLayer& msg) {
+  // Note: The message refers to a snapshot of the package, not to mPackage.
   std::shared_ptr<Footprint> footprint =
-      mPackage->getFootprints().get(msg.getFootprint().get());
+      mPackage->getFootprints().get(msg.getFootprint()->getUuid());
   std::shared_ptr<StrokeText> text =
-      footprint->getStrokeTexts().get(msg.getText().get());
+      footprint->getStrokeTexts().get(msg.getText()->getUuid());
   QScopedPointer<CmdStrokeTextEdit> cmd(new CmdStrokeTextEdit(*text));
   cmd->setLayerName(GraphicsLayerName(msg.getExpectedLayerName()), false);
   mUndoStack->execCmd(cmd.take());
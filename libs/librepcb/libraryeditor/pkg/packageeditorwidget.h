@@ -28,6 +28,7 @@
 
 #include <librepcb/common/graphics/if_graphicsvieweventhandler.h>
 #include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/packagecheck.h>
 
 #include <QtCore>
 #include <QtWidgets>
@@ -109,7 +110,6 @@ private:  // Methods
   void currentFootprintChanged(int index) noexcept;
   void memorizePackageInterface() noexcept;
   bool isInterfaceBroken() const noexcept override;
-  bool runChecks(LibraryElementCheckMessageList& msgs) const override;
   template <typename MessageType>
   void fixMsg(const MessageType& msg);
   template <typename MessageType>
@@ -118,6 +118,10 @@ private:  // Methods
   bool processCheckMessage(
       std::shared_ptr<const LibraryElementCheckMessage> msg,
       bool                                              applyFix) override;
+  std::function<LibraryElementCheckMessageList()> createCheckJob()
+      const override;
+  void setCheckMessages(
+      const LibraryElementCheckMessageList& msgs) noexcept override;
 
 private:  // Data
   QScopedPointer<Ui::PackageEditorWidget>         mUi;
@@ -129,6 +133,10 @@ private:  // Data
   // broken interface detection
   QSet<Uuid>    mOriginalPadUuids;
   FootprintList mOriginalFootprints;
+
+  /// Results of unmodified footprints from previous check jobs (only accessed
+  /// by the check jobs, which never run concurrently)
+  std::shared_ptr<PackageCheck::FootprintCache> mCheckFootprintCache;
 };
 
 /*******************************************************************************
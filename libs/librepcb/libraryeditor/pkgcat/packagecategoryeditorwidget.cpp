@@ -157,11 +157,14 @@ QString PackageCategoryEditorWidget::commitMetadata() noexcept {
   return QString();
 }
 
-bool PackageCategoryEditorWidget::runChecks(
-    LibraryElementCheckMessageList& msgs) const {
-  msgs = mCategory->runChecks();  // can throw
+std::function<LibraryElementCheckMessageList()>
+    PackageCategoryEditorWidget::createCheckJob() const {
+  return createSnapshotCheckJob(*mCategory);
+}
+
+void PackageCategoryEditorWidget::setCheckMessages(
+    const LibraryElementCheckMessageList& msgs) noexcept {
   mUi->lstMessages->setMessages(msgs);
-  return true;
 }
 
 template <>
@@ -75,7 +75,6 @@ private:  // Methods
   void    updateMetadata() noexcept;
   QString commitMetadata() noexcept;
   bool    isInterfaceBroken() const noexcept override { return false; }
-  bool    runChecks(LibraryElementCheckMessageList& msgs) const override;
   template <typename MessageType>
   void fixMsg(const MessageType& msg);
   template <typename MessageType>
@@ -84,6 +83,10 @@ private:  // Methods
   bool processCheckMessage(
       std::shared_ptr<const LibraryElementCheckMessage> msg,
       bool                                              applyFix) override;
+  std::function<LibraryElementCheckMessageList()> createCheckJob()
+      const override;
+  void setCheckMessages(
+      const LibraryElementCheckMessageList& msgs) noexcept override;
   void btnChooseParentCategoryClicked() noexcept;
   void btnResetParentCategoryClicked() noexcept;
   void updateCategoryLabel() noexcept;
@@ -393,17 +393,21 @@ bool SymbolEditorWidget::isInterfaceBroken() const noexcept {
   return mSymbol->getPins().getUuidSet() != mOriginalSymbolPinUuids;
 }
 
-bool SymbolEditorWidget::runChecks(LibraryElementCheckMessageList& msgs) const {
+std::function<LibraryElementCheckMessageList()>
+    SymbolEditorWidget::createCheckJob() const {
   if ((mFsm->getCurrentTool() != NONE) && (mFsm->getCurrentTool() != SELECT)) {
     // Do not run checks if a tool is active because it could lead to annoying,
     // flickering messages. For example when placing pins, they always overlap
     // right after placing them, so we have to wait until the user has moved the
     // cursor to place the pin at a different position.
-    return false;
+    return nullptr;
   }
-  msgs = mSymbol->runChecks();  // can throw
+  return createSnapshotCheckJob(*mSymbol);
+}
+
+void SymbolEditorWidget::setCheckMessages(
+    const LibraryElementCheckMessageList& msgs) noexcept {
   mUi->lstMessages->setMessages(msgs);
-  return true;
 }
 
 template <>
@@ -439,7 +443,8 @@ void SymbolEditorWidget::fixMsg(const MsgMissingSymbolValue& msg) {
 
 template <>
 void SymbolEditorWidget::fixMsg(const MsgWrongSymbolTextLayer& msg) {
-  std::shared_ptr<Text> text = mSymbol->getTexts().get(msg.getText().get());
+  std::shared_ptr<Text> text =
+      mSymbol->getTexts().get(msg.getText()->getUuid());
   QScopedPointer<CmdTextEdit> cmd(new CmdTextEdit(*text));
   cmd->setLayerName(GraphicsLayerName(msg.getExpectedLayerName()), false);
   mUndoStack->execCmd(cmd.take());
@@ -447,7 +452,8 @@ void SymbolEditorWidget::fixMsg(const MsgWrongSymbolTextLayer& msg) {
 
 template <>
 void SymbolEditorWidget::fixMsg(const MsgSymbolPinNotOnGrid& msg) {
-  std::shared_ptr<SymbolPin> pin = mSymbol->getPins().get(msg.getPin().get());
+  std::shared_ptr<SymbolPin> pin =
+      mSymbol->getPins().get(msg.getPin()->getUuid());
   Point newPos = pin->getPosition().mappedToGrid(msg.getGridInterval());
   QScopedPointer<CmdSymbolPinEdit> cmd(new CmdSymbolPinEdit(*pin));
   cmd->setPosition(newPos, false);
@@ -79,6 +79,7 @@ Board::Board(const Board&                            other,
     mProject(other.getProject()),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mDeferNetLineUpdatesCounter(0),
     mUuid(Uuid::createRandom()),
     mName(name),
     mDefaultFontFileName(other.mDefaultFontFileName) {
@@ -191,6 +192,7 @@ Board::Board(Project&                                project,
     mProject(project),
     mDirectory(std::move(directory)),
     mIsAddedToProject(false),
+    mDeferNetLineUpdatesCounter(0),
     mUuid(Uuid::createRandom()),
     mName("New Board") {
   try {
@@ -409,26 +411,49 @@ bool Board::isEmpty() const noexcept {
 }
 
 QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept {
-  QPointF scenePosPx = pos.toPxQPointF();
+  QPointF         scenePosPx = pos.toPxQPointF();
+  QList<BI_Base*> candidates = getItemCandidatesAtScenePos(pos);
   QList<BI_Base*>
       list;  // Note: The order of adding the items is very important (the
              // top most item must appear as the first item in the list)!
   // vias
-  foreach (BI_Via* via, getViasAtScenePos(pos, nullptr)) { list.append(via); }
+  foreach (BI_Via* via, filterItems<BI_Via>(candidates, scenePosPx)) {
+    list.append(via);
+  }
   // netpoints
   foreach (BI_NetPoint* netpoint,
-           getNetPointsAtScenePos(pos, nullptr, nullptr)) {
+           filterItems<BI_NetPoint>(candidates, scenePosPx)) {
     list.append(netpoint);
   }
   // netlines
-  foreach (BI_NetLine* netline, getNetLinesAtScenePos(pos, nullptr, nullptr)) {
+  foreach (BI_NetLine* netline,
+           filterItems<BI_NetLine>(candidates, scenePosPx)) {
     list.append(netline);
   }
-  // footprints & pads
+  // footprints & pads (only of devices which have items at this position)
+  QSet<const BI_Device*> devices;
+  QList<BI_StrokeText*>  boardTexts;
+  foreach (BI_Base* item, candidates) {
+    if (item->getType() == BI_Base::Type_t::Footprint) {
+      devices.insert(&static_cast<BI_Footprint*>(item)->getDeviceInstance());
+    } else if (item->getType() == BI_Base::Type_t::FootprintPad) {
+      devices.insert(&static_cast<BI_FootprintPad*>(item)
+                          ->getFootprint()
+                          .getDeviceInstance());
+    } else if (item->getType() == BI_Base::Type_t::StrokeText) {
+      BI_StrokeText* text = static_cast<BI_StrokeText*>(item);
+      if (text->getFootprint()) {
+        devices.insert(&text->getFootprint()->getDeviceInstance());
+      } else {
+        boardTexts.append(text);
+      }
+    }
+  }
   foreach (BI_Device* device, mDeviceInstances) {
+    if (!devices.contains(device)) continue;
     BI_Footprint& footprint = device->getFootprint();
     if (footprint.isSelectable() &&
-        footprint.getGrabAreaScenePx().contains(scenePosPx)) {
+        footprint.isGrabAreaAtScenePos(scenePosPx)) {
       if (footprint.getIsMirrored()) {
         list.append(&footprint);
       } else {
@@ -436,8 +461,7 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept {
       }
     }
     foreach (BI_FootprintPad* pad, footprint.getPads()) {
-      if (pad->isSelectable() &&
-          pad->getGrabAreaScenePx().contains(scenePosPx)) {
+      if (pad->isSelectable() && pad->isGrabAreaAtScenePos(scenePosPx)) {
         if (pad->getIsMirrored()) {
           list.append(pad);
         } else {
@@ -446,8 +470,7 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept {
       }
     }
     foreach (BI_StrokeText* text, device->getFootprint().getStrokeTexts()) {
-      if (text->isSelectable() &&
-          text->getGrabAreaScenePx().contains(scenePosPx)) {
+      if (text->isSelectable() && text->isGrabAreaAtScenePos(scenePosPx)) {
         if (GraphicsLayer::isTopLayer(*text->getText().getLayerName())) {
           list.prepend(text);
         } else {
@@ -457,32 +480,23 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept {
     }
   }
   // planes
-  foreach (BI_Plane* planes, mPlanes) {
-    if (planes->isSelectable() &&
-        planes->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(planes);
-    }
+  foreach (BI_Plane* plane, filterItems<BI_Plane>(candidates, scenePosPx)) {
+    list.append(plane);
   }
   // polygons
-  foreach (BI_Polygon* polygon, mPolygons) {
-    if (polygon->isSelectable() &&
-        polygon->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(polygon);
-    }
+  foreach (BI_Polygon* polygon,
+           filterItems<BI_Polygon>(candidates, scenePosPx)) {
+    list.append(polygon);
   }
   // texts
-  foreach (BI_StrokeText* text, mStrokeTexts) {
-    if (text->isSelectable() &&
-        text->getGrabAreaScenePx().contains(scenePosPx)) {
+  foreach (BI_StrokeText* text, boardTexts) {
+    if (text->isSelectable() && text->isGrabAreaAtScenePos(scenePosPx)) {
       list.append(text);
     }
   }
   // holes
-  foreach (BI_Hole* hole, mHoles) {
-    if (hole->isSelectable() &&
-        hole->getGrabAreaScenePx().contains(scenePosPx)) {
-      list.append(hole);
-    }
+  foreach (BI_Hole* hole, filterItems<BI_Hole>(candidates, scenePosPx)) {
+    list.append(hole);
   }
   return list;
 }
@@ -490,10 +504,11 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept {
 QList<BI_Via*> Board::getViasAtScenePos(const Point&     pos,
                                         const NetSignal* netsignal) const
     noexcept {
-  QList<BI_Via*> list;
-  foreach (BI_NetSegment* segment, mNetSegments) {
-    if ((!netsignal) || (&segment->getNetSignal() == netsignal)) {
-      segment->getViasAtScenePos(pos, list);
+  QList<BI_Via*>  list;
+  QList<BI_Base*> candidates = getItemCandidatesAtScenePos(pos);
+  foreach (BI_Via* via, filterItems<BI_Via>(candidates, pos.toPxQPointF())) {
+    if ((!netsignal) || (&via->getNetSignalOfNetSegment() == netsignal)) {
+      list.append(via);
     }
   }
   return list;
@@ -503,9 +518,13 @@ QList<BI_NetPoint*> Board::getNetPointsAtScenePos(
     const Point& pos, const GraphicsLayer* layer,
     const NetSignal* netsignal) const noexcept {
   QList<BI_NetPoint*> list;
-  foreach (BI_NetSegment* segment, mNetSegments) {
-    if ((!netsignal) || (&segment->getNetSignal() == netsignal)) {
-      segment->getNetPointsAtScenePos(pos, layer, list);
+  QList<BI_Base*>     candidates = getItemCandidatesAtScenePos(pos);
+  foreach (BI_NetPoint* netpoint,
+           filterItems<BI_NetPoint>(candidates, pos.toPxQPointF())) {
+    if (((!layer) || (netpoint->getLayerOfLines() == layer)) &&
+        ((!netsignal) ||
+         (&netpoint->getNetSignalOfNetSegment() == netsignal))) {
+      list.append(netpoint);
     }
   }
   return list;
@@ -515,9 +534,13 @@ QList<BI_NetLine*> Board::getNetLinesAtScenePos(
     const Point& pos, const GraphicsLayer* layer,
     const NetSignal* netsignal) const noexcept {
   QList<BI_NetLine*> list;
-  foreach (BI_NetSegment* segment, mNetSegments) {
-    if ((!netsignal) || (&segment->getNetSignal() == netsignal)) {
-      segment->getNetLinesAtScenePos(pos, layer, list);
+  QList<BI_Base*>    candidates = getItemCandidatesAtScenePos(pos);
+  foreach (BI_NetLine* netline,
+           filterItems<BI_NetLine>(candidates, pos.toPxQPointF())) {
+    if (((!layer) || (&netline->getLayer() == layer)) &&
+        ((!netsignal) ||
+         (&netline->getNetSignalOfNetSegment() == netsignal))) {
+      list.append(netline);
     }
   }
   return list;
@@ -527,14 +550,12 @@ QList<BI_FootprintPad*> Board::getPadsAtScenePos(
     const Point& pos, const GraphicsLayer* layer,
     const NetSignal* netsignal) const noexcept {
   QList<BI_FootprintPad*> list;
-  foreach (BI_Device* device, mDeviceInstances) {
-    foreach (BI_FootprintPad* pad, device->getFootprint().getPads()) {
-      if (pad->isSelectable() &&
-          pad->getGrabAreaScenePx().contains(pos.toPxQPointF()) &&
-          ((!layer) || (pad->isOnLayer(layer->getName()))) &&
-          ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal))) {
-        list.append(pad);
-      }
+  QList<BI_Base*>         candidates = getItemCandidatesAtScenePos(pos);
+  foreach (BI_FootprintPad* pad,
+           filterItems<BI_FootprintPad>(candidates, pos.toPxQPointF())) {
+    if (((!layer) || (pad->isOnLayer(layer->getName()))) &&
+        ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal))) {
+      list.append(pad);
     }
   }
   return list;
@@ -782,6 +803,32 @@ void Board::forceAirWiresRebuild() noexcept {
   triggerAirWiresRebuild();
 }
 
+/*******************************************************************************
+ *  NetLine Update Methods
+ ******************************************************************************/
+
+void Board::beginDeferredNetLineUpdates() noexcept {
+  ++mDeferNetLineUpdatesCounter;
+}
+
+void Board::endDeferredNetLineUpdates() noexcept {
+  Q_ASSERT(mDeferNetLineUpdatesCounter > 0);
+  if (--mDeferNetLineUpdatesCounter == 0) {
+    QSet<BI_NetLine*> netlines = mScheduledNetLinesForUpdate;
+    mScheduledNetLinesForUpdate.clear();
+    foreach (BI_NetLine* netline, netlines) { netline->updateLine(); }
+  }
+}
+
+bool Board::scheduleNetLineUpdate(BI_NetLine& netline) noexcept {
+  if (mDeferNetLineUpdatesCounter > 0) {
+    mScheduledNetLinesForUpdate.insert(&netline);
+    return true;
+  } else {
+    return false;
+  }
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -892,17 +939,17 @@ void Board::setSelectionRect(const Point& p1, const Point& p2,
     QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
     foreach (BI_Device* component, mDeviceInstances) {
       BI_Footprint& footprint       = component->getFootprint();
-      bool          selectFootprint = footprint.isSelectable() &&
-                             footprint.getGrabAreaScenePx().intersects(rectPx);
+      bool          selectFootprint =
+          footprint.isSelectable() && footprint.isGrabAreaInSceneRect(rectPx);
       footprint.setSelected(selectFootprint);
       foreach (BI_FootprintPad* pad, footprint.getPads()) {
         bool selectPad =
-            pad->isSelectable() && pad->getGrabAreaScenePx().intersects(rectPx);
+            pad->isSelectable() && pad->isGrabAreaInSceneRect(rectPx);
         pad->setSelected(selectFootprint || selectPad);
       }
       foreach (BI_StrokeText* text, footprint.getStrokeTexts()) {
-        bool selectText = text->isSelectable() &&
-                          text->getGrabAreaScenePx().intersects(rectPx);
+        bool selectText =
+            text->isSelectable() && text->isGrabAreaInSceneRect(rectPx);
         text->setSelected(selectFootprint || selectText);
       }
     }
@@ -910,23 +957,21 @@ void Board::setSelectionRect(const Point& p1, const Point& p2,
       segment->setSelectionRect(rectPx);
     }
     foreach (BI_Plane* plane, mPlanes) {
-      bool select = plane->isSelectable() &&
-                    plane->getGrabAreaScenePx().intersects(rectPx);
+      bool select =
+          plane->isSelectable() && plane->isGrabAreaInSceneRect(rectPx);
       plane->setSelected(select);
     }
     foreach (BI_Polygon* polygon, mPolygons) {
       bool select = polygon->isSelectable() &&
-                    polygon->getGrabAreaScenePx().intersects(rectPx);
+                    polygon->isGrabAreaInSceneRect(rectPx);
       polygon->setSelected(select);
     }
     foreach (BI_StrokeText* text, mStrokeTexts) {
-      bool select =
-          text->isSelectable() && text->getGrabAreaScenePx().intersects(rectPx);
+      bool select = text->isSelectable() && text->isGrabAreaInSceneRect(rectPx);
       text->setSelected(select);
     }
     foreach (BI_Hole* hole, mHoles) {
-      bool select =
-          hole->isSelectable() && hole->getGrabAreaScenePx().intersects(rectPx);
+      bool select = hole->isSelectable() && hole->isGrabAreaInSceneRect(rectPx);
       hole->setSelected(select);
     }
   }
@@ -970,6 +1015,38 @@ QVector<const AttributeProvider*> Board::getAttributeProviderParents() const
  *  Private Methods
  ******************************************************************************/
 
+QList<BI_Base*> Board::getItemCandidatesAtScenePos(const Point& pos) const
+    noexcept {
+  // The graphics scene maintains a spatial index (BSP tree) of the bounding
+  // rects of all graphics items, which is kept up to date when items are
+  // added, removed or moved. Using it to find candidates is much faster than
+  // checking the grab areas of all items of the board.
+  QList<BI_Base*> items;
+  foreach (const QGraphicsItem* graphicsItem,
+           mGraphicsScene->items(pos.toPxQPointF(),
+                                 Qt::IntersectsItemBoundingRect,
+                                 Qt::DescendingOrder)) {
+    if (BI_Base* item = mItemsByGraphicsItem.value(graphicsItem)) {
+      items.append(item);
+    }
+  }
+  return items;
+}
+
+template <typename T>
+QList<T*> Board::filterItems(const QList<BI_Base*>& items,
+                             const QPointF&         scenePosPx) noexcept {
+  QList<T*> list;
+  foreach (BI_Base* item, items) {
+    T* typedItem = qobject_cast<T*>(item);
+    if (typedItem && typedItem->isSelectable() &&
+        typedItem->isGrabAreaAtScenePos(scenePosPx)) {
+      list.append(typedItem);
+    }
+  }
+  return list;
+}
+
 void Board::updateIcon() noexcept {
   mIcon = QIcon(mGraphicsScene->toPixmap(QSize(297, 210), Qt::white));
 }
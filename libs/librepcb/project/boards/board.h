@@ -79,6 +79,11 @@ class BoardSelectionQuery;
 /**
  * @brief The Board class represents a PCB of a project and is always part of a
  * circuit
+ *
+ * The methods to get items at a specific position (e.g. #getItemsAtScenePos())
+ * don't iterate over all items of the board. Instead, they use the spatial
+ * index of the graphics scene to find candidates and only check the grab
+ * areas of those. Thus their runtime doesn't grow with the size of the board.
  */
 class Board final : public QObject,
                     public AttributeProvider,
@@ -87,6 +92,9 @@ class Board final : public QObject,
   Q_OBJECT
   DECLARE_ERC_MSG_CLASS_NAME(Board)
 
+  // BI_Base needs to register its graphics item in #mItemsByGraphicsItem
+  friend class BI_Base;
+
 public:
   // Types
 
@@ -225,6 +233,23 @@ public:
   void triggerAirWiresRebuild() noexcept;
   void forceAirWiresRebuild() noexcept;
 
+  // NetLine Update Methods
+  /**
+   * @brief Defer updating net lines when their anchors are moved
+   *
+   * While moving many items at once (e.g. dragging a selection), net lines
+   * would otherwise be updated every time one of their anchors moves. Between
+   * #beginDeferredNetLineUpdates() and #endDeferredNetLineUpdates(), net lines
+   * are only scheduled and then updated once when the outermost call of
+   * #endDeferredNetLineUpdates() is made. Calls can be nested.
+   */
+  void beginDeferredNetLineUpdates() noexcept;
+  void endDeferredNetLineUpdates() noexcept;
+  bool scheduleNetLineUpdate(BI_NetLine& netline) noexcept;
+  void unscheduleNetLineUpdate(BI_NetLine& netline) noexcept {
+    mScheduledNetLinesForUpdate.remove(&netline);
+  }
+
   // General Methods
   void addToProject();
   void removeFromProject();
@@ -283,8 +308,12 @@ signals:
 private:
   Board(Project& project, std::unique_ptr<TransactionalDirectory> directory,
         bool create, const QString& newName);
-  void updateIcon() noexcept;
-  void updateErcMessages() noexcept;
+  void            updateIcon() noexcept;
+  void            updateErcMessages() noexcept;
+  QList<BI_Base*> getItemCandidatesAtScenePos(const Point& pos) const noexcept;
+  template <typename T>
+  static QList<T*> filterItems(const QList<BI_Base*>& items,
+                               const QPointF&         scenePosPx) noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -303,6 +332,10 @@ private:
   QRectF                                         mViewRect;
   QSet<NetSignal*> mScheduledNetSignalsForAirWireRebuild;
 
+  // Deferred NetLine Updates (see #beginDeferredNetLineUpdates())
+  int               mDeferNetLineUpdatesCounter;
+  QSet<BI_NetLine*> mScheduledNetLinesForUpdate;
+
   // Attributes
   Uuid        mUuid;
   ElementName mName;
@@ -318,6 +351,9 @@ private:
   QList<BI_Hole*>                     mHoles;
   QMultiHash<NetSignal*, BI_AirWire*> mAirWires;
 
+  /// All items which are added to the graphics scene, by their graphics item
+  QHash<const QGraphicsItem*, BI_Base*> mItemsByGraphicsItem;
+
   // ERC messages
   QHash<Uuid, ErcMsg*> mErcMsgListUnplacedComponentInstances;
 };
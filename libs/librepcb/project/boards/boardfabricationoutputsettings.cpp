@@ -56,8 +56,10 @@ BoardFabricationOutputSettings::BoardFabricationOutputSettings() noexcept
     mSilkscreenLayersBot(
         {GraphicsLayer::sBotPlacement, GraphicsLayer::sBotNames}),
     mMergeDrillFiles(false),
+    mOptimizeDrillPaths(false),
     mEnableSolderPasteTop(false),
-    mEnableSolderPasteBot(false) {
+    mEnableSolderPasteBot(false),
+    mOptimizeGerberFiles(false) {
 }
 
 BoardFabricationOutputSettings::BoardFabricationOutputSettings(
@@ -90,6 +92,13 @@ BoardFabricationOutputSettings::BoardFabricationOutputSettings(
   mMergeDrillFiles      = node.getValueByPath<bool>("drills/merge");
   mEnableSolderPasteTop = node.getValueByPath<bool>("solderpaste_top/create");
   mEnableSolderPasteBot = node.getValueByPath<bool>("solderpaste_bot/create");
+  if (const SExpression* child =
+          node.tryGetChildByPath("drills/optimize_path")) {
+    mOptimizeDrillPaths = child->getValueOfFirstChild<bool>();
+  }
+  if (const SExpression* child = node.tryGetChildByPath("optimize_gerber")) {
+    mOptimizeGerberFiles = child->getValueOfFirstChild<bool>();
+  }
 
   mSilkscreenLayersTop.clear();
   foreach (const SExpression& child,
@@ -145,6 +154,9 @@ void BoardFabricationOutputSettings::serialize(SExpression& root) const {
   drills.appendChild("suffix_pth", mSuffixDrillsPth, true);
   drills.appendChild("suffix_npth", mSuffixDrillsNpth, true);
   drills.appendChild("suffix_merged", mSuffixDrills, true);
+  if (mOptimizeDrillPaths) {  // optional, only written if enabled
+    drills.appendChild("optimize_path", mOptimizeDrillPaths, true);
+  }
 
   SExpression& solderPasteTop = root.appendList("solderpaste_top", true);
   solderPasteTop.appendChild("create", mEnableSolderPasteTop, false);
@@ -153,6 +165,11 @@ void BoardFabricationOutputSettings::serialize(SExpression& root) const {
   SExpression& solderPasteBot = root.appendList("solderpaste_bot", true);
   solderPasteBot.appendChild("create", mEnableSolderPasteBot, false);
   solderPasteBot.appendChild("suffix", mSuffixSolderPasteBot, false);
+
+  // optional, only written if enabled to keep existing files unmodified
+  if (mOptimizeGerberFiles) {
+    root.appendChild("optimize_gerber", mOptimizeGerberFiles, true);
+  }
 }
 
 /*******************************************************************************
@@ -178,8 +195,10 @@ BoardFabricationOutputSettings& BoardFabricationOutputSettings::operator=(
   mSilkscreenLayersTop  = rhs.mSilkscreenLayersTop;
   mSilkscreenLayersBot  = rhs.mSilkscreenLayersBot;
   mMergeDrillFiles      = rhs.mMergeDrillFiles;
+  mOptimizeDrillPaths   = rhs.mOptimizeDrillPaths;
   mEnableSolderPasteTop = rhs.mEnableSolderPasteTop;
   mEnableSolderPasteBot = rhs.mEnableSolderPasteBot;
+  mOptimizeGerberFiles  = rhs.mOptimizeGerberFiles;
   return *this;
 }
 
@@ -202,8 +221,10 @@ bool BoardFabricationOutputSettings::operator==(
   if (mSilkscreenLayersTop != rhs.mSilkscreenLayersTop) return false;
   if (mSilkscreenLayersBot != rhs.mSilkscreenLayersBot) return false;
   if (mMergeDrillFiles != rhs.mMergeDrillFiles) return false;
+  if (mOptimizeDrillPaths != rhs.mOptimizeDrillPaths) return false;
   if (mEnableSolderPasteTop != rhs.mEnableSolderPasteTop) return false;
   if (mEnableSolderPasteBot != rhs.mEnableSolderPasteBot) return false;
+  if (mOptimizeGerberFiles != rhs.mOptimizeGerberFiles) return false;
   return true;
 }
 
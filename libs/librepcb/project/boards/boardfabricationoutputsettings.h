@@ -93,12 +93,14 @@ public:
     return mSilkscreenLayersBot;
   }
   bool getMergeDrillFiles() const noexcept { return mMergeDrillFiles; }
+  bool getOptimizeDrillPaths() const noexcept { return mOptimizeDrillPaths; }
   bool getEnableSolderPasteTop() const noexcept {
     return mEnableSolderPasteTop;
   }
   bool getEnableSolderPasteBot() const noexcept {
     return mEnableSolderPasteBot;
   }
+  bool getOptimizeGerberFiles() const noexcept { return mOptimizeGerberFiles; }
 
   // Setters
   void setOutputBasePath(const QString& p) noexcept { mOutputBasePath = p; }
@@ -136,8 +138,10 @@ public:
     mSilkscreenLayersBot = l;
   }
   void setMergeDrillFiles(bool m) noexcept { mMergeDrillFiles = m; }
+  void setOptimizeDrillPaths(bool o) noexcept { mOptimizeDrillPaths = o; }
   void setEnableSolderPasteTop(bool e) noexcept { mEnableSolderPasteTop = e; }
   void setEnableSolderPasteBot(bool e) noexcept { mEnableSolderPasteBot = e; }
+  void setOptimizeGerberFiles(bool o) noexcept { mOptimizeGerberFiles = o; }
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -168,8 +172,10 @@ private:  // Data
   QStringList mSilkscreenLayersTop;
   QStringList mSilkscreenLayersBot;
   bool        mMergeDrillFiles;
+  bool        mOptimizeDrillPaths;
   bool        mEnableSolderPasteTop;
   bool        mEnableSolderPasteBot;
+  bool        mOptimizeGerberFiles;
 };
 
 /*******************************************************************************
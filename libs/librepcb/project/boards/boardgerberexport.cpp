@@ -48,6 +48,7 @@
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/library/pkg/footprintpad.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -65,7 +66,12 @@ BoardGerberExport::BoardGerberExport(
   : mProject(board.getProject()),
     mBoard(board),
     mSettings(new BoardFabricationOutputSettings(settings)),
-    mCurrentInnerCopperLayer(0) {
+    mCurrentInnerCopperLayer(0),
+    mWrittenFiles(),
+    mPrimitives(),
+    mParallelExport(true),
+    mReportMutex(),
+    mOptimizationReport() {
 }
 
 BoardGerberExport::~BoardGerberExport() noexcept {
@@ -79,33 +85,88 @@ FilePath BoardGerberExport::getOutputDirectory() const noexcept {
   return getOutputFilePath("dummy").getParentDir();  // use dummy suffix
 }
 
+BoardGerberExport::OptimizationReport BoardGerberExport::getOptimizationReport()
+    const noexcept {
+  QMutexLocker lock(&mReportMutex);
+  return mOptimizationReport;
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
 
 void BoardGerberExport::exportAllLayers() const {
   mWrittenFiles.clear();
+  mOptimizationReport = OptimizationReport();
+
+  // Note: The output file paths are determined here (not in the jobs) because
+  // the attribute substitution depends on mCurrentInnerCopperLayer.
+  QVector<ExportJob> jobs;
+  auto addJob = [&](const QString& suffix,
+                    std::function<bool(const FilePath&)> exporter) {
+    FilePath fp = getOutputFilePath(suffix);
+    jobs.append(ExportJob{fp, [fp, exporter]() { return exporter(fp); }});
+  };
+  auto addVoidJob = [&](const QString&                       suffix,
+                        std::function<void(const FilePath&)> exporter) {
+    addJob(suffix, [exporter](const FilePath& fp) -> bool {
+      exporter(fp);
+      return true;
+    });
+  };
+  using namespace std::placeholders;
 
   if (mSettings->getMergeDrillFiles()) {
-    exportDrills();
+    addVoidJob(mSettings->getSuffixDrills(),
+               std::bind(&BoardGerberExport::exportDrills, this, _1));
   } else {
-    exportDrillsNpth();
-    exportDrillsPth();
-  }
-  exportLayerBoardOutlines();
-  exportLayerTopCopper();
-  exportLayerInnerCopper();
-  exportLayerBottomCopper();
-  exportLayerTopSolderMask();
-  exportLayerBottomSolderMask();
-  exportLayerTopSilkscreen();
-  exportLayerBottomSilkscreen();
+    addJob(mSettings->getSuffixDrillsNpth(),
+           std::bind(&BoardGerberExport::exportDrillsNpth, this, _1));
+    addVoidJob(mSettings->getSuffixDrillsPth(),
+               std::bind(&BoardGerberExport::exportDrillsPth, this, _1));
+  }
+  addVoidJob(mSettings->getSuffixOutlines(),
+             std::bind(&BoardGerberExport::exportLayerBoardOutlines, this, _1));
+  addVoidJob(mSettings->getSuffixCopperTop(),
+             std::bind(&BoardGerberExport::exportLayerTopCopper, this, _1));
+  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
+    mCurrentInnerCopperLayer = i;  // used for attribute provider
+    addVoidJob(
+        mSettings->getSuffixCopperInner(),
+        std::bind(&BoardGerberExport::exportLayerInnerCopper, this, _1, i));
+  }
+  mCurrentInnerCopperLayer = 0;
+  addVoidJob(mSettings->getSuffixCopperBot(),
+             std::bind(&BoardGerberExport::exportLayerBottomCopper, this, _1));
+  addVoidJob(mSettings->getSuffixSolderMaskTop(),
+             std::bind(&BoardGerberExport::exportLayerTopSolderMask, this, _1));
+  addVoidJob(
+      mSettings->getSuffixSolderMaskBot(),
+      std::bind(&BoardGerberExport::exportLayerBottomSolderMask, this, _1));
+  // don't create silkscreen files if no layers selected
+  if (mSettings->getSilkscreenLayersTop().count() > 0) {
+    addVoidJob(
+        mSettings->getSuffixSilkscreenTop(),
+        std::bind(&BoardGerberExport::exportLayerTopSilkscreen, this, _1));
+  }
+  if (mSettings->getSilkscreenLayersBot().count() > 0) {
+    addVoidJob(
+        mSettings->getSuffixSilkscreenBot(),
+        std::bind(&BoardGerberExport::exportLayerBottomSilkscreen, this, _1));
+  }
   if (mSettings->getEnableSolderPasteTop()) {
-    exportLayerTopSolderPaste();
+    addVoidJob(
+        mSettings->getSuffixSolderPasteTop(),
+        std::bind(&BoardGerberExport::exportLayerTopSolderPaste, this, _1));
   }
   if (mSettings->getEnableSolderPasteBot()) {
-    exportLayerBottomSolderPaste();
+    addVoidJob(
+        mSettings->getSuffixSolderPasteBot(),
+        std::bind(&BoardGerberExport::exportLayerBottomSolderPaste, this, _1));
   }
+
+  collectPrimitives();
+  runJobs(jobs);  // can throw
 }
 
 /*******************************************************************************
@@ -130,18 +191,125 @@ BoardGerberExport::getAttributeProviderParents() const noexcept {
  *  Private Methods
  ******************************************************************************/
 
-void BoardGerberExport::exportDrills() const {
-  FilePath          fp = getOutputFilePath(mSettings->getSuffixDrills());
+void BoardGerberExport::runJobs(const QVector<ExportJob>& jobs) const {
+  QVector<bool> written(jobs.count(), false);
+  if (mParallelExport) {
+    QList<QFuture<bool>> futures;
+    foreach (const ExportJob& job, jobs) {
+      futures.append(QtConcurrent::run(job.exporter));
+    }
+    // Wait for *all* jobs before throwing since they access this object.
+    // If several jobs failed, the error of the first job is reported.
+    QScopedPointer<Exception> error;
+    for (int i = 0; i < futures.count(); ++i) {
+      try {
+        written[i] = futures[i].result();  // can throw
+      } catch (const Exception& e) {
+        if (!error) error.reset(e.clone());
+      }
+    }
+    if (error) error->raise();
+  } else {
+    for (int i = 0; i < jobs.count(); ++i) {
+      written[i] = jobs.at(i).exporter();  // can throw
+    }
+  }
+  for (int i = 0; i < jobs.count(); ++i) {
+    if (written.at(i)) {
+      mWrittenFiles.append(jobs.at(i).filePath);
+    }
+  }
+}
+
+void BoardGerberExport::collectPrimitives() const noexcept {
+  LayerPrimitives* primitives = new LayerPrimitives();
+  QStringList      layerNames;
+  foreach (const GraphicsLayer* layer, mBoard.getLayerStack().getAllLayers()) {
+    layerNames.append(layer->getName());
+  }
+  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+    Q_ASSERT(device);
+    const BI_Footprint&                 footprint = device->getFootprint();
+    QHash<QString, FootprintPrimitives> items;
+    auto getItems = [&](const QString& layer) -> FootprintPrimitives& {
+      auto it = items.find(layer);
+      if (it == items.end()) {
+        it            = items.insert(layer, FootprintPrimitives());
+        it->footprint = &footprint;
+      }
+      return *it;
+    };
+    foreach (const BI_FootprintPad* pad, footprint.getPads()) {
+      Q_ASSERT(pad);
+      foreach (const QString& layer, layerNames) {
+        if (isFootprintPadOnLayer(*pad, layer)) {
+          getItems(layer).pads.append(pad);
+        }
+      }
+    }
+    // polygons and circles are on layers of the library footprint, which
+    // are mirrored if the footprint is mirrored
+    for (const Polygon& polygon :
+         footprint.getLibFootprint().getPolygons().sortedByUuid()) {
+      QString layer = footprint.getIsMirrored()
+                          ? GraphicsLayer::getMirroredLayerName(
+                                *polygon.getLayerName())
+                          : *polygon.getLayerName();
+      getItems(layer).polygons.append(&polygon);
+    }
+    for (const Circle& circle :
+         footprint.getLibFootprint().getCircles().sortedByUuid()) {
+      QString layer = footprint.getIsMirrored()
+                          ? GraphicsLayer::getMirroredLayerName(
+                                *circle.getLayerName())
+                          : *circle.getLayerName();
+      getItems(layer).circles.append(&circle);
+    }
+    foreach (const BI_StrokeText* text,
+             sortedByUuid(footprint.getStrokeTexts())) {
+      Q_ASSERT(text);
+      getItems(*text->getText().getLayerName()).strokeTexts.append(text);
+    }
+    for (auto it = items.constBegin(); it != items.constEnd(); ++it) {
+      primitives->footprints[it.key()].append(it.value());
+    }
+  }
+  foreach (const BI_NetSegment* netsegment,
+           sortedByUuid(mBoard.getNetSegments())) {
+    Q_ASSERT(netsegment);
+    foreach (const BI_Via* via, sortedByUuid(netsegment->getVias())) {
+      Q_ASSERT(via);
+      primitives->vias.append(via);
+    }
+    foreach (const BI_NetLine* netline,
+             sortedByUuid(netsegment->getNetLines())) {
+      Q_ASSERT(netline);
+      primitives->netLines[netline->getLayer().getName()].append(netline);
+    }
+  }
+  foreach (const BI_Plane* plane, sortedByUuid(mBoard.getPlanes())) {
+    Q_ASSERT(plane);
+    primitives->planes[*plane->getLayerName()].append(plane);
+  }
+  foreach (const BI_Polygon* polygon, sortedByUuid(mBoard.getPolygons())) {
+    Q_ASSERT(polygon);
+    primitives->polygons[*polygon->getPolygon().getLayerName()].append(polygon);
+  }
+  foreach (const BI_StrokeText* text, sortedByUuid(mBoard.getStrokeTexts())) {
+    Q_ASSERT(text);
+    primitives->strokeTexts[*text->getText().getLayerName()].append(text);
+  }
+  mPrimitives.reset(primitives);
+}
+
+void BoardGerberExport::exportDrills(const FilePath& fp) const {
   ExcellonGenerator gen;
   drawPthDrills(gen);
   drawNpthDrills(gen);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveDrills(gen, fp);
 }
 
-void BoardGerberExport::exportDrillsNpth() const {
-  FilePath          fp = getOutputFilePath(mSettings->getSuffixDrillsNpth());
+bool BoardGerberExport::exportDrillsNpth(const FilePath& fp) const {
   ExcellonGenerator gen;
   int               count = drawNpthDrills(gen);
   if (count > 0) {
@@ -149,145 +317,127 @@ void BoardGerberExport::exportDrillsNpth() const {
     // and NPTH. As many boards don't have non-plated holes anyway, we create
     // this file only if it's really needed. Maybe this avoids unnecessary
     // issues with manufacturers...
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
+    saveDrills(gen, fp);
+    return true;
+  } else {
+    return false;
   }
 }
 
-void BoardGerberExport::exportDrillsPth() const {
-  FilePath          fp = getOutputFilePath(mSettings->getSuffixDrillsPth());
+void BoardGerberExport::exportDrillsPth(const FilePath& fp) const {
   ExcellonGenerator gen;
   drawPthDrills(gen);
-  gen.generate();
-  gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+  saveDrills(gen, fp);
 }
 
-void BoardGerberExport::exportLayerBoardOutlines() const {
-  FilePath        fp = getOutputFilePath(mSettings->getSuffixOutlines());
+void BoardGerberExport::exportLayerBoardOutlines(const FilePath& fp) const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBoardOutlines);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
 }
 
-void BoardGerberExport::exportLayerTopCopper() const {
-  FilePath        fp = getOutputFilePath(mSettings->getSuffixCopperTop());
+void BoardGerberExport::exportLayerTopCopper(const FilePath& fp) const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sTopCopper);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
 }
 
-void BoardGerberExport::exportLayerBottomCopper() const {
-  FilePath        fp = getOutputFilePath(mSettings->getSuffixCopperBot());
+void BoardGerberExport::exportLayerBottomCopper(const FilePath& fp) const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBotCopper);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
 }
 
-void BoardGerberExport::exportLayerInnerCopper() const {
-  for (int i = 1; i <= mBoard.getLayerStack().getInnerLayerCount(); ++i) {
-    mCurrentInnerCopperLayer = i;  // used for attribute provider
-    FilePath        fp = getOutputFilePath(mSettings->getSuffixCopperInner());
-    GerberGenerator gen(
-        mProject.getMetadata().getName() % " - " % mBoard.getName(),
-        mBoard.getUuid(), mProject.getMetadata().getVersion());
-    drawLayer(gen, GraphicsLayer::getInnerLayerName(i));
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
-  mCurrentInnerCopperLayer = 0;
+void BoardGerberExport::exportLayerInnerCopper(const FilePath& fp,
+                                               int             number) const {
+  GerberGenerator gen(
+      mProject.getMetadata().getName() % " - " % mBoard.getName(),
+      mBoard.getUuid(), mProject.getMetadata().getVersion());
+  drawLayer(gen, GraphicsLayer::getInnerLayerName(number));
+  gen.generate();
+  gen.saveToFile(fp);
 }
 
-void BoardGerberExport::exportLayerTopSolderMask() const {
-  FilePath        fp = getOutputFilePath(mSettings->getSuffixSolderMaskTop());
+void BoardGerberExport::exportLayerTopSolderMask(const FilePath& fp) const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sTopStopMask);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
 }
 
-void BoardGerberExport::exportLayerBottomSolderMask() const {
-  FilePath        fp = getOutputFilePath(mSettings->getSuffixSolderMaskBot());
+void BoardGerberExport::exportLayerBottomSolderMask(const FilePath& fp) const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBotStopMask);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
-}
-
-void BoardGerberExport::exportLayerTopSilkscreen() const {
-  QStringList layers = mSettings->getSilkscreenLayersTop();
-  if (layers.count() >
-      0) {  // don't create silkscreen file if no layers selected
-    FilePath        fp = getOutputFilePath(mSettings->getSuffixSilkscreenTop());
-    GerberGenerator gen(
-        mProject.getMetadata().getName() % " - " % mBoard.getName(),
-        mBoard.getUuid(), mProject.getMetadata().getVersion());
-    foreach (const QString& layer, layers) { drawLayer(gen, layer); }
-    gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-    drawLayer(gen, GraphicsLayer::sTopStopMask);
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
-}
-
-void BoardGerberExport::exportLayerBottomSilkscreen() const {
-  QStringList layers = mSettings->getSilkscreenLayersBot();
-  if (layers.count() >
-      0) {  // don't create silkscreen file if no layers selected
-    FilePath        fp = getOutputFilePath(mSettings->getSuffixSilkscreenBot());
-    GerberGenerator gen(
-        mProject.getMetadata().getName() % " - " % mBoard.getName(),
-        mBoard.getUuid(), mProject.getMetadata().getVersion());
-    foreach (const QString& layer, layers) { drawLayer(gen, layer); }
-    gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
-    drawLayer(gen, GraphicsLayer::sBotStopMask);
-    gen.generate();
-    gen.saveToFile(fp);
-    mWrittenFiles.append(fp);
-  }
-}
-
-void BoardGerberExport::exportLayerTopSolderPaste() const {
-  FilePath        fp = getOutputFilePath(mSettings->getSuffixSolderPasteTop());
+}
+
+void BoardGerberExport::exportLayerTopSilkscreen(const FilePath& fp) const {
+  GerberGenerator gen(
+      mProject.getMetadata().getName() % " - " % mBoard.getName(),
+      mBoard.getUuid(), mProject.getMetadata().getVersion());
+  foreach (const QString& layer, mSettings->getSilkscreenLayersTop()) {
+    drawLayer(gen, layer);
+  }
+  gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
+  drawLayer(gen, GraphicsLayer::sTopStopMask);
+  gen.generate();
+  gen.saveToFile(fp);
+}
+
+void BoardGerberExport::exportLayerBottomSilkscreen(const FilePath& fp) const {
+  GerberGenerator gen(
+      mProject.getMetadata().getName() % " - " % mBoard.getName(),
+      mBoard.getUuid(), mProject.getMetadata().getVersion());
+  foreach (const QString& layer, mSettings->getSilkscreenLayersBot()) {
+    drawLayer(gen, layer);
+  }
+  gen.setLayerPolarity(GerberGenerator::LayerPolarity::Negative);
+  drawLayer(gen, GraphicsLayer::sBotStopMask);
+  gen.generate();
+  gen.saveToFile(fp);
+}
+
+void BoardGerberExport::exportLayerTopSolderPaste(const FilePath& fp) const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sTopSolderPaste);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
 }
 
-void BoardGerberExport::exportLayerBottomSolderPaste() const {
-  FilePath        fp = getOutputFilePath(mSettings->getSuffixSolderPasteBot());
+void BoardGerberExport::exportLayerBottomSolderPaste(const FilePath& fp) const {
   GerberGenerator gen(
       mProject.getMetadata().getName() % " - " % mBoard.getName(),
       mBoard.getUuid(), mProject.getMetadata().getVersion());
   drawLayer(gen, GraphicsLayer::sBotSolderPaste);
   gen.generate();
   gen.saveToFile(fp);
-  mWrittenFiles.append(fp);
+}
+
+void BoardGerberExport::saveDrills(ExcellonGenerator& gen,
+                                   const FilePath&    fp) const {
+  gen.setDrillPathOptimizationEnabled(mSettings->getOptimizeDrillPaths());
+  gen.generate();
+  gen.saveToFile(fp);
+  if (gen.isDrillPathOptimizationEnabled()) {
+    QMutexLocker lock(&mReportMutex);  // files are exported concurrently
+    mOptimizationReport.drills += gen.getDrillPathReport();
+  }
 }
 
 int BoardGerberExport::drawNpthDrills(ExcellonGenerator& gen) const {
@@ -328,12 +478,9 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const {
   }
 
   // vias
-  foreach (const BI_NetSegment* netsegment,
-           sortedByUuid(mBoard.getNetSegments())) {
-    foreach (const BI_Via* via, sortedByUuid(netsegment->getVias())) {
-      gen.drill(via->getPosition(), via->getDrillDiameter());
-      ++count;
-    }
+  foreach (const BI_Via* via, mPrimitives->vias) {
+    gen.drill(via->getPosition(), via->getDrillDiameter());
+    ++count;
   }
 
   return count;
@@ -341,77 +488,68 @@ int BoardGerberExport::drawPthDrills(ExcellonGenerator& gen) const {
 
 void BoardGerberExport::drawLayer(GerberGenerator& gen,
                                   const QString&   layerName) const {
+  bool                  optimize = mSettings->getOptimizeGerberFiles();
+  GerberRegionOptimizer optimizer;
+  int                   mergedFlashes = gen.getMergedFlashCount();
+  gen.setFlashMergingEnabled(optimize);
+
   // draw footprints incl. pads
-  foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
-    Q_ASSERT(device);
-    drawFootprint(gen, device->getFootprint(), layerName);
+  foreach (const FootprintPrimitives& items,
+           mPrimitives->footprints.value(layerName)) {
+    drawFootprint(gen, items, layerName);
   }
 
   // draw vias
-  foreach (const BI_NetSegment* netsegment,
-           sortedByUuid(mBoard.getNetSegments())) {
-    Q_ASSERT(netsegment);
-    foreach (const BI_Via* via, sortedByUuid(netsegment->getVias())) {
-      Q_ASSERT(via);
-      drawVia(gen, *via, layerName);
-    }
+  foreach (const BI_Via* via, mPrimitives->vias) {
+    drawVia(gen, *via, layerName);
   }
 
   // draw traces
-  foreach (const BI_NetSegment* netsegment,
-           sortedByUuid(mBoard.getNetSegments())) {
-    Q_ASSERT(netsegment);
-    foreach (const BI_NetLine* netline,
-             sortedByUuid(netsegment->getNetLines())) {
-      Q_ASSERT(netline);
-      if (netline->getLayer().getName() == layerName) {
-        gen.drawLine(netline->getStartPoint().getPosition(),
-                     netline->getEndPoint().getPosition(),
-                     positiveToUnsigned(netline->getWidth()));
-      }
-    }
+  foreach (const BI_NetLine* netline, mPrimitives->netLines.value(layerName)) {
+    gen.drawLine(netline->getStartPoint().getPosition(),
+                 netline->getEndPoint().getPosition(),
+                 positiveToUnsigned(netline->getWidth()));
   }
 
   // draw planes
-  foreach (const BI_Plane* plane, sortedByUuid(mBoard.getPlanes())) {
-    Q_ASSERT(plane);
-    if (plane->getLayerName() == layerName) {
-      foreach (const Path& fragment, plane->getFragments()) {
-        gen.drawPathArea(fragment);
-      }
+  foreach (const BI_Plane* plane, mPrimitives->planes.value(layerName)) {
+    foreach (const Path& fragment, plane->getFragments()) {
+      gen.drawPathArea(optimize ? optimizer.optimize(fragment) : fragment);
     }
   }
 
   // draw polygons
-  foreach (const BI_Polygon* polygon, sortedByUuid(mBoard.getPolygons())) {
-    Q_ASSERT(polygon);
-    if (layerName == polygon->getPolygon().getLayerName()) {
-      UnsignedLength lineWidth =
-          calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerName);
-      gen.drawPathOutline(polygon->getPolygon().getPath(), lineWidth);
-      // Only fill closed paths (for consistency with the appearance in the
-      // board editor, and because Gerber expects area outlines as closed).
-      if (polygon->getPolygon().isFilled() &&
-          polygon->getPolygon().getPath().isClosed()) {
-        gen.drawPathArea(polygon->getPolygon().getPath());
-      }
+  foreach (const BI_Polygon* polygon, mPrimitives->polygons.value(layerName)) {
+    UnsignedLength lineWidth =
+        calcWidthOfLayer(polygon->getPolygon().getLineWidth(), layerName);
+    gen.drawPathOutline(polygon->getPolygon().getPath(), lineWidth);
+    // Only fill closed paths (for consistency with the appearance in the
+    // board editor, and because Gerber expects area outlines as closed).
+    if (polygon->getPolygon().isFilled() &&
+        polygon->getPolygon().getPath().isClosed()) {
+      gen.drawPathArea(polygon->getPolygon().getPath());
     }
   }
 
   // draw stroke texts
-  foreach (const BI_StrokeText* text, sortedByUuid(mBoard.getStrokeTexts())) {
-    Q_ASSERT(text);
-    if (layerName == text->getText().getLayerName()) {
-      UnsignedLength lineWidth =
-          calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
-      foreach (Path path, text->getText().getPaths()) {
-        path.rotate(text->getText().getRotation());
-        if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
-        path.translate(text->getText().getPosition());
-        gen.drawPathOutline(path, lineWidth);
-      }
+  foreach (const BI_StrokeText* text,
+           mPrimitives->strokeTexts.value(layerName)) {
+    UnsignedLength lineWidth =
+        calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
+    foreach (Path path, text->getText().getPaths()) {
+      path.rotate(text->getText().getRotation());
+      if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
+      path.translate(text->getText().getPosition());
+      gen.drawPathOutline(path, lineWidth);
     }
   }
+
+  if (optimize) {
+    QMutexLocker lock(&mReportMutex);  // layers are drawn concurrently
+    mOptimizationReport.regions += optimizer.getReport();
+    mOptimizationReport.mergedFlashes +=
+        gen.getMergedFlashCount() - mergedFlashes;
+  }
 }
 
 void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via,
@@ -447,68 +585,57 @@ void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via,
   }
 }
 
-void BoardGerberExport::drawFootprint(GerberGenerator&    gen,
-                                      const BI_Footprint& footprint,
-                                      const QString&      layerName) const {
+void BoardGerberExport::drawFootprint(GerberGenerator&           gen,
+                                      const FootprintPrimitives& items,
+                                      const QString& layerName) const {
+  const BI_Footprint& footprint = *items.footprint;
+
   // draw pads
-  foreach (const BI_FootprintPad* pad, footprint.getPads()) {
+  foreach (const BI_FootprintPad* pad, items.pads) {
     drawFootprintPad(gen, *pad, layerName);
   }
 
   // draw polygons
-  for (const Polygon& polygon :
-       footprint.getLibFootprint().getPolygons().sortedByUuid()) {
-    QString layer = footprint.getIsMirrored()
-                        ? GraphicsLayer::getMirroredLayerName(layerName)
-                        : layerName;
-    if (layer == polygon.getLayerName()) {
-      Path path = polygon.getPath();
-      path.rotate(footprint.getRotation());
-      if (footprint.getIsMirrored()) path.mirror(Qt::Horizontal);
-      path.translate(footprint.getPosition());
-      gen.drawPathOutline(path,
-                          calcWidthOfLayer(polygon.getLineWidth(), layer));
-      // Only fill closed paths (for consistency with the appearance in the
-      // board editor, and because Gerber expects area outlines as closed).
-      if (polygon.isFilled() && path.isClosed()) {
-        gen.drawPathArea(path);
-      }
+  QString layer = footprint.getIsMirrored()
+                      ? GraphicsLayer::getMirroredLayerName(layerName)
+                      : layerName;
+  foreach (const Polygon* polygon, items.polygons) {
+    Path path = polygon->getPath();
+    path.rotate(footprint.getRotation());
+    if (footprint.getIsMirrored()) path.mirror(Qt::Horizontal);
+    path.translate(footprint.getPosition());
+    gen.drawPathOutline(path, calcWidthOfLayer(polygon->getLineWidth(), layer));
+    // Only fill closed paths (for consistency with the appearance in the
+    // board editor, and because Gerber expects area outlines as closed).
+    if (polygon->isFilled() && path.isClosed()) {
+      gen.drawPathArea(path);
     }
   }
 
   // draw circles
-  for (const Circle& circle :
-       footprint.getLibFootprint().getCircles().sortedByUuid()) {
-    QString layer = footprint.getIsMirrored()
-                        ? GraphicsLayer::getMirroredLayerName(layerName)
-                        : layerName;
-    if (layer == circle.getLayerName()) {
-      Circle copy        = circle;
-      Point  absolutePos = copy.getCenter();
-      absolutePos.rotate(footprint.getRotation());
-      if (footprint.getIsMirrored()) absolutePos.mirror(Qt::Horizontal);
-      absolutePos += footprint.getPosition();
-      copy.setCenter(absolutePos);
-      copy.setLineWidth(calcWidthOfLayer(copy.getLineWidth(), layer));
-      gen.drawCircleOutline(copy);
-      if (copy.isFilled()) {
-        gen.drawCircleArea(copy);
-      }
+  foreach (const Circle* circle, items.circles) {
+    Circle copy        = *circle;
+    Point  absolutePos = copy.getCenter();
+    absolutePos.rotate(footprint.getRotation());
+    if (footprint.getIsMirrored()) absolutePos.mirror(Qt::Horizontal);
+    absolutePos += footprint.getPosition();
+    copy.setCenter(absolutePos);
+    copy.setLineWidth(calcWidthOfLayer(copy.getLineWidth(), layer));
+    gen.drawCircleOutline(copy);
+    if (copy.isFilled()) {
+      gen.drawCircleArea(copy);
     }
   }
 
   // draw stroke texts (from footprint instance, *NOT* from library footprint!)
-  foreach (const BI_StrokeText* text,
-           sortedByUuid(footprint.getStrokeTexts())) {
-    if (layerName == text->getText().getLayerName()) {
-      UnsignedLength lineWidth =
-          calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
-      foreach (Path path, text->getText().getPaths()) {
-        path.rotate(text->getText().getRotation());
-        if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
-        path.translate(text->getPosition());
-        gen.drawPathOutline(path, lineWidth);
-      }
+  foreach (const BI_StrokeText* text, items.strokeTexts) {
+    UnsignedLength lineWidth =
+        calcWidthOfLayer(text->getText().getStrokeWidth(), layerName);
+    foreach (Path path, text->getText().getPaths()) {
+      path.rotate(text->getText().getRotation());
+      if (text->getText().getMirrored()) path.mirror(Qt::Horizontal);
+      path.translate(text->getPosition());
+      gen.drawPathOutline(path, lineWidth);
     }
   }
 }
@@ -609,6 +736,20 @@ FilePath BoardGerberExport::getOutputFilePath(const QString& suffix) const
  *  Static Methods
  ******************************************************************************/
 
+bool BoardGerberExport::isFootprintPadOnLayer(
+    const BI_FootprintPad& pad, const QString& layerName) noexcept {
+  // must be consistent with the layers drawFootprintPad() draws on
+  bool isSmt =
+      pad.getLibPad().getBoardSide() != library::FootprintPad::BoardSide::THT;
+  bool isOnTop = pad.isOnLayer(GraphicsLayer::sTopCopper);
+  bool isOnBot = pad.isOnLayer(GraphicsLayer::sBotCopper);
+  return pad.isOnLayer(layerName) ||
+         (isOnTop && (layerName == GraphicsLayer::sTopStopMask)) ||
+         (isOnBot && (layerName == GraphicsLayer::sBotStopMask)) ||
+         (isSmt && isOnTop && (layerName == GraphicsLayer::sTopSolderPaste)) ||
+         (isSmt && isOnBot && (layerName == GraphicsLayer::sBotSolderPaste));
+}
+
 UnsignedLength BoardGerberExport::calcWidthOfLayer(
     const UnsignedLength& width, const QString& name) noexcept {
   if ((name == GraphicsLayer::sBoardOutlines) &&
@@ -24,12 +24,15 @@
  *  Includes
  ******************************************************************************/
 #include <librepcb/common/attributes/attributeprovider.h>
+#include <librepcb/common/cam/drillpathoptimizer.h>
+#include <librepcb/common/cam/gerberregionoptimizer.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/units/all_length_units.h>
 
 #include <QtCore>
 
 #include <algorithm>
+#include <functional>
 
 /*******************************************************************************
  *  Namespace / Forward Declarations
@@ -46,6 +49,10 @@ namespace project {
 class Project;
 class Board;
 class BI_Via;
+class BI_NetLine;
+class BI_Plane;
+class BI_Polygon;
+class BI_StrokeText;
 class BI_Footprint;
 class BI_FootprintPad;
 class BoardFabricationOutputSettings;
@@ -56,11 +63,31 @@ class BoardFabricationOutputSettings;
 
 /**
  * @brief The BoardGerberExport class
+ *
+ * All Gerber and Excellon files are generated concurrently on the global
+ * thread pool. The export only reads the board, which can't be modified in
+ * the meantime because #exportAllLayers() blocks the calling thread until all
+ * files are written. Each file is generated by exactly one job in the same
+ * order as in a serial export, so the output is identical.
+ *
+ * If enabled in the ::librepcb::project::BoardFabricationOutputSettings, the
+ * Gerber files are optimized for size: plane fragments are compacted with
+ * ::librepcb::GerberRegionOptimizer and identical flashes are merged. In
+ * addition, the drills can be reordered with ::librepcb::DrillPathOptimizer
+ * to reduce the travel distance of the drill head. The effect of all
+ * optimizations is summarized in #getOptimizationReport().
  */
 class BoardGerberExport final : public QObject, public AttributeProvider {
   Q_OBJECT
 
 public:
+  // Types
+  struct OptimizationReport {
+    GerberRegionOptimizer::Report regions;  ///< Plane fragments
+    int                           mergedFlashes = 0;
+    DrillPathOptimizer::Report    drills;  ///< All drill files
+  };
+
   // Constructors / Destructor
   BoardGerberExport()                               = delete;
   BoardGerberExport(const BoardGerberExport& other) = delete;
@@ -73,6 +100,13 @@ public:
   const QVector<FilePath>& getWrittenFiles() const noexcept {
     return mWrittenFiles;
   }
+  bool isParallelExportEnabled() const noexcept { return mParallelExport; }
+  OptimizationReport getOptimizationReport() const noexcept;
+
+  // Setters
+  void setParallelExportEnabled(bool enabled) noexcept {
+    mParallelExport = enabled;
+  }
 
   // General Methods
   void exportAllLayers() const;
@@ -91,30 +125,63 @@ signals:
   void attributesChanged() override;
 
 private:
+  // Types
+  struct ExportJob {
+    FilePath              filePath;
+    std::function<bool()> exporter;  ///< Returns false if nothing was written
+  };
+
+  /**
+   * @brief Board items to export, bucketed by layer name and sorted by UUID
+   *
+   * Collected once per export, so the layer jobs don't need to traverse and
+   * sort all board items again and again.
+   */
+  struct FootprintPrimitives {
+    const BI_Footprint*           footprint;
+    QList<const BI_FootprintPad*> pads;
+    QList<const Polygon*>         polygons;
+    QList<const Circle*>          circles;
+    QList<const BI_StrokeText*>   strokeTexts;
+  };
+  struct LayerPrimitives {
+    QList<const BI_Via*>                        vias;  ///< On all layers
+    QHash<QString, QList<FootprintPrimitives>>  footprints;
+    QHash<QString, QList<const BI_NetLine*>>    netLines;
+    QHash<QString, QList<const BI_Plane*>>      planes;
+    QHash<QString, QList<const BI_Polygon*>>    polygons;
+    QHash<QString, QList<const BI_StrokeText*>> strokeTexts;
+  };
+
   // Private Methods
-  void exportDrills() const;
-  void exportDrillsNpth() const;
-  void exportDrillsPth() const;
-  void exportLayerBoardOutlines() const;
-  void exportLayerTopCopper() const;
-  void exportLayerInnerCopper() const;
-  void exportLayerBottomCopper() const;
-  void exportLayerTopSolderMask() const;
-  void exportLayerBottomSolderMask() const;
-  void exportLayerTopSilkscreen() const;
-  void exportLayerBottomSilkscreen() const;
-  void exportLayerTopSolderPaste() const;
-  void exportLayerBottomSolderPaste() const;
+  void runJobs(const QVector<ExportJob>& jobs) const;
+  void collectPrimitives() const noexcept;
+  void exportDrills(const FilePath& fp) const;
+  bool exportDrillsNpth(const FilePath& fp) const;
+  void exportDrillsPth(const FilePath& fp) const;
+  void exportLayerBoardOutlines(const FilePath& fp) const;
+  void exportLayerTopCopper(const FilePath& fp) const;
+  void exportLayerInnerCopper(const FilePath& fp, int number) const;
+  void exportLayerBottomCopper(const FilePath& fp) const;
+  void exportLayerTopSolderMask(const FilePath& fp) const;
+  void exportLayerBottomSolderMask(const FilePath& fp) const;
+  void exportLayerTopSilkscreen(const FilePath& fp) const;
+  void exportLayerBottomSilkscreen(const FilePath& fp) const;
+  void exportLayerTopSolderPaste(const FilePath& fp) const;
+  void exportLayerBottomSolderPaste(const FilePath& fp) const;
+  void saveDrills(ExcellonGenerator& gen, const FilePath& fp) const;
 
   int  drawNpthDrills(ExcellonGenerator& gen) const;
   int  drawPthDrills(ExcellonGenerator& gen) const;
   void drawLayer(GerberGenerator& gen, const QString& layerName) const;
   void drawVia(GerberGenerator& gen, const BI_Via& via,
                const QString& layerName) const;
-  void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint,
+  void drawFootprint(GerberGenerator& gen, const FootprintPrimitives& items,
                      const QString& layerName) const;
   void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad,
                         const QString& layerName) const;
+  static bool isFootprintPadOnLayer(const BI_FootprintPad& pad,
+                                    const QString&         layerName) noexcept;
 
   FilePath getOutputFilePath(const QString& suffix) const noexcept;
 
@@ -137,6 +204,10 @@ private:
   QScopedPointer<const BoardFabricationOutputSettings> mSettings;
   mutable int                                          mCurrentInnerCopperLayer;
   mutable QVector<FilePath>                            mWrittenFiles;
+  mutable QScopedPointer<const LayerPrimitives>        mPrimitives;
+  bool                                                 mParallelExport;
+  mutable QMutex                                       mReportMutex;
+  mutable OptimizationReport                           mOptimizationReport;
 };
 
 /*******************************************************************************
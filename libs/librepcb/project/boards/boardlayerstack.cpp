@@ -40,6 +40,7 @@ BoardLayerStack::BoardLayerStack(Board& board, const BoardLayerStack& other)
   : QObject(&board),
     mBoard(board),
     mLayersChanged(false),
+    mRenderCache(*this),
     mInnerLayerCount(other.mInnerLayerCount) {
   foreach (const GraphicsLayer* layer, other.mLayers) {
     addLayer(new GraphicsLayer(*layer));
@@ -53,6 +54,7 @@ BoardLayerStack::BoardLayerStack(Board& board, const SExpression& node)
   : QObject(&board),
     mBoard(board),
     mLayersChanged(false),
+    mRenderCache(*this),
     mInnerLayerCount(-1) {
   addAllLayers();
 
@@ -66,6 +68,7 @@ BoardLayerStack::BoardLayerStack(Board& board)
   : QObject(&board),
     mBoard(board),
     mLayersChanged(false),
+    mRenderCache(*this),
     mInnerLayerCount(-1) {
   addAllLayers();
 
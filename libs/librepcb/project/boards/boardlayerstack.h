@@ -26,6 +26,7 @@
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/graphics/graphicsrendercache.h>
 
 #include <QtCore>
 
@@ -60,8 +61,11 @@ public:
   ~BoardLayerStack() noexcept;
 
   // Getters
-  Board& getBoard() const noexcept { return mBoard; }
-  int    getInnerLayerCount() const noexcept { return mInnerLayerCount; }
+  Board&                getBoard() const noexcept { return mBoard; }
+  int                   getInnerLayerCount() const noexcept {
+    return mInnerLayerCount;
+  }
+  GraphicsRenderCache&  getRenderCache() noexcept { return mRenderCache; }
   QList<GraphicsLayer*> getAllowedPolygonLayers() const noexcept;
 
   /// @copydoc ::librepcb::IF_GraphicsLayerProvider::getAllLayers()
@@ -103,6 +107,7 @@ private:
   Board& mBoard;  ///< A reference to the Board object (from the ctor)
   QList<GraphicsLayer*> mLayers;
   bool                  mLayersChanged;
+  GraphicsRenderCache   mRenderCache;  ///< Shared footprint drawings
 
   // Settings
   int mInnerLayerCount;
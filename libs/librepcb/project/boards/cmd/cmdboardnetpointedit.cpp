@@ -78,6 +78,13 @@ void CmdBoardNetPointEdit::rotate(const Angle& angle, const Point& center,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdBoardNetPointEdit::canMergeWith(
+    const UndoCommand& other) const noexcept {
+  const CmdBoardNetPointEdit* cmd =
+      dynamic_cast<const CmdBoardNetPointEdit*>(&other);
+  return cmd && (&cmd->mNetPoint == &mNetPoint) && (cmd->mOldPos == mNewPos);
+}
+
 bool CmdBoardNetPointEdit::performExecute() {
   performRedo();  // can throw
 
@@ -92,6 +99,10 @@ void CmdBoardNetPointEdit::performRedo() {
   mNetPoint.setPosition(mNewPos);
 }
 
+void CmdBoardNetPointEdit::performMerge(const UndoCommand& other) {
+  mNewPos = dynamic_cast<const CmdBoardNetPointEdit&>(other).mNewPos;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
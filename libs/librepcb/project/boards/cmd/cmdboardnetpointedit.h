@@ -54,6 +54,9 @@ public:
   void translate(const Point& deltaPos, bool immediate) noexcept;
   void rotate(const Angle& angle, const Point& center, bool immediate) noexcept;
 
+  /// @copydoc UndoCommand::canMergeWith()
+  bool canMergeWith(const UndoCommand& other) const noexcept override;
+
 private:
   // Private Methods
 
@@ -66,6 +69,9 @@ private:
   /// @copydoc UndoCommand::performRedo()
   void performRedo() override;
 
+  /// @copydoc UndoCommand::performMerge()
+  void performMerge(const UndoCommand& other) override;
+
   // Private Member Variables
 
   // Attributes from the constructor
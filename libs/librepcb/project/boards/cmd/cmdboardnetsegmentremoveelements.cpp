@@ -26,6 +26,7 @@
 #include "../items/bi_netline.h"
 #include "../items/bi_netpoint.h"
 #include "../items/bi_netsegment.h"
+#include "../items/bi_via.h"
 
 #include <QtCore>
 
@@ -47,6 +48,18 @@ CmdBoardNetSegmentRemoveElements::CmdBoardNetSegmentRemoveElements(
 CmdBoardNetSegmentRemoveElements::~CmdBoardNetSegmentRemoveElements() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdBoardNetSegmentRemoveElements::getApproxMemoryUsage() const
+    noexcept {
+  // the removed items are kept alive as long as this command exists
+  return sizeof(*this) + mVias.count() * sizeof(BI_Via) +
+      mNetPoints.count() * sizeof(BI_NetPoint) +
+      mNetLines.count() * sizeof(BI_NetLine);
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -68,6 +68,16 @@ CmdBoardPlaneEdit::~CmdBoardPlaneEdit() noexcept {
   }
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdBoardPlaneEdit::getApproxMemoryUsage() const noexcept {
+  return sizeof(*this) + (mOldOutline.getVertices().capacity() +
+                          mNewOutline.getVertices().capacity()) *
+      sizeof(Vertex);
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -66,6 +66,11 @@ public:
   void setPriority(int priority) noexcept;
   void setKeepOrphans(bool keepOrphans) noexcept;
 
+  // Getters
+
+  /// @copydoc UndoCommand::getApproxMemoryUsage()
+  qint64 getApproxMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
@@ -28,6 +28,7 @@
 #include "../items/bi_device.h"
 #include "../items/bi_footprint.h"
 
+#include <librepcb/common/graphics/graphicslevelofdetail.h>
 #include <librepcb/common/graphics/stroketextgraphicsitem.h>
 #include <librepcb/library/pkg/footprint.h>
 
@@ -69,47 +70,18 @@ bool BGI_Footprint::isSelectable() const noexcept {
  ******************************************************************************/
 
 void BGI_Footprint::updateCacheAndRepaint() noexcept {
-  GraphicsLayer* layer = nullptr;
   prepareGeometryChange();
 
-  mBoundingRect = QRectF();
-  mShape        = QPainterPath();
-
   // set Z value
   if (mFootprint.getIsMirrored())
     setZValue(Board::ZValue_FootprintsBottom);
   else
     setZValue(Board::ZValue_FootprintsTop);
 
-  // cross rect
-  layer = getLayer(GraphicsLayer::sTopReferences);
-  if (layer) {
-    if (layer->isVisible()) {
-      qreal  width = Length(700000).toPx();
-      QRectF crossRect(-width, -width, 2 * width, 2 * width);
-      mBoundingRect = mBoundingRect.united(crossRect);
-      mShape.addRect(crossRect);
-    }
-  }
-
-  // polygons
-  for (const Polygon& polygon : mLibFootprint.getPolygons()) {
-    layer = getLayer(*polygon.getLayerName());
-    if (!layer) continue;
-    if (!layer->isVisible()) continue;
-
-    QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
-    qreal        w           = polygon.getLineWidth()->toPx() / 2;
-    mBoundingRect =
-        mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
-    if (!polygon.isGrabArea()) continue;
-    layer = getLayer(GraphicsLayer::sTopGrabAreas);
-    if (!layer) continue;
-    if (!layer->isVisible()) continue;
-    mShape = mShape.united(polygonPath);
-  }
-
-  if (!mShape.isEmpty()) mShape.setFillRule(Qt::WindingFill);
+  // the geometry is shared by all footprints of the same library footprint
+  mRenderCacheEntry = getRenderCacheEntry();
+  mBoundingRect     = mRenderCacheEntry->boundingRect;
+  mShape            = mRenderCacheEntry->shape;
 
   setVisible(!mBoundingRect.isEmpty());
 
@@ -123,96 +95,28 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept {
 void BGI_Footprint::paint(QPainter*                       painter,
                           const QStyleOptionGraphicsItem* option,
                           QWidget*                        widget) {
-  Q_UNUSED(option);
-  Q_UNUSED(widget);
-
   const GraphicsLayer* layer    = 0;
   const bool           selected = mFootprint.isSelected();
   const bool           deviceIsPrinter =
       (dynamic_cast<QPrinter*>(painter->device()) != 0);
-
-  // draw all polygons
-  for (const Polygon& polygon : mLibFootprint.getPolygons()) {
-    // get layer
-    layer = getLayer(*polygon.getLayerName());
-    if (!layer) continue;
-    if (!layer->isVisible()) continue;
-
-    // set pen
-    painter->setPen(QPen(layer->getColor(selected),
-                         polygon.getLineWidth()->toPx(), Qt::SolidLine,
-                         Qt::RoundCap, Qt::RoundJoin));
-
-    // set brush
-    if ((!polygon.isFilled()) || (!polygon.getPath().isClosed())) {
-      if (polygon.isGrabArea())
-        layer = getLayer(GraphicsLayer::sTopGrabAreas);
-      else
-        layer = nullptr;
-    }
-    if (layer) {
-      if (layer->isVisible())
-        painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-      else
-        painter->setBrush(Qt::NoBrush);
-    } else {
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+
+  // if the footprint is too small on the screen, draw only its bounding box
+  if (!GraphicsLevelOfDetail::fromWidget(widget).isItemDetailed(
+          lod, mBoundingRect)) {
+    layer = getLayer(GraphicsLayer::sTopPlacement);
+    if (layer && layer->isVisible()) {
+      painter->setPen(QPen(layer->getColor(selected), 0));
       painter->setBrush(Qt::NoBrush);
+      painter->drawRect(mBoundingRect);
     }
-
-    // draw polygon
-    painter->drawPath(polygon.getPath().toQPainterPathPx());
+    return;
   }
 
-  // draw all circles
-  for (const Circle& circle : mLibFootprint.getCircles()) {
-    // get layer
-    layer = getLayer(*circle.getLayerName());
-    if (!layer) continue;
-    if (!layer->isVisible()) continue;
-
-    // set pen
-    painter->setPen(QPen(layer->getColor(selected),
-                         circle.getLineWidth()->toPx(), Qt::SolidLine,
-                         Qt::RoundCap, Qt::RoundJoin));
-
-    // set brush
-    if (!circle.isFilled()) {
-      if (circle.isGrabArea())
-        layer = getLayer(GraphicsLayer::sTopGrabAreas);
-      else
-        layer = nullptr;
-    }
-    if (layer) {
-      if (layer->isVisible())
-        painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-      else
-        painter->setBrush(Qt::NoBrush);
-    } else {
-      painter->setBrush(Qt::NoBrush);
-    }
-
-    // draw circle
-    painter->drawEllipse(circle.getCenter().toPxQPointF(),
-                         circle.getDiameter()->toPx() / 2,
-                         circle.getDiameter()->toPx() / 2);
-    // TODO: rotation
-  }
-
-  // draw all holes
-  for (const Hole& hole : mLibFootprint.getHoles()) {
-    // get layer
-    layer = getLayer(GraphicsLayer::sBoardDrillsNpth);
-    if (!layer) continue;
-    if (!layer->isVisible()) continue;
-
-    // set pen/brush
-    painter->setPen(Qt::NoPen);
-    painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
-
-    // draw hole
-    qreal radius = (hole.getDiameter() / 2).toPx();
-    painter->drawEllipse(hole.getPosition().toPxQPointF(), radius, radius);
-  }
+  // draw all polygons, circles and holes
+  mRenderCacheEntry = getRenderCacheEntry();
+  mRenderCacheEntry->draw(*painter, selected);
 
   // draw origin cross
   layer = getLayer(GraphicsLayer::sTopReferences);
@@ -249,6 +153,103 @@ GraphicsLayer* BGI_Footprint::getLayer(QString name) const noexcept {
       name);
 }
 
+GraphicsRenderCache& BGI_Footprint::getRenderCache() const noexcept {
+  return mFootprint.getDeviceInstance()
+      .getBoard()
+      .getLayerStack()
+      .getRenderCache();
+}
+
+std::shared_ptr<const GraphicsRenderCache::Entry>
+    BGI_Footprint::getRenderCacheEntry() const noexcept {
+  GraphicsRenderCache& cache    = getRenderCache();
+  bool                 mirrored = mFootprint.getIsMirrored();
+  return cache.get(&mLibFootprint, mirrored ? 1 : 0,
+                   [&](GraphicsRenderCache::Entry& entry) {
+                     buildRenderCacheEntry(cache, mLibFootprint, mirrored,
+                                           entry);
+                   });
+}
+
+void BGI_Footprint::buildRenderCacheEntry(
+    GraphicsRenderCache& cache, const library::Footprint& footprint,
+    bool mirrored, GraphicsRenderCache::Entry& entry) noexcept {
+  auto getLayer = [&](QString name) -> GraphicsLayer* {
+    if (mirrored) name = GraphicsLayer::getMirroredLayerName(name);
+    return cache.getLayer(name);
+  };
+  GraphicsLayer* layer = nullptr;
+
+  // cross rect
+  layer = getLayer(GraphicsLayer::sTopReferences);
+  if (layer && layer->isVisible()) {
+    qreal  width = Length(700000).toPx();
+    QRectF crossRect(-width, -width, 2 * width, 2 * width);
+    entry.boundingRect = entry.boundingRect.united(crossRect);
+    entry.shape.addRect(crossRect);
+  }
+
+  // polygons
+  for (const Polygon& polygon : footprint.getPolygons()) {
+    layer = getLayer(*polygon.getLayerName());
+    if (!layer) continue;
+    if (!layer->isVisible()) continue;
+
+    QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
+    qreal        w           = polygon.getLineWidth()->toPx() / 2;
+    entry.boundingRect       = entry.boundingRect.united(
+        polygonPath.boundingRect().adjusted(-w, -w, w, w));
+
+    GraphicsLayer* fillLayer = nullptr;
+    if (polygon.isFilled() && polygon.getPath().isClosed())
+      fillLayer = layer;
+    else if (polygon.isGrabArea())
+      fillLayer = getLayer(GraphicsLayer::sTopGrabAreas);
+    entry.primitives.append(
+        GraphicsRenderCache::Primitive(polygonPath, layer, 2 * w, fillLayer));
+
+    if (!polygon.isGrabArea()) continue;
+    layer = getLayer(GraphicsLayer::sTopGrabAreas);
+    if (!layer) continue;
+    if (!layer->isVisible()) continue;
+    entry.shape = entry.shape.united(polygonPath);
+  }
+
+  // circles
+  for (const Circle& circle : footprint.getCircles()) {
+    layer = getLayer(*circle.getLayerName());
+    if (!layer) continue;
+    if (!layer->isVisible()) continue;
+
+    QPainterPath circlePath;
+    circlePath.addEllipse(circle.getCenter().toPxQPointF(),
+                          circle.getDiameter()->toPx() / 2,
+                          circle.getDiameter()->toPx() / 2);
+    GraphicsLayer* fillLayer = nullptr;
+    if (circle.isFilled())
+      fillLayer = layer;
+    else if (circle.isGrabArea())
+      fillLayer = getLayer(GraphicsLayer::sTopGrabAreas);
+    entry.primitives.append(GraphicsRenderCache::Primitive(
+        circlePath, layer, circle.getLineWidth()->toPx(), fillLayer));
+  }
+
+  // holes
+  for (const Hole& hole : footprint.getHoles()) {
+    layer = getLayer(GraphicsLayer::sBoardDrillsNpth);
+    if (!layer) continue;
+    if (!layer->isVisible()) continue;
+
+    QPainterPath holePath;
+    qreal        radius = (hole.getDiameter() / 2).toPx();
+    holePath.addEllipse(hole.getPosition().toPxQPointF(), radius, radius);
+    entry.primitives.append(
+        GraphicsRenderCache::Primitive(holePath, nullptr, 0, layer));
+  }
+
+  if (!entry.shape.isEmpty()) entry.shape.setFillRule(Qt::WindingFill);
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
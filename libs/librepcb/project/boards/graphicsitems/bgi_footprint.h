@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "bgi_base.h"
 
+#include <librepcb/common/graphics/graphicsrendercache.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -76,15 +78,23 @@ private:
   BGI_Footprint& operator=(const BGI_Footprint& rhs) = delete;
 
   // Private Methods
-  GraphicsLayer* getLayer(QString name) const noexcept;
+  GraphicsLayer*       getLayer(QString name) const noexcept;
+  GraphicsRenderCache& getRenderCache() const noexcept;
+  std::shared_ptr<const GraphicsRenderCache::Entry> getRenderCacheEntry() const
+      noexcept;
+  static void buildRenderCacheEntry(GraphicsRenderCache&        cache,
+                                    const library::Footprint&   footprint,
+                                    bool                        mirrored,
+                                    GraphicsRenderCache::Entry& entry) noexcept;
 
   // General Attributes
   BI_Footprint&             mFootprint;
   const library::Footprint& mLibFootprint;
 
   // Cached Attributes
-  QRectF       mBoundingRect;
-  QPainterPath mShape;
+  QRectF                                            mBoundingRect;
+  QPainterPath                                      mShape;
+  std::shared_ptr<const GraphicsRenderCache::Entry> mRenderCacheEntry;
 };
 
 /*******************************************************************************
@@ -29,6 +29,8 @@
 #include "../items/bi_netline.h"
 #include "../items/bi_netpoint.h"
 
+#include <librepcb/common/graphics/graphicslevelofdetail.h>
+
 #include <QPrinter>
 #include <QtCore>
 #include <QtWidgets>
@@ -98,16 +100,19 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept {
 void BGI_NetLine::paint(QPainter*                       painter,
                         const QStyleOptionGraphicsItem* option,
                         QWidget*                        widget) {
-  Q_UNUSED(option);
-  Q_UNUSED(widget);
-
   bool highlight = mNetLine.isSelected() ||
                    mNetLine.getNetSignalOfNetSegment().isHighlighted();
 
-  // draw line
+  const qreal lod =
+      option->levelOfDetailFromTransform(painter->worldTransform());
+  const GraphicsLevelOfDetail& lodSettings =
+      GraphicsLevelOfDetail::fromWidget(widget);
+
+  // draw line (as a cheap cosmetic line if it is thinner than a pixel anyway)
   if (mLayer->isVisible()) {
-    QPen pen(mLayer->getColor(highlight), mNetLine.getWidth()->toPx(),
-             Qt::SolidLine, Qt::RoundCap);
+    qreal width = mNetLine.getWidth()->toPx();
+    if (!lodSettings.isLineDetailed(lod, width)) width = 0;
+    QPen pen(mLayer->getColor(highlight), width, Qt::SolidLine, Qt::RoundCap);
     painter->setPen(pen);
     painter->drawLine(mLineF);
   }
@@ -28,6 +28,7 @@
 #include "../items/bi_plane.h"
 
 #include <librepcb/common/geometry/polygon.h>
+#include <librepcb/common/graphics/graphicslevelofdetail.h>
 #include <librepcb/common/toolbox.h>
 
 #include <QPrinter>
@@ -45,7 +46,10 @@ namespace project {
  ******************************************************************************/
 
 BGI_Plane::BGI_Plane(BI_Plane& plane) noexcept
-  : BGI_Base(), mPlane(plane), mLayer(nullptr) {
+  : BGI_Base(),
+    mPlane(plane),
+    mLayer(nullptr),
+    mSimplifiedAreasTolerance(0) {
   updateCacheAndRepaint();
 }
 
@@ -79,6 +83,8 @@ void BGI_Plane::updateCacheAndRepaint() noexcept {
 
   // get areas
   mAreas.clear();
+  mSimplifiedAreas.clear();
+  mSimplifiedAreasTolerance = 0;
   for (const Path& r : mPlane.getFragments()) {
     mAreas.append(r.toQPainterPathPx());
     mBoundingRect = mBoundingRect.united(mAreas.last().boundingRect());
@@ -93,8 +99,6 @@ void BGI_Plane::updateCacheAndRepaint() noexcept {
 
 void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
                       QWidget* widget) {
-  Q_UNUSED(widget);
-
   const bool selected = mPlane.isSelected();
   const bool deviceIsPrinter =
       (dynamic_cast<QPrinter*>(painter->device()) != nullptr);
@@ -114,7 +118,28 @@ void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
     if (mPlane.isVisible()) {
       painter->setPen(Qt::NoPen);
       painter->setBrush(mLayer->getColor(selected));
-      foreach (const QPainterPath& area, mAreas) { painter->drawPath(area); }
+      qreal tolerance =
+          GraphicsLevelOfDetail::fromWidget(widget).getOutlineTolerancePx(lod);
+      if (tolerance > 0) {
+        // when zoomed out, draw the fragments with less vertices
+        if (tolerance != mSimplifiedAreasTolerance) {
+          mSimplifiedAreas.clear();
+          foreach (const QPainterPath& area, mAreas) {
+            QPainterPath simplified;
+            foreach (const QPolygonF& polygon, area.toSubpathPolygons()) {
+              simplified.addPolygon(
+                  GraphicsLevelOfDetail::simplifyPolygon(polygon, tolerance));
+            }
+            mSimplifiedAreas.append(simplified);
+          }
+          mSimplifiedAreasTolerance = tolerance;
+        }
+        foreach (const QPainterPath& area, mSimplifiedAreas) {
+          painter->drawPath(area);
+        }
+      } else {
+        foreach (const QPainterPath& area, mAreas) { painter->drawPath(area); }
+      }
     }
   }
 
@@ -84,6 +84,8 @@ private:
   QPainterPath          mShape;
   QPainterPath          mOutline;
   QVector<QPainterPath> mAreas;
+  qreal                 mSimplifiedAreasTolerance;  ///< 0 = not cached
+  QVector<QPainterPath> mSimplifiedAreas;
 };
 
 /*******************************************************************************
@@ -41,7 +41,14 @@ namespace project {
  ******************************************************************************/
 
 BI_Base::BI_Base(Board& board) noexcept
-  : QObject(&board), mBoard(board), mIsAddedToBoard(false), mIsSelected(false) {
+  : QObject(&board),
+    mBoard(board),
+    mIsAddedToBoard(false),
+    mIsSelected(false),
+    mGrabAreaCacheEnabled(false),
+    mGrabAreaValid(false),
+    mGrabAreaScenePx(),
+    mGrabAreaBoundingRectPx() {
 }
 
 BI_Base::~BI_Base() noexcept {
@@ -60,6 +67,29 @@ Circuit& BI_Base::getCircuit() const noexcept {
   return mBoard.getProject().getCircuit();
 }
 
+bool BI_Base::isGrabAreaAtScenePos(const QPointF& scenePosPx) const noexcept {
+  if (!mGrabAreaCacheEnabled) {
+    return getGrabAreaScenePx().contains(scenePosPx);
+  }
+  updateGrabAreaCache();
+  return mGrabAreaBoundingRectPx.contains(scenePosPx) &&
+         mGrabAreaScenePx.contains(scenePosPx);
+}
+
+bool BI_Base::isGrabAreaInSceneRect(const QRectF& sceneRectPx) const noexcept {
+  if (!mGrabAreaCacheEnabled) {
+    return getGrabAreaScenePx().intersects(sceneRectPx);
+  }
+  updateGrabAreaCache();
+  if (!mGrabAreaBoundingRectPx.intersects(sceneRectPx)) {
+    return false;
+  } else if (sceneRectPx.contains(mGrabAreaBoundingRectPx)) {
+    return !mGrabAreaScenePx.isEmpty();  // completely within the rect
+  } else {
+    return mGrabAreaScenePx.intersects(sceneRectPx);
+  }
+}
+
 /*******************************************************************************
  *  Setters
  ******************************************************************************/
@@ -76,6 +106,7 @@ void BI_Base::addToBoard(QGraphicsItem* item) noexcept {
   Q_ASSERT(!mIsAddedToBoard);
   if (item) {
     mBoard.getGraphicsScene().addItem(*item);
+    mBoard.mItemsByGraphicsItem.insert(item, this);
   }
   mIsAddedToBoard = true;
 }
@@ -84,10 +115,28 @@ void BI_Base::removeFromBoard(QGraphicsItem* item) noexcept {
   Q_ASSERT(mIsAddedToBoard);
   if (item) {
     mBoard.getGraphicsScene().removeItem(*item);
+    mBoard.mItemsByGraphicsItem.remove(item);
   }
   mIsAddedToBoard = false;
 }
 
+void BI_Base::enableGrabAreaCache() noexcept {
+  mGrabAreaCacheEnabled = true;
+  mGrabAreaValid        = false;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+void BI_Base::updateGrabAreaCache() const noexcept {
+  if (!mGrabAreaValid) {
+    mGrabAreaScenePx        = getGrabAreaScenePx();
+    mGrabAreaBoundingRectPx = mGrabAreaScenePx.boundingRect();
+    mGrabAreaValid          = true;
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
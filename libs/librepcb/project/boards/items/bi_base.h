@@ -48,6 +48,14 @@ class BGI_Base;
 
 /**
  * @brief The Board Item Base (BI_Base) class
+ *
+ * Hit-tests should be done with #isGrabAreaAtScenePos() and
+ * #isGrabAreaInSceneRect() rather than with #getGrabAreaScenePx() since
+ * they first check the bounding rect of the grab area. Items which
+ * call #enableGrabAreaCache() additionally keep their grab area cached, so it
+ * doesn't need to be calculated (e.g. transformed to scene coordinates) on
+ * every hit-test. These items must call #invalidateGrabArea() whenever their
+ * geometry changes.
  */
 class BI_Base : public QObject {
   Q_OBJECT
@@ -83,6 +91,8 @@ public:
   virtual const Point& getPosition() const noexcept        = 0;
   virtual bool         getIsMirrored() const noexcept      = 0;
   virtual QPainterPath getGrabAreaScenePx() const noexcept = 0;
+  bool isGrabAreaAtScenePos(const QPointF& scenePosPx) const noexcept;
+  bool isGrabAreaInSceneRect(const QRectF& sceneRectPx) const noexcept;
   virtual bool isAddedToBoard() const noexcept { return mIsAddedToBoard; }
   virtual bool isSelectable() const noexcept = 0;
   virtual bool isSelected() const noexcept { return mIsSelected; }
@@ -101,14 +111,25 @@ protected:
   // General Methods
   void addToBoard(QGraphicsItem* item) noexcept;
   void removeFromBoard(QGraphicsItem* item) noexcept;
+  void enableGrabAreaCache() noexcept;
+  void invalidateGrabArea() noexcept { mGrabAreaValid = false; }
 
 protected:
   Board& mBoard;
 
+private:  // Methods
+  void updateGrabAreaCache() const noexcept;
+
 private:
   // General Attributes
   bool mIsAddedToBoard;
   bool mIsSelected;
+
+  // Grab Area Cache
+  bool                 mGrabAreaCacheEnabled;
+  mutable bool         mGrabAreaValid;
+  mutable QPainterPath mGrabAreaScenePx;
+  mutable QRectF       mGrabAreaBoundingRectPx;  ///< Bounding rect of the above
 };
 
 /*******************************************************************************
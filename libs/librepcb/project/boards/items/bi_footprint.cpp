@@ -76,6 +76,7 @@ void BI_Footprint::init() {
   mGraphicsItem.reset(new BGI_Footprint(*this));
   mGraphicsItem->setPos(mDevice.getPosition().toPxQPointF());
   updateGraphicsItemTransform();
+  enableGrabAreaCache();
 
   // load pads
   const library::Device& libDev = mDevice.getLibDevice();
@@ -282,12 +283,15 @@ void BI_Footprint::setSelected(bool selected) noexcept {
 
 void BI_Footprint::deviceInstanceAttributesChanged() {
   mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
   emit attributesChanged();
 }
 
 void BI_Footprint::deviceInstanceMoved(const Point& pos) {
+  // the geometry of the graphics items doesn't depend on the position, so
+  // moving them is enough (no need to update their caches)
   mGraphicsItem->setPos(pos.toPxQPointF());
-  mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
   foreach (BI_FootprintPad* pad, mPads) {
     pad->updatePosition();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -299,6 +303,7 @@ void BI_Footprint::deviceInstanceRotated(const Angle& rot) {
   Q_UNUSED(rot);
   updateGraphicsItemTransform();
   mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
   foreach (BI_FootprintPad* pad, mPads) {
     pad->updatePosition();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
@@ -309,8 +314,10 @@ void BI_Footprint::deviceInstanceMirrored(bool mirrored) {
   Q_UNUSED(mirrored);
   updateGraphicsItemTransform();
   mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
   foreach (BI_FootprintPad* pad, mPads) {
     pad->updatePosition();
+    pad->updateGraphicsItem();
     mBoard.scheduleAirWiresRebuild(pad->getCompSigInstNetSignal());
   }
 }
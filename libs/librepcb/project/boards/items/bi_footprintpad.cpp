@@ -73,6 +73,7 @@ BI_FootprintPad::BI_FootprintPad(BI_Footprint& footprint, const Uuid& padUuid)
   }
 
   mGraphicsItem.reset(new BGI_FootprintPad(*this));
+  enableGrabAreaCache();
   updatePosition();
 
   // connect to the "attributes changed" signal of the footprint
@@ -181,10 +182,15 @@ void BI_FootprintPad::updatePosition() noexcept {
   mRotation = mFootprint.getRotation() + mFootprintPad->getRotation();
   mGraphicsItem->setPos(mPosition.toPxQPointF());
   updateGraphicsItemTransform();
-  mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
   foreach (BI_NetLine* netline, mRegisteredNetLines) { netline->updateLine(); }
 }
 
+void BI_FootprintPad::updateGraphicsItem() noexcept {
+  mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
+}
+
 /*******************************************************************************
  *  Inherited from BI_Base
  ******************************************************************************/
@@ -220,7 +226,7 @@ Path BI_FootprintPad::getSceneOutline(const Length& expansion) const noexcept {
  ******************************************************************************/
 
 void BI_FootprintPad::footprintAttributesChanged() {
-  mGraphicsItem->updateCacheAndRepaint();
+  updateGraphicsItem();
 }
 
 void BI_FootprintPad::componentSignalInstanceNetSignalChanged(NetSignal* from,
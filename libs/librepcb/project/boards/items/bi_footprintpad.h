@@ -86,6 +86,7 @@ public:
   void addToBoard() override;
   void removeFromBoard() override;
   void updatePosition() noexcept;
+  void updateGraphicsItem() noexcept;
 
   // Inherited from BI_Base
   Type_t getType() const noexcept override {
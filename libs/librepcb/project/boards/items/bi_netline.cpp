@@ -158,6 +158,7 @@ void BI_NetLine::init() {
   }
 
   mGraphicsItem.reset(new BGI_NetLine(*this));
+  enableGrabAreaCache();
   updateLine();
 }
 
@@ -210,6 +211,7 @@ void BI_NetLine::setLayer(GraphicsLayer& layer) {
   if (&layer != mLayer) {
     mLayer = &layer;
     mGraphicsItem->updateCacheAndRepaint();
+    invalidateGrabArea();
   }
 }
 
@@ -217,6 +219,7 @@ void BI_NetLine::setWidth(const PositiveLength& width) noexcept {
   if (width != mWidth) {
     mWidth = width;
     mGraphicsItem->updateCacheAndRepaint();
+    invalidateGrabArea();
   }
 }
 
@@ -250,13 +253,18 @@ void BI_NetLine::removeFromBoard() {
   mEndPoint->unregisterNetLine(*this);  // can throw
 
   disconnect(mHighlightChangedConnection);
+  mBoard.unscheduleNetLineUpdate(*this);
   BI_Base::removeFromBoard(mGraphicsItem.data());
   sg.dismiss();
 }
 
 void BI_NetLine::updateLine() noexcept {
+  if (isAddedToBoard() && mBoard.scheduleNetLineUpdate(*this)) {
+    return;  // the board will call this method again later
+  }
   mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
   mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
 }
 
 void BI_NetLine::serialize(SExpression& root) const {
@@ -76,6 +76,7 @@ void BI_Via::init() {
   // create the graphics item
   mGraphicsItem.reset(new BGI_Via(*this));
   mGraphicsItem->setPos(mPosition.toPxQPointF());
+  enableGrabAreaCache();
 
   // connect to the "attributes changed" signal of the board
   connect(&mBoard, &Board::attributesChanged, this,
@@ -137,6 +138,7 @@ void BI_Via::setPosition(const Point& position) noexcept {
   if (position != mPosition) {
     mPosition = position;
     mGraphicsItem->setPos(mPosition.toPxQPointF());
+    invalidateGrabArea();
     foreach (BI_NetLine* netline, mRegisteredNetLines) {
       netline->updateLine();
     }
@@ -148,6 +150,7 @@ void BI_Via::setShape(Shape shape) noexcept {
   if (shape != mShape) {
     mShape = shape;
     mGraphicsItem->updateCacheAndRepaint();
+    invalidateGrabArea();
   }
 }
 
@@ -155,6 +158,7 @@ void BI_Via::setSize(const PositiveLength& size) noexcept {
   if (size != mSize) {
     mSize = size;
     mGraphicsItem->updateCacheAndRepaint();
+    invalidateGrabArea();
   }
 }
 
@@ -162,6 +166,7 @@ void BI_Via::setDrillDiameter(const PositiveLength& diameter) noexcept {
   if (diameter != mDrillDiameter) {
     mDrillDiameter = diameter;
     mGraphicsItem->updateCacheAndRepaint();
+    invalidateGrabArea();
   }
 }
 
@@ -197,6 +202,7 @@ void BI_Via::registerNetLine(BI_NetLine& netline) {
   mRegisteredNetLines.insert(&netline);
   netline.updateLine();
   mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
 }
 
 void BI_Via::unregisterNetLine(BI_NetLine& netline) {
@@ -206,6 +212,7 @@ void BI_Via::unregisterNetLine(BI_NetLine& netline) {
   mRegisteredNetLines.remove(&netline);
   netline.updateLine();
   mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
 }
 
 void BI_Via::serialize(SExpression& root) const {
@@ -239,6 +246,7 @@ void BI_Via::setSelected(bool selected) noexcept {
 
 void BI_Via::boardAttributesChanged() {
   mGraphicsItem->updateCacheAndRepaint();
+  invalidateGrabArea();
 }
 
 /*******************************************************************************
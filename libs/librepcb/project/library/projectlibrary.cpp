@@ -33,6 +33,7 @@
 #include <librepcb/library/pkg/package.h>
 #include <librepcb/library/sym/symbol.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -51,20 +52,52 @@ ProjectLibrary::ProjectLibrary(
     std::unique_ptr<TransactionalDirectory> directory)
   : mDirectory(std::move(directory)) {
   qDebug() << "load project library...";
-
-  try {
-    // Load all library elements
-    loadElements<Symbol>("sym", "symbols", mSymbols);
-    loadElements<Package>("pkg", "packages", mPackages);
-    loadElements<Component>("cmp", "components", mComponents);
-    loadElements<Device>("dev", "devices", mDevices);
-  } catch (const Exception&) {
+  QElapsedTimer timer;
+  timer.start();
+
+  // Find all library elements. The directories are scanned concurrently
+  // since each element directory needs to be checked on the file system.
+  QFuture<QStringList> symDirs = QtConcurrent::run(
+      [this]() { return findElementDirectories<Symbol>("sym"); });
+  QFuture<QStringList> pkgDirs = QtConcurrent::run(
+      [this]() { return findElementDirectories<Package>("pkg"); });
+  QFuture<QStringList> cmpDirs = QtConcurrent::run(
+      [this]() { return findElementDirectories<Component>("cmp"); });
+  QFuture<QStringList> devDirs = QtConcurrent::run(
+      [this]() { return findElementDirectories<Device>("dev"); });
+  QStringList symbolDirs    = symDirs.result();
+  QStringList packageDirs   = pkgDirs.result();
+  QStringList componentDirs = cmpDirs.result();
+  QStringList deviceDirs    = devDirs.result();
+  qint64      findTime      = timer.restart();
+
+  // Read and parse all library elements concurrently.
+  QList<QFuture<Symbol*>> symbols = startLoadingElements<Symbol>(symbolDirs);
+  QList<QFuture<Package*>> packages =
+      startLoadingElements<Package>(packageDirs);
+  QList<QFuture<Component*>> components =
+      startLoadingElements<Component>(componentDirs);
+  QList<QFuture<Device*>> devices = startLoadingElements<Device>(deviceDirs);
+
+  // Wait for *all* elements before throwing to not leak any of them. If
+  // several elements failed, the error of the first one is reported.
+  QScopedPointer<Exception> error;
+  addLoadedElements<Symbol>("symbols", symbols, mSymbols, error);
+  addLoadedElements<Package>("packages", packages, mPackages, error);
+  addLoadedElements<Component>("components", components, mComponents, error);
+  addLoadedElements<Device>("devices", devices, mDevices, error);
+  qint64 loadTime = timer.elapsed();
+  if (error) {
     qDeleteAll(mAllElements);
     mAllElements.clear();
-    throw;
+    error->raise();
   }
 
-  qDebug() << "project library successfully loaded!";
+  qDebug() << "project library successfully loaded!"
+           << QString("(find: %1 ms, load: %2 ms, threads: %3)")
+                  .arg(findTime)
+                  .arg(loadTime)
+                  .arg(QThreadPool::globalInstance()->maxThreadCount());
 }
 
 ProjectLibrary::~ProjectLibrary() noexcept {
@@ -143,35 +176,75 @@ void ProjectLibrary::save() {
  ******************************************************************************/
 
 template <typename ElementType>
-void ProjectLibrary::loadElements(const QString& dirname, const QString& type,
-                                  QHash<Uuid, ElementType*>& elementList) {
-  // search all subdirectories which have a valid UUID as directory name
+QStringList ProjectLibrary::findElementDirectories(const QString& dirname) const
+    noexcept {
+  // search all subdirectories which are valid library elements
+  QStringList dirs;
   foreach (const QString& sub, mDirectory->getDirs(dirname)) {
-    std::unique_ptr<TransactionalDirectory> dir(
-        new TransactionalDirectory(*mDirectory, dirname % "/" % sub));
-
-    // check if directory is a valid library element
-    if (!LibraryBaseElement::isValidElementDirectory<ElementType>(*dir, "")) {
+    QString dir = dirname % "/" % sub;
+    if (LibraryBaseElement::isValidElementDirectory<ElementType>(*mDirectory,
+                                                                  dir)) {
+      dirs.append(dir);
+    } else {
       qWarning() << "Found an invalid directory in the library:"
-                 << dir->getAbsPath().toNative();
-      continue;
+                 << mDirectory->getAbsPath(dir).toNative();
     }
+  }
+  dirs.sort();  // keep the error reporting deterministic
+  return dirs;
+}
 
-    // load the library element
-    QScopedPointer<ElementType> element(
-        new ElementType(std::move(dir)));  // can throw
-    if (elementList.contains(element->getUuid())) {
-      throw RuntimeError(
+template <typename ElementType>
+QList<QFuture<ElementType*>> ProjectLibrary::startLoadingElements(
+    const QStringList& dirs) noexcept {
+  QList<QFuture<ElementType*>> futures;
+  foreach (const QString& dir, dirs) {
+    futures.append(QtConcurrent::run(
+        [this, dir]() { return loadElement<ElementType>(dir); }));
+  }
+  return futures;
+}
+
+template <typename ElementType>
+ElementType* ProjectLibrary::loadElement(const QString& dir) {
+  std::unique_ptr<ElementType> element(
+      new ElementType(std::unique_ptr<TransactionalDirectory>(
+          new TransactionalDirectory(*mDirectory, dir))));  // can throw
+
+  // the element is created in a worker thread, but used in the main thread
+  element->getDirectory().moveToThread(thread());
+  element->moveToThread(thread());
+  return element.release();
+}
+
+template <typename ElementType>
+void ProjectLibrary::addLoadedElements(
+    const QString& type, QList<QFuture<ElementType*>>& futures,
+    QHash<Uuid, ElementType*>& elementList,
+    QScopedPointer<Exception>& error) noexcept {
+  foreach (QFuture<ElementType*> future, futures) {
+    ElementType* element = nullptr;
+    try {
+      element = future.result();  // can throw
+    } catch (const Exception& e) {
+      if (!error) error.reset(e.clone());
+      continue;
+    }
+    mAllElements.insert(element);  // take ownership in any case
+    if (error) {
+      continue;
+    }
+    if (ElementType* other = elementList.value(element->getUuid())) {
+      error.reset(new RuntimeError(
           __FILE__, __LINE__,
           QString("There are multiple library elements with the same "
-                  "UUID in the directory \"%1\"")
-              .arg(dir->getAbsPath().toNative()));
+                  "UUID in the directories \"%1\" and \"%2\"")
+              .arg(other->getDirectory().getAbsPath().toNative(),
+                   element->getDirectory().getAbsPath().toNative())));
+      continue;
     }
-
-    // everything is ok -> update members
-    elementList.insert(element->getUuid(), element.data());
-    mElementsToUpgrade.insert(element.data());
-    mAllElements.insert(element.take());  // Take object from smart pointer!
+    elementList.insert(element->getUuid(), element);
+    mElementsToUpgrade.insert(element);
   }
 
   qDebug() << "successfully loaded" << elementList.count() << qPrintable(type);
@@ -54,6 +54,10 @@ class Project;
 
 /**
  * @brief The ProjectLibrary class
+ *
+ * All library elements are loaded concurrently on the global thread pool when
+ * the library is opened. Errors are reported in the order of the element
+ * directories, independent of the thread scheduling.
  */
 class ProjectLibrary final : public QObject {
   Q_OBJECT
@@ -114,8 +118,17 @@ private:
 
   // Private Methods
   template <typename ElementType>
-  void loadElements(const QString& dirname, const QString& type,
-                    QHash<Uuid, ElementType*>& elementList);
+  QStringList findElementDirectories(const QString& dirname) const noexcept;
+  template <typename ElementType>
+  QList<QFuture<ElementType*>> startLoadingElements(
+      const QStringList& dirs) noexcept;
+  template <typename ElementType>
+  ElementType* loadElement(const QString& dir);
+  template <typename ElementType>
+  void addLoadedElements(const QString&                type,
+                         QList<QFuture<ElementType*>>& futures,
+                         QHash<Uuid, ElementType*>&    elementList,
+                         QScopedPointer<Exception>&    error) noexcept;
   template <typename ElementType>
   void addElement(ElementType& element, QHash<Uuid, ElementType*>& elementList);
   template <typename ElementType>
@@ -126,7 +126,10 @@ Project::Project(std::unique_ptr<TransactionalDirectory> directory,
         }
       }
     }
-    mStrokeFontPool.reset(new StrokeFontPool(fontobeneDir));
+    // share fonts with the application if they are identical, which is the
+    // case for most projects
+    mStrokeFontPool.reset(
+        new StrokeFontPool(fontobeneDir, &qApp->getStrokeFonts()));
 
     // Create or load metadata
     if (create) {
@@ -49,6 +49,13 @@ CmdSchematicNetLabelAnchorsUpdate::
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSchematicNetLabelAnchorsUpdate::canMergeWith(
+    const UndoCommand& other) const noexcept {
+  const CmdSchematicNetLabelAnchorsUpdate* cmd =
+      dynamic_cast<const CmdSchematicNetLabelAnchorsUpdate*>(&other);
+  return cmd && (&cmd->mSchematic == &mSchematic);
+}
+
 bool CmdSchematicNetLabelAnchorsUpdate::performExecute() {
   performRedo();  // can throw
   return true;
@@ -62,6 +69,11 @@ void CmdSchematicNetLabelAnchorsUpdate::performRedo() {
   mSchematic.updateAllNetLabelAnchors();
 }
 
+void CmdSchematicNetLabelAnchorsUpdate::performMerge(
+    const UndoCommand& other) {
+  Q_UNUSED(other);  // the anchors are updated on every undo/redo anyway
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -51,6 +51,9 @@ public:
   CmdSchematicNetLabelAnchorsUpdate(Schematic& schematic) noexcept;
   ~CmdSchematicNetLabelAnchorsUpdate() noexcept;
 
+  /// @copydoc UndoCommand::canMergeWith()
+  bool canMergeWith(const UndoCommand& other) const noexcept override;
+
 private:
   // Private Methods
 
@@ -63,6 +66,9 @@ private:
   /// @copydoc UndoCommand::performRedo()
   void performRedo() override;
 
+  /// @copydoc UndoCommand::performMerge()
+  void performMerge(const UndoCommand& other) override;
+
   // Private Member Variables
   Schematic& mSchematic;
 };
@@ -94,6 +94,14 @@ void CmdSchematicNetLabelEdit::rotate(const Angle& angle, const Point& center,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSchematicNetLabelEdit::canMergeWith(
+    const UndoCommand& other) const noexcept {
+  const CmdSchematicNetLabelEdit* cmd =
+      dynamic_cast<const CmdSchematicNetLabelEdit*>(&other);
+  return cmd && (&cmd->mNetLabel == &mNetLabel) && (cmd->mOldPos == mNewPos) &&
+         (cmd->mOldRotation == mNewRotation);
+}
+
 bool CmdSchematicNetLabelEdit::performExecute() {
   performRedo();  // can throw
 
@@ -110,6 +118,13 @@ void CmdSchematicNetLabelEdit::performRedo() {
   mNetLabel.setRotation(mNewRotation);
 }
 
+void CmdSchematicNetLabelEdit::performMerge(const UndoCommand& other) {
+  const CmdSchematicNetLabelEdit& cmd =
+      dynamic_cast<const CmdSchematicNetLabelEdit&>(other);
+  mNewPos      = cmd.mNewPos;
+  mNewRotation = cmd.mNewRotation;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
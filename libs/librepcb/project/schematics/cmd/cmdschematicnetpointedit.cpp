@@ -71,6 +71,13 @@ void CmdSchematicNetPointEdit::translate(const Point& deltaPos,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSchematicNetPointEdit::canMergeWith(
+    const UndoCommand& other) const noexcept {
+  const CmdSchematicNetPointEdit* cmd =
+      dynamic_cast<const CmdSchematicNetPointEdit*>(&other);
+  return cmd && (&cmd->mNetPoint == &mNetPoint) && (cmd->mOldPos == mNewPos);
+}
+
 bool CmdSchematicNetPointEdit::performExecute() {
   performRedo();  // can throw
 
@@ -85,6 +92,10 @@ void CmdSchematicNetPointEdit::performRedo() {
   mNetPoint.setPosition(mNewPos);
 }
 
+void CmdSchematicNetPointEdit::performMerge(const UndoCommand& other) {
+  mNewPos = dynamic_cast<const CmdSchematicNetPointEdit&>(other).mNewPos;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -53,6 +53,9 @@ public:
   void setPosition(const Point& pos, bool immediate) noexcept;
   void translate(const Point& deltaPos, bool immediate) noexcept;
 
+  /// @copydoc UndoCommand::canMergeWith()
+  bool canMergeWith(const UndoCommand& other) const noexcept override;
+
 private:
   // Private Methods
 
@@ -65,6 +68,9 @@ private:
   /// @copydoc UndoCommand::performRedo()
   void performRedo() override;
 
+  /// @copydoc UndoCommand::performMerge()
+  void performMerge(const UndoCommand& other) override;
+
   // Private Member Variables
 
   // Attributes from the constructor
@@ -48,6 +48,17 @@ CmdSchematicNetSegmentRemoveElements::
     ~CmdSchematicNetSegmentRemoveElements() noexcept {
 }
 
+/*******************************************************************************
+ *  Getters
+ ******************************************************************************/
+
+qint64 CmdSchematicNetSegmentRemoveElements::getApproxMemoryUsage() const
+    noexcept {
+  // the removed items are kept alive as long as this command exists
+  return sizeof(*this) + mNetPoints.count() * sizeof(SI_NetPoint) +
+      mNetLines.count() * sizeof(SI_NetLine);
+}
+
 /*******************************************************************************
  *  General Methods
  ******************************************************************************/
@@ -54,6 +54,11 @@ public:
   void removeNetPoint(SI_NetPoint& netpoint);
   void removeNetLine(SI_NetLine& netline);
 
+  // Getters
+
+  /// @copydoc UndoCommand::getApproxMemoryUsage()
+  qint64 getApproxMemoryUsage() const noexcept override;
+
 private:
   // Private Methods
 
@@ -138,6 +138,15 @@ void CmdSymbolInstanceEdit::mirror(const Point&    center,
  *  Inherited from UndoCommand
  ******************************************************************************/
 
+bool CmdSymbolInstanceEdit::canMergeWith(
+    const UndoCommand& other) const noexcept {
+  const CmdSymbolInstanceEdit* cmd =
+      dynamic_cast<const CmdSymbolInstanceEdit*>(&other);
+  return cmd && (&cmd->mSymbol == &mSymbol) && (cmd->mOldPos == mNewPos) &&
+         (cmd->mOldRotation == mNewRotation) &&
+         (cmd->mOldMirrored == mNewMirrored);
+}
+
 bool CmdSymbolInstanceEdit::performExecute() {
   performRedo();  // can throw
 
@@ -159,6 +168,14 @@ void CmdSymbolInstanceEdit::performRedo() {
   mSymbol.setMirrored(mNewMirrored);
 }
 
+void CmdSymbolInstanceEdit::performMerge(const UndoCommand& other) {
+  const CmdSymbolInstanceEdit& cmd =
+      dynamic_cast<const CmdSymbolInstanceEdit&>(other);
+  mNewPos      = cmd.mNewPos;
+  mNewRotation = cmd.mNewRotation;
+  mNewMirrored = cmd.mNewMirrored;
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
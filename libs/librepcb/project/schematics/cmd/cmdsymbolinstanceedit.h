@@ -58,6 +58,9 @@ public:
   void mirror(const Point& center, Qt::Orientation orientation,
               bool immediate) noexcept;
 
+  /// @copydoc UndoCommand::canMergeWith()
+  bool canMergeWith(const UndoCommand& other) const noexcept override;
+
 private:
   // Private Methods
 
@@ -70,6 +73,9 @@ private:
   /// @copydoc UndoCommand::performRedo()
   void performRedo() override;
 
+  /// @copydoc UndoCommand::performMerge()
+  void performMerge(const UndoCommand& other) override;
+
   // Private Member Variables
 
   // Attributes from the constructor
@@ -30,6 +30,7 @@
 
 #include <librepcb/common/application.h>
 #include <librepcb/common/attributes/attributesubstitutor.h>
+#include <librepcb/common/graphics/graphicslevelofdetail.h>
 #include <librepcb/library/cmp/component.h>
 #include <librepcb/library/sym/symbol.h>
 
@@ -66,58 +67,10 @@ SGI_Symbol::~SGI_Symbol() noexcept {
 void SGI_Symbol::updateCacheAndRepaint() noexcept {
   prepareGeometryChange();
 
-  mBoundingRect = QRectF();
-
-  mShape = QPainterPath();
-  mShape.setFillRule(Qt::WindingFill);
-
-  // cross rect
-  QRectF crossRect(-4, -4, 8, 8);
-  mBoundingRect = mBoundingRect.united(crossRect);
-  mShape.addRect(crossRect);
-
-  // polygons
-  for (const Polygon& polygon : mLibSymbol.getPolygons()) {
-    // query polygon path and line width
-    QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
-    qreal        w           = polygon.getLineWidth()->toPx() / 2;
-
-    // update bounding rectangle
-    mBoundingRect =
-        mBoundingRect.united(polygonPath.boundingRect().adjusted(-w, -w, w, w));
-
-    // update shape
-    if (polygon.isGrabArea()) {
-      QPainterPathStroker stroker;
-      stroker.setCapStyle(Qt::RoundCap);
-      stroker.setJoinStyle(Qt::RoundJoin);
-      stroker.setWidth(2 * w);
-      // add polygon area
-      mShape = mShape.united(polygonPath);
-      // add stroke area
-      mShape = mShape.united(stroker.createStroke(polygonPath));
-    }
-  }
-
-  // circles
-  for (const Circle& circle : mLibSymbol.getCircles()) {
-    // get circle radius, including compensation for the stroke width
-    qreal w = circle.getLineWidth()->toPx() / 2;
-    qreal r = circle.getDiameter()->toPx() / 2 + w;
-
-    // get the bounding rectangle for the circle
-    QPointF center = circle.getCenter().toPxQPointF();
-    QRectF  boundingRect =
-        QRectF(QPointF(center.x() - r, center.y() - r), QSizeF(r * 2, r * 2));
-
-    // update bounding rectangle
-    mBoundingRect = mBoundingRect.united(boundingRect);
-
-    // update shape
-    if (circle.isGrabArea()) {
-      mShape.addEllipse(circle.getCenter().toPxQPointF(), r, r);
-    }
-  }
+  // polygons and circles are shared by all symbols of the same library symbol
+  mRenderCacheEntry = getRenderCacheEntry();
+  mBoundingRect     = mRenderCacheEntry->boundingRect;
+  mShape            = mRenderCacheEntry->shape;
 
   // texts
   mCachedTextProperties.clear();
@@ -183,77 +136,29 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept {
 void SGI_Symbol::paint(QPainter*                       painter,
                        const QStyleOptionGraphicsItem* option,
                        QWidget*                        widget) {
-  Q_UNUSED(widget);
-
   const GraphicsLayer* layer    = 0;
   const bool           selected = mSymbol.isSelected();
   const bool           deviceIsPrinter =
       (dynamic_cast<QPrinter*>(painter->device()) != 0);
   const qreal lod =
       option->levelOfDetailFromTransform(painter->worldTransform());
+  const GraphicsLevelOfDetail& lodSettings =
+      GraphicsLevelOfDetail::fromWidget(widget);
 
-  // draw all polygons
-  for (const Polygon& polygon : mLibSymbol.getPolygons()) {
-    // set colors
-    layer = getLayer(*polygon.getLayerName());
-    if (layer) {
-      if (!layer->isVisible()) layer = nullptr;
-    }
-    if (layer)
-      painter->setPen(QPen(layer->getColor(selected),
-                           polygon.getLineWidth()->toPx(), Qt::SolidLine,
-                           Qt::RoundCap, Qt::RoundJoin));
-    else
+  // if the symbol is too small on the screen, draw only its bounding box
+  if (!lodSettings.isItemDetailed(lod, mBoundingRect)) {
+    layer = getLayer(GraphicsLayer::sSymbolOutlines);
+    if (layer && layer->isVisible()) {
       painter->setPen(Qt::NoPen);
-    if (polygon.isFilled() && polygon.getPath().isClosed())
-      layer = getLayer(*polygon.getLayerName());
-    else if (polygon.isGrabArea())
-      layer = getLayer(GraphicsLayer::sSymbolGrabAreas);
-    else
-      layer = nullptr;
-    if (layer) {
-      if (!layer->isVisible()) layer = nullptr;
+      painter->setBrush(QBrush(layer->getColor(selected), Qt::Dense5Pattern));
+      painter->drawRect(mBoundingRect);
     }
-    painter->setBrush(layer
-                          ? QBrush(layer->getColor(selected), Qt::SolidPattern)
-                          : Qt::NoBrush);
-
-    // draw polygon
-    painter->drawPath(polygon.getPath().toQPainterPathPx());
+    return;
   }
 
-  // draw all circles
-  for (const Circle& circle : mLibSymbol.getCircles()) {
-    // set colors
-    layer = getLayer(*circle.getLayerName());
-    if (layer) {
-      if (!layer->isVisible()) layer = nullptr;
-    }
-    if (layer)
-      painter->setPen(QPen(layer->getColor(selected),
-                           circle.getLineWidth()->toPx(), Qt::SolidLine,
-                           Qt::RoundCap, Qt::RoundJoin));
-    else
-      painter->setPen(Qt::NoPen);
-    if (circle.isFilled())
-      layer = getLayer(*circle.getLayerName());
-    else if (circle.isGrabArea())
-      layer = getLayer(GraphicsLayer::sSymbolGrabAreas);
-    else
-      layer = nullptr;
-    if (layer) {
-      if (!layer->isVisible()) layer = nullptr;
-    }
-    painter->setBrush(layer
-                          ? QBrush(layer->getColor(selected), Qt::SolidPattern)
-                          : Qt::NoBrush);
-
-    // draw circle
-    painter->drawEllipse(circle.getCenter().toPxQPointF(),
-                         circle.getDiameter()->toPx() / 2,
-                         circle.getDiameter()->toPx() / 2);
-    // TODO: rotation
-  }
+  // draw all polygons and circles
+  mRenderCacheEntry = getRenderCacheEntry();
+  mRenderCacheEntry->draw(*painter, selected);
 
   // draw all texts
   for (const Text& text : mLibSymbol.getTexts()) {
@@ -280,7 +185,8 @@ void SGI_Symbol::paint(QPainter*                       painter,
     painter->translate(-text.getPosition().toPxQPointF());
     painter->scale(props.scaleFactor, props.scaleFactor);
     if (props.rotate180) painter->rotate(180);
-    if ((deviceIsPrinter) || (lod * text.getHeight()->toPx() > 8)) {
+    if ((deviceIsPrinter) ||
+        (lodSettings.isTextDetailed(lod, text.getHeight()->toPx()))) {
       // draw text
       painter->setPen(QPen(layer->getColor(selected), 0));
       painter->setFont(mFont);
@@ -353,6 +259,94 @@ GraphicsLayer* SGI_Symbol::getLayer(const QString& name) const noexcept {
   return mSymbol.getProject().getLayers().getLayer(name);
 }
 
+GraphicsRenderCache& SGI_Symbol::getRenderCache() const noexcept {
+  return mSymbol.getProject().getLayers().getRenderCache();
+}
+
+std::shared_ptr<const GraphicsRenderCache::Entry>
+    SGI_Symbol::getRenderCacheEntry() const noexcept {
+  GraphicsRenderCache& cache = getRenderCache();
+  return cache.get(&mLibSymbol, 0, [&](GraphicsRenderCache::Entry& entry) {
+    buildRenderCacheEntry(cache, mLibSymbol, entry);
+  });
+}
+
+void SGI_Symbol::buildRenderCacheEntry(
+    GraphicsRenderCache& cache, const library::Symbol& symbol,
+    GraphicsRenderCache::Entry& entry) noexcept {
+  entry.shape.setFillRule(Qt::WindingFill);
+
+  // cross rect
+  QRectF crossRect(-4, -4, 8, 8);
+  entry.boundingRect = entry.boundingRect.united(crossRect);
+  entry.shape.addRect(crossRect);
+
+  // polygons
+  for (const Polygon& polygon : symbol.getPolygons()) {
+    // query polygon path and line width
+    QPainterPath polygonPath = polygon.getPath().toQPainterPathPx();
+    qreal        w           = polygon.getLineWidth()->toPx() / 2;
+
+    // update bounding rectangle
+    entry.boundingRect = entry.boundingRect.united(
+        polygonPath.boundingRect().adjusted(-w, -w, w, w));
+
+    // update shape
+    if (polygon.isGrabArea()) {
+      QPainterPathStroker stroker;
+      stroker.setCapStyle(Qt::RoundCap);
+      stroker.setJoinStyle(Qt::RoundJoin);
+      stroker.setWidth(2 * w);
+      // add polygon area
+      entry.shape = entry.shape.united(polygonPath);
+      // add stroke area
+      entry.shape = entry.shape.united(stroker.createStroke(polygonPath));
+    }
+
+    // add drawing
+    GraphicsLayer* fillLayer = nullptr;
+    if (polygon.isFilled() && polygon.getPath().isClosed())
+      fillLayer = cache.getLayer(*polygon.getLayerName());
+    else if (polygon.isGrabArea())
+      fillLayer = cache.getLayer(GraphicsLayer::sSymbolGrabAreas);
+    entry.primitives.append(GraphicsRenderCache::Primitive(
+        polygonPath, cache.getLayer(*polygon.getLayerName()), 2 * w,
+        fillLayer));
+  }
+
+  // circles
+  for (const Circle& circle : symbol.getCircles()) {
+    // get circle radius, including compensation for the stroke width
+    qreal w = circle.getLineWidth()->toPx() / 2;
+    qreal r = circle.getDiameter()->toPx() / 2 + w;
+
+    // get the bounding rectangle for the circle
+    QPointF center = circle.getCenter().toPxQPointF();
+    QRectF  boundingRect =
+        QRectF(QPointF(center.x() - r, center.y() - r), QSizeF(r * 2, r * 2));
+
+    // update bounding rectangle
+    entry.boundingRect = entry.boundingRect.united(boundingRect);
+
+    // update shape
+    if (circle.isGrabArea()) {
+      entry.shape.addEllipse(center, r, r);
+    }
+
+    // add drawing
+    QPainterPath circlePath;
+    circlePath.addEllipse(center, circle.getDiameter()->toPx() / 2,
+                          circle.getDiameter()->toPx() / 2);
+    GraphicsLayer* fillLayer = nullptr;
+    if (circle.isFilled())
+      fillLayer = cache.getLayer(*circle.getLayerName());
+    else if (circle.isGrabArea())
+      fillLayer = cache.getLayer(GraphicsLayer::sSymbolGrabAreas);
+    entry.primitives.append(GraphicsRenderCache::Primitive(
+        circlePath, cache.getLayer(*circle.getLayerName()), 2 * w, fillLayer));
+  }
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -25,6 +25,8 @@
  ******************************************************************************/
 #include "sgi_base.h"
 
+#include <librepcb/common/graphics/graphicsrendercache.h>
+
 #include <QtCore>
 #include <QtWidgets>
 
@@ -73,7 +75,13 @@ private:
   SGI_Symbol& operator=(const SGI_Symbol& rhs) = delete;
 
   // Private Methods
-  GraphicsLayer* getLayer(const QString& name) const noexcept;
+  GraphicsLayer*       getLayer(const QString& name) const noexcept;
+  GraphicsRenderCache& getRenderCache() const noexcept;
+  std::shared_ptr<const GraphicsRenderCache::Entry> getRenderCacheEntry() const
+      noexcept;
+  static void buildRenderCacheEntry(GraphicsRenderCache&        cache,
+                                    const library::Symbol&      symbol,
+                                    GraphicsRenderCache::Entry& entry) noexcept;
 
   // Types
 
@@ -93,9 +101,10 @@ private:
   QFont                  mFont;
 
   // Cached Attributes
-  QRectF                                     mBoundingRect;
-  QPainterPath                               mShape;
-  QHash<const Text*, CachedTextProperties_t> mCachedTextProperties;
+  QRectF                                            mBoundingRect;
+  QPainterPath                                      mShape;
+  QHash<const Text*, CachedTextProperties_t>        mCachedTextProperties;
+  std::shared_ptr<const GraphicsRenderCache::Entry> mRenderCacheEntry;
 };
 
 /*******************************************************************************
@@ -79,6 +79,7 @@ void SI_Base::addToSchematic(SGI_Base* item) noexcept {
   Q_ASSERT(!mIsAddedToSchematic);
   if (item) {
     mSchematic.getGraphicsScene().addItem(*item);
+    mSchematic.mItemsByGraphicsItem.insert(item, this);
   }
   mIsAddedToSchematic = true;
 }
@@ -87,6 +88,7 @@ void SI_Base::removeFromSchematic(SGI_Base* item) noexcept {
   Q_ASSERT(mIsAddedToSchematic);
   if (item) {
     mSchematic.getGraphicsScene().removeItem(*item);
+    mSchematic.mItemsByGraphicsItem.remove(item);
   }
   mIsAddedToSchematic = false;
 }
@@ -37,6 +37,7 @@
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/gridproperties.h>
 #include <librepcb/common/scopeguardlist.h>
+#include <librepcb/common/toolbox.h>
 #include <librepcb/library/sym/symbolpin.h>
 
 #include <QtCore>
@@ -150,13 +151,15 @@ bool Schematic::isEmpty() const noexcept {
 }
 
 QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept {
-  QPointF scenePosPx = pos.toPxQPointF();
+  QPointF         scenePosPx = pos.toPxQPointF();
+  QList<SI_Base*> candidates = getItemCandidatesAtScenePos(pos);
   QList<SI_Base*>
       list;  // Note: The order of adding the items is very important (the
              // top most item must appear as the first item in the list)!
 
   // visible netpoints
-  const QList<SI_NetPoint*> netpoints(getNetPointsAtScenePos(pos));
+  const QList<SI_NetPoint*> netpoints(
+      filterItems<SI_NetPoint>(candidates, scenePosPx));
   foreach (SI_NetPoint* netpoint, netpoints) {
     if (netpoint->isVisibleJunction()) {
       list.append(netpoint);
@@ -169,15 +172,26 @@ QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept {
     }
   }
   // netlines
-  foreach (SI_NetLine* netline, getNetLinesAtScenePos(pos)) {
+  foreach (SI_NetLine* netline,
+           filterItems<SI_NetLine>(candidates, scenePosPx)) {
     list.append(netline);
   }
   // netlabels
-  foreach (SI_NetLabel* netlabel, getNetLabelsAtScenePos(pos)) {
+  foreach (SI_NetLabel* netlabel,
+           filterItems<SI_NetLabel>(candidates, scenePosPx)) {
     list.append(netlabel);
   }
-  // symbols & pins
+  // symbols & pins (only of symbols which have items at this position)
+  QSet<const SI_Symbol*> symbols;
+  foreach (SI_Base* item, candidates) {
+    if (const SI_Symbol* symbol = qobject_cast<SI_Symbol*>(item)) {
+      symbols.insert(symbol);
+    } else if (const SI_SymbolPin* pin = qobject_cast<SI_SymbolPin*>(item)) {
+      symbols.insert(&pin->getSymbol());
+    }
+  }
   foreach (SI_Symbol* symbol, mSymbols) {
+    if (!symbols.contains(symbol)) continue;
     foreach (SI_SymbolPin* pin, symbol->getPins()) {
       if (pin->getGrabAreaScenePx().contains(scenePosPx)) list.append(pin);
     }
@@ -188,41 +202,26 @@ QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept {
 
 QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const
     noexcept {
-  QList<SI_NetPoint*> list;
-  foreach (SI_NetSegment* segment, mNetSegments) {
-    segment->getNetPointsAtScenePos(pos, list);
-  }
-  return list;
+  return filterItems<SI_NetPoint>(getItemCandidatesAtScenePos(pos),
+                                  pos.toPxQPointF());
 }
 
 QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const
     noexcept {
-  QList<SI_NetLine*> list;
-  foreach (SI_NetSegment* segment, mNetSegments) {
-    segment->getNetLinesAtScenePos(pos, list);
-  }
-  return list;
+  return filterItems<SI_NetLine>(getItemCandidatesAtScenePos(pos),
+                                 pos.toPxQPointF());
 }
 
 QList<SI_NetLabel*> Schematic::getNetLabelsAtScenePos(const Point& pos) const
     noexcept {
-  QList<SI_NetLabel*> list;
-  foreach (SI_NetSegment* segment, mNetSegments) {
-    segment->getNetLabelsAtScenePos(pos, list);
-  }
-  return list;
+  return filterItems<SI_NetLabel>(getItemCandidatesAtScenePos(pos),
+                                  pos.toPxQPointF());
 }
 
 QList<SI_SymbolPin*> Schematic::getPinsAtScenePos(const Point& pos) const
     noexcept {
-  QList<SI_SymbolPin*> list;
-  foreach (SI_Symbol* symbol, mSymbols) {
-    foreach (SI_SymbolPin* pin, symbol->getPins()) {
-      if (pin->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-        list.append(pin);
-    }
-  }
-  return list;
+  return filterItems<SI_SymbolPin>(getItemCandidatesAtScenePos(pos),
+                                   pos.toPxQPointF());
 }
 
 /*******************************************************************************
@@ -380,16 +379,30 @@ void Schematic::setSelectionRect(const Point& p1, const Point& p2,
   mGraphicsScene->setSelectionRect(p1, p2);
   if (updateItems) {
     QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
+    // only the grab areas of items within the rect need to be checked
+    QSet<SI_Base*> candidates = Toolbox::toSet(getItemsOfGraphicsItems(
+        mGraphicsScene->items(rectPx, Qt::IntersectsItemBoundingRect)));
+    auto isInRect = [&](SI_Base* item) {
+      return candidates.contains(item) &&
+             item->getGrabAreaScenePx().intersects(rectPx);
+    };
     foreach (SI_Symbol* symbol, mSymbols) {
-      bool selectSymbol = symbol->getGrabAreaScenePx().intersects(rectPx);
+      bool selectSymbol = isInRect(symbol);
       symbol->setSelected(selectSymbol);
       foreach (SI_SymbolPin* pin, symbol->getPins()) {
-        bool selectPin = pin->getGrabAreaScenePx().intersects(rectPx);
-        pin->setSelected(selectSymbol || selectPin);
+        pin->setSelected(selectSymbol || isInRect(pin));
       }
     }
     foreach (SI_NetSegment* segment, mNetSegments) {
-      segment->setSelectionRect(rectPx);
+      foreach (SI_NetPoint* netpoint, segment->getNetPoints()) {
+        netpoint->setSelected(isInRect(netpoint));
+      }
+      foreach (SI_NetLine* netline, segment->getNetLines()) {
+        netline->setSelected(isInRect(netline));
+      }
+      foreach (SI_NetLabel* netlabel, segment->getNetLabels()) {
+        netlabel->setSelected(isInRect(netlabel));
+      }
     }
   }
 }
@@ -440,6 +453,40 @@ QVector<const AttributeProvider*> Schematic::getAttributeProviderParents() const
  *  Private Methods
  ******************************************************************************/
 
+QList<SI_Base*> Schematic::getItemCandidatesAtScenePos(const Point& pos) const
+    noexcept {
+  // The graphics scene maintains a spatial index (BSP tree) of the bounding
+  // rects of all graphics items, which is kept up to date when items are
+  // added, removed or moved. Using it to find candidates is much faster than
+  // checking the grab areas of all items of the schematic.
+  return getItemsOfGraphicsItems(mGraphicsScene->items(
+      pos.toPxQPointF(), Qt::IntersectsItemBoundingRect, Qt::DescendingOrder));
+}
+
+QList<SI_Base*> Schematic::getItemsOfGraphicsItems(
+    const QList<QGraphicsItem*>& graphicsItems) const noexcept {
+  QList<SI_Base*> items;
+  foreach (const QGraphicsItem* graphicsItem, graphicsItems) {
+    if (SI_Base* item = mItemsByGraphicsItem.value(graphicsItem)) {
+      items.append(item);
+    }
+  }
+  return items;
+}
+
+template <typename T>
+QList<T*> Schematic::filterItems(const QList<SI_Base*>& items,
+                                 const QPointF&         scenePosPx) noexcept {
+  QList<T*> list;
+  foreach (SI_Base* item, items) {
+    T* typedItem = qobject_cast<T*>(item);
+    if (typedItem && typedItem->getGrabAreaScenePx().contains(scenePosPx)) {
+      list.append(typedItem);
+    }
+  }
+  return list;
+}
+
 void Schematic::updateIcon() noexcept {
   mIcon = QIcon(mGraphicsScene->toPixmap(QSize(297, 210), Qt::white));
 }
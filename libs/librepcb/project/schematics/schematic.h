@@ -79,12 +79,20 @@ class SchematicSelectionQuery;
  *  - polygon:          TODO
  *  - circle:           TODO
  *  - text:             TODO
+ *
+ * The methods to get items at a specific position (e.g. #getItemsAtScenePos())
+ * and #setSelectionRect() use the spatial index of the graphics scene to find
+ * candidates and only check the grab areas of those. Thus their runtime
+ * doesn't grow with the size of the schematic.
  */
 class Schematic final : public QObject,
                         public AttributeProvider,
                         public SerializableObject {
   Q_OBJECT
 
+  // SI_Base needs to register its graphics item in #mItemsByGraphicsItem
+  friend class SI_Base;
+
 public:
   // Types
 
@@ -194,7 +202,13 @@ signals:
 private:
   Schematic(Project& project, std::unique_ptr<TransactionalDirectory> directory,
             bool create, const QString& newName);
-  void updateIcon() noexcept;
+  void            updateIcon() noexcept;
+  QList<SI_Base*> getItemCandidatesAtScenePos(const Point& pos) const noexcept;
+  QList<SI_Base*> getItemsOfGraphicsItems(
+      const QList<QGraphicsItem*>& graphicsItems) const noexcept;
+  template <typename T>
+  static QList<T*> filterItems(const QList<SI_Base*>& items,
+                               const QPointF&         scenePosPx) noexcept;
 
   /// @copydoc librepcb::SerializableObject::serialize()
   void serialize(SExpression& root) const override;
@@ -215,6 +229,9 @@ private:
 
   QList<SI_Symbol*>     mSymbols;
   QList<SI_NetSegment*> mNetSegments;
+
+  /// All items which are added to the graphics scene, by their graphics item
+  QHash<const QGraphicsItem*, SI_Base*> mItemsByGraphicsItem;
 };
 
 /*******************************************************************************
@@ -35,7 +35,7 @@ namespace project {
  ******************************************************************************/
 
 SchematicLayerProvider::SchematicLayerProvider(Project& project)
-  : mProject(project) {
+  : mProject(project), mRenderCache(*this) {
   // add all required layers
   addLayer(GraphicsLayer::sSchematicReferences);
   addLayer(GraphicsLayer::sSchematicSheetFrames);
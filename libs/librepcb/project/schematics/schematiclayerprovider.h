@@ -25,6 +25,7 @@
  ******************************************************************************/
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/graphics/graphicsrendercache.h>
 
 #include <QtCore>
 
@@ -54,7 +55,8 @@ public:
   ~SchematicLayerProvider() noexcept;
 
   // Getters
-  Project& getProject() const noexcept { return mProject; }
+  Project&             getProject() const noexcept { return mProject; }
+  GraphicsRenderCache& getRenderCache() noexcept { return mRenderCache; }
 
   /// @copydoc ::librepcb::IF_GraphicsLayerProvider::getLayer()
   GraphicsLayer* getLayer(const QString& name) const noexcept override {
@@ -79,6 +81,7 @@ private:  // Methods
 private:              // Data
   Project& mProject;  ///< A reference to the Project object (from the ctor)
   QList<GraphicsLayer*> mLayers;
+  GraphicsRenderCache   mRenderCache;  ///< Shared symbol drawings
 };
 
 /*******************************************************************************
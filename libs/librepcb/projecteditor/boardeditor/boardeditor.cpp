@@ -134,6 +134,10 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project)
   mGraphicsView = new GraphicsView(nullptr, this);
   mGraphicsView->setUseOpenGl(
       mProjectEditor.getWorkspace().getSettings().useOpenGl.get());
+  mGraphicsView->setLevelOfDetail(
+      mProjectEditor.getWorkspace().getSettings().getLevelOfDetail());
+  mGraphicsView->setBackgroundTileCacheEnabled(
+      mProjectEditor.getWorkspace().getSettings().useBackgroundTileCache.get());
   mGraphicsView->setBackgroundBrush(Qt::black);
   mGraphicsView->setForegroundBrush(Qt::white);
   // setCentralWidget(mGraphicsView);
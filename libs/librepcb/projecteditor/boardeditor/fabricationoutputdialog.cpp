@@ -79,6 +79,8 @@ FabricationOutputDialog::FabricationOutputDialog(Board& board, QWidget* parent)
   mUi->cbxDrillsMerge->setChecked(s.getMergeDrillFiles());
   mUi->cbxSolderPasteTop->setChecked(s.getEnableSolderPasteTop());
   mUi->cbxSolderPasteBot->setChecked(s.getEnableSolderPasteBot());
+  mUi->cbxOptimizeGerber->setChecked(s.getOptimizeGerberFiles());
+  mUi->cbxOptimizeDrillPaths->setChecked(s.getOptimizeDrillPaths());
 
   QStringList topSilkscreen = s.getSilkscreenLayersTop();
   mUi->cbxSilkTopPlacement->setChecked(
@@ -166,6 +168,8 @@ void FabricationOutputDialog::on_btnGenerate_clicked() {
     s.setMergeDrillFiles(mUi->cbxDrillsMerge->isChecked());
     s.setEnableSolderPasteTop(mUi->cbxSolderPasteTop->isChecked());
     s.setEnableSolderPasteBot(mUi->cbxSolderPasteBot->isChecked());
+    s.setOptimizeGerberFiles(mUi->cbxOptimizeGerber->isChecked());
+    s.setOptimizeDrillPaths(mUi->cbxOptimizeDrillPaths->isChecked());
     if (s != mBoard.getFabricationOutputSettings()) {
       mBoard.getFabricationOutputSettings() = s;  // TODO: use undo command
     }
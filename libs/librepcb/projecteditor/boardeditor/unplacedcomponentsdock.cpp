@@ -26,7 +26,6 @@
 #include "../projecteditor.h"
 #include "ui_unplacedcomponentsdock.h"
 
-#include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/graphics/defaultgraphicslayerprovider.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/graphicsview.h>
@@ -42,6 +41,7 @@
 #include <librepcb/project/project.h>
 #include <librepcb/project/settings/projectsettings.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/library/workspacelibraryelementcache.h>
 #include <librepcb/workspace/workspace.h>
 
 #include <QtCore>
@@ -67,8 +67,8 @@ UnplacedComponentsDock::UnplacedComponentsDock(ProjectEditor& editor)
     mFootprintPreviewGraphicsScene(nullptr),
     mFootprintPreviewGraphicsItem(nullptr),
     mSelectedComponent(nullptr),
-    mSelectedDevice(nullptr),
-    mSelectedPackage(nullptr),
+    mSelectedDevice(),
+    mSelectedPackage(),
     mSelectedFootprintUuid(),
     mCircuitConnection1(),
     mCircuitConnection2(),
@@ -191,17 +191,16 @@ void UnplacedComponentsDock::on_cbxSelectedDevice_currentIndexChanged(
       devFp = mProjectEditor.getWorkspace().getLibraryDb().getLatestDevice(
           *deviceUuid);
     if (devFp.isValid()) {
-      const library::Device* device = new library::Device(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(devFp))));
+      workspace::WorkspaceLibraryElementCache& cache =
+          mProjectEditor.getWorkspace().getLibraryElementCache();
+      std::shared_ptr<const library::Device> device =
+          cache.getDevice(devFp);  // can throw
       FilePath pkgFp =
           mProjectEditor.getWorkspace().getLibraryDb().getLatestPackage(
               device->getPackageUuid());
       if (pkgFp.isValid()) {
-        const library::Package* package = new library::Package(
-            std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-                TransactionalFileSystem::openRO(pkgFp))));
-        setSelectedDeviceAndPackage(device, package);
+        setSelectedDeviceAndPackage(device,
+                                    cache.getPackage(pkgFp));  // can throw
       } else {
         setSelectedDeviceAndPackage(nullptr, nullptr);
       }
@@ -392,13 +391,12 @@ void UnplacedComponentsDock::setSelectedComponentInstance(
 }
 
 void UnplacedComponentsDock::setSelectedDeviceAndPackage(
-    const library::Device* device, const library::Package* package) noexcept {
+    std::shared_ptr<const library::Device>  device,
+    std::shared_ptr<const library::Package> package) noexcept {
   setSelectedFootprintUuid(tl::nullopt);
   mUi->cbxSelectedFootprint->clear();
-  delete mSelectedPackage;
-  mSelectedPackage = nullptr;
-  delete mSelectedDevice;
-  mSelectedDevice = nullptr;
+  mSelectedPackage.reset();
+  mSelectedDevice.reset();
 
   if (mBoard && mSelectedComponent && device && package) {
     if (device->getComponentUuid() ==
@@ -440,7 +438,7 @@ void UnplacedComponentsDock::setSelectedFootprintUuid(
     if (fpt) {
       mFootprintPreviewGraphicsItem = new library::FootprintPreviewGraphicsItem(
           *mGraphicsLayerProvider, mProject.getSettings().getLocaleOrder(),
-          *fpt, mSelectedPackage, &mSelectedComponent->getLibComponent(),
+          *fpt, mSelectedPackage.get(), &mSelectedComponent->getLibComponent(),
           mSelectedComponent);
       mFootprintPreviewGraphicsScene->addItem(*mFootprintPreviewGraphicsItem);
       mUi->graphicsView->zoomAll();
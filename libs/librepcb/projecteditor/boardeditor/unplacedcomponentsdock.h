@@ -29,6 +29,8 @@
 #include <QtCore>
 #include <QtWidgets>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -105,8 +107,9 @@ private:
   // Private Methods
   void updateComponentsList() noexcept;
   void setSelectedComponentInstance(ComponentInstance* cmp) noexcept;
-  void setSelectedDeviceAndPackage(const library::Device*  device,
-                                   const library::Package* package) noexcept;
+  void setSelectedDeviceAndPackage(
+      std::shared_ptr<const library::Device>  device,
+      std::shared_ptr<const library::Package> package) noexcept;
   void setSelectedFootprintUuid(const tl::optional<Uuid>& uuid) noexcept;
   void beginUndoCmdGroup() noexcept;
   void addNextDeviceToCmdGroup(
@@ -125,8 +128,8 @@ private:
   GraphicsScene*                               mFootprintPreviewGraphicsScene;
   library::FootprintPreviewGraphicsItem*       mFootprintPreviewGraphicsItem;
   ComponentInstance*                           mSelectedComponent;
-  const library::Device*                       mSelectedDevice;
-  const library::Package*                      mSelectedPackage;
+  std::shared_ptr<const library::Device>       mSelectedDevice;
+  std::shared_ptr<const library::Package>      mSelectedPackage;
   tl::optional<Uuid>                           mSelectedFootprintUuid;
   QMetaObject::Connection                      mCircuitConnection1;
   QMetaObject::Connection                      mCircuitConnection2;
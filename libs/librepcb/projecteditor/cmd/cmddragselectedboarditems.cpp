@@ -26,6 +26,7 @@
 #include <librepcb/common/geometry/cmd/cmdpolygonedit.h>
 #include <librepcb/common/geometry/cmd/cmdstroketextedit.h>
 #include <librepcb/common/gridproperties.h>
+#include <librepcb/common/scopeguard.h>
 #include <librepcb/project/boards/board.h>
 #include <librepcb/project/boards/boardselectionquery.h>
 #include <librepcb/project/boards/cmd/cmdboardnetpointedit.h>
@@ -154,7 +155,9 @@ void CmdDragSelectedBoardItems::setCurrentPosition(const Point& pos) noexcept {
   delta.mapToGrid(mBoard.getGridProperties().getInterval());
 
   if (delta != mDeltaPos) {
-    // move selected elements
+    // move selected elements (net lines attached to several moved items are
+    // updated only once, after all items are moved)
+    mBoard.beginDeferredNetLineUpdates();
     foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
       cmd->translate(delta - mDeltaPos, true);
     }
@@ -176,6 +179,7 @@ void CmdDragSelectedBoardItems::setCurrentPosition(const Point& pos) noexcept {
     foreach (CmdHoleEdit* cmd, mHoleEditCmds) {
       cmd->translate(delta - mDeltaPos, true);
     }
+    mBoard.endDeferredNetLineUpdates();
     mDeltaPos = delta;
 
     // Force updating airwires immediately as they are important while moving
@@ -189,6 +193,7 @@ void CmdDragSelectedBoardItems::rotate(const Angle& angle,
   Point center = (aroundItemsCenter ? mCenterPos : mStartPos) + mDeltaPos;
 
   // rotate selected elements
+  mBoard.beginDeferredNetLineUpdates();
   foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
     cmd->rotate(angle, center, true);
   }
@@ -210,6 +215,7 @@ void CmdDragSelectedBoardItems::rotate(const Angle& angle,
   foreach (CmdHoleEdit* cmd, mHoleEditCmds) {
     cmd->rotate(angle, center, true);
   }
+  mBoard.endDeferredNetLineUpdates();
   mDeltaAngle += angle;
 
   // Force updating airwires immediately as they are important while dragging
@@ -264,9 +270,23 @@ bool CmdDragSelectedBoardItems::performExecute() {
   }
 
   // execute all child commands
+  mBoard.beginDeferredNetLineUpdates();
+  auto sg = scopeGuard([this]() { mBoard.endDeferredNetLineUpdates(); });
   return UndoCommandGroup::performExecute();  // can throw
 }
 
+void CmdDragSelectedBoardItems::performUndo() {
+  mBoard.beginDeferredNetLineUpdates();
+  auto sg = scopeGuard([this]() { mBoard.endDeferredNetLineUpdates(); });
+  UndoCommandGroup::performUndo();  // can throw
+}
+
+void CmdDragSelectedBoardItems::performRedo() {
+  mBoard.beginDeferredNetLineUpdates();
+  auto sg = scopeGuard([this]() { mBoard.endDeferredNetLineUpdates(); });
+  UndoCommandGroup::performRedo();  // can throw
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
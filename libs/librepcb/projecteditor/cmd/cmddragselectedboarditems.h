@@ -71,6 +71,12 @@ private:
   /// @copydoc UndoCommand::performExecute()
   bool performExecute() override;
 
+  /// @copydoc UndoCommand::performUndo()
+  void performUndo() override;
+
+  /// @copydoc UndoCommand::performRedo()
+  void performRedo() override;
+
   // Private Member Variables
   Board& mBoard;
   Point  mStartPos;
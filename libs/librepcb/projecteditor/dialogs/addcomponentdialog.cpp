@@ -24,7 +24,6 @@
 
 #include "ui_addcomponentdialog.h"
 
-#include <librepcb/common/fileio/transactionalfilesystem.h>
 #include <librepcb/common/graphics/defaultgraphicslayerprovider.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/graphics/graphicsview.h>
@@ -45,6 +44,7 @@
 #include <librepcb/project/settings/projectsettings.h>
 #include <librepcb/workspace/library/cat/categorytreemodel.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/library/workspacelibraryelementcache.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/workspace/workspace.h>
 
@@ -71,10 +71,10 @@ AddComponentDialog::AddComponentDialog(workspace::Workspace& workspace,
     mComponentPreviewScene(nullptr),
     mDevicePreviewScene(nullptr),
     mCategoryTreeModel(nullptr),
-    mSelectedComponent(nullptr),
+    mSelectedComponent(),
     mSelectedSymbVar(nullptr),
-    mSelectedDevice(nullptr),
-    mSelectedPackage(nullptr),
+    mSelectedDevice(),
+    mSelectedPackage(),
     mPreviewFootprintGraphicsItem(nullptr) {
   mUi->setupUi(this);
   mUi->treeComponents->setColumnCount(2);
@@ -121,13 +121,11 @@ AddComponentDialog::~AddComponentDialog() noexcept {
   mPreviewFootprintGraphicsItem = nullptr;
   qDeleteAll(mPreviewSymbolGraphicsItems);
   mPreviewSymbolGraphicsItems.clear();
-  delete mSelectedPackage;
-  mSelectedPackage = nullptr;
-  delete mSelectedDevice;
-  mSelectedDevice  = nullptr;
+  mPreviewSymbols.clear();
+  mSelectedPackage.reset();
+  mSelectedDevice.reset();
   mSelectedSymbVar = nullptr;
-  delete mSelectedComponent;
-  mSelectedComponent = nullptr;
+  mSelectedComponent.reset();
   delete mCategoryTreeModel;
   mCategoryTreeModel = nullptr;
   delete mDevicePreviewScene;
@@ -205,20 +203,15 @@ void AddComponentDialog::treeComponents_currentItemChanged(
       FilePath cmpFp = FilePath(cmpItem->data(0, Qt::UserRole).toString());
       if ((!mSelectedComponent) ||
           (mSelectedComponent->getDirectory().getAbsPath() != cmpFp)) {
-        library::Component* component = new library::Component(
-            std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-                TransactionalFileSystem::openRO(cmpFp))));
-        setSelectedComponent(component);
+        setSelectedComponent(
+            mWorkspace.getLibraryElementCache().getComponent(cmpFp));
       }
       if (current->parent()) {
         FilePath devFp = FilePath(current->data(0, Qt::UserRole).toString());
         if ((!mSelectedDevice) ||
             (mSelectedDevice->getDirectory().getAbsPath() != devFp)) {
-          library::Device* device =
-              new library::Device(std::unique_ptr<TransactionalDirectory>(
-                  new TransactionalDirectory(
-                      TransactionalFileSystem::openRO(devFp))));
-          setSelectedDevice(device);
+          setSelectedDevice(
+              mWorkspace.getLibraryElementCache().getDevice(devFp));
         }
       } else {
         setSelectedDevice(nullptr);
@@ -421,7 +414,8 @@ void AddComponentDialog::setSelectedCategory(
   mUi->treeComponents->sortByColumn(0, Qt::AscendingOrder);
 }
 
-void AddComponentDialog::setSelectedComponent(const library::Component* cmp) {
+void AddComponentDialog::setSelectedComponent(
+    std::shared_ptr<const library::Component> cmp) {
   if (cmp && (cmp == mSelectedComponent)) return;
 
   mUi->lblCompName->setText(tr("No component selected"));
@@ -429,8 +423,7 @@ void AddComponentDialog::setSelectedComponent(const library::Component* cmp) {
   mUi->cbxSymbVar->clear();
   setSelectedDevice(nullptr);
   setSelectedSymbVar(nullptr);
-  delete mSelectedComponent;
-  mSelectedComponent = nullptr;
+  mSelectedComponent.reset();
 
   if (cmp) {
     const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
@@ -466,6 +459,7 @@ void AddComponentDialog::setSelectedSymbVar(
   if (symbVar && (symbVar == mSelectedSymbVar)) return;
   qDeleteAll(mPreviewSymbolGraphicsItems);
   mPreviewSymbolGraphicsItems.clear();
+  mPreviewSymbols.clear();
   mSelectedSymbVar = symbVar;
 
   if (mSelectedComponent && symbVar) {
@@ -475,14 +469,13 @@ void AddComponentDialog::setSelectedSymbVar(
       FilePath symbolFp =
           mWorkspace.getLibraryDb().getLatestSymbol(item.getSymbolUuid());
       if (!symbolFp.isValid()) continue;  // TODO: show warning
-      const library::Symbol* symbol =
-          new library::Symbol(std::unique_ptr<TransactionalDirectory>(
-              new TransactionalDirectory(TransactionalFileSystem::openRO(
-                  symbolFp))));  // TODO: fix memory leak...
+      std::shared_ptr<const library::Symbol> symbol =
+          mWorkspace.getLibraryElementCache().getSymbol(symbolFp);
+      mPreviewSymbols.append(symbol);
       library::SymbolPreviewGraphicsItem* graphicsItem =
           new library::SymbolPreviewGraphicsItem(
-              *mGraphicsLayerProvider, localeOrder, *symbol, mSelectedComponent,
-              symbVar->getUuid(), item.getUuid());
+              *mGraphicsLayerProvider, localeOrder, *symbol,
+              mSelectedComponent.get(), symbVar->getUuid(), item.getUuid());
       graphicsItem->setPos(item.getSymbolPosition().toPxQPointF());
       graphicsItem->setRotation(-item.getSymbolRotation().toDeg());
       mPreviewSymbolGraphicsItems.append(graphicsItem);
@@ -492,16 +485,15 @@ void AddComponentDialog::setSelectedSymbVar(
   }
 }
 
-void AddComponentDialog::setSelectedDevice(const library::Device* dev) {
+void AddComponentDialog::setSelectedDevice(
+    std::shared_ptr<const library::Device> dev) {
   if (dev && (dev == mSelectedDevice)) return;
 
   mUi->lblDeviceName->setText(tr("No device selected"));
   delete mPreviewFootprintGraphicsItem;
   mPreviewFootprintGraphicsItem = nullptr;
-  delete mSelectedPackage;
-  mSelectedPackage = nullptr;
-  delete mSelectedDevice;
-  mSelectedDevice = nullptr;
+  mSelectedPackage.reset();
+  mSelectedDevice.reset();
 
   if (dev) {
     mSelectedDevice                = dev;
@@ -509,9 +501,8 @@ void AddComponentDialog::setSelectedDevice(const library::Device* dev) {
     FilePath           pkgFp       = mWorkspace.getLibraryDb().getLatestPackage(
         mSelectedDevice->getPackageUuid());
     if (pkgFp.isValid()) {
-      mSelectedPackage = new library::Package(
-          std::unique_ptr<TransactionalDirectory>(new TransactionalDirectory(
-              TransactionalFileSystem::openRO(pkgFp))));
+      mSelectedPackage =
+          mWorkspace.getLibraryElementCache().getPackage(pkgFp);
       QString devName = *mSelectedDevice->getNames().value(localeOrder);
       QString pkgName = *mSelectedPackage->getNames().value(localeOrder);
       if (devName.contains(pkgName, Qt::CaseInsensitive)) {
@@ -524,8 +515,8 @@ void AddComponentDialog::setSelectedDevice(const library::Device* dev) {
         mPreviewFootprintGraphicsItem =
             new library::FootprintPreviewGraphicsItem(
                 *mGraphicsLayerProvider, localeOrder,
-                *mSelectedPackage->getFootprints().first(), mSelectedPackage,
-                mSelectedComponent);
+                *mSelectedPackage->getFootprints().first(),
+                mSelectedPackage.get(), mSelectedComponent.get());
         mDevicePreviewScene->addItem(*mPreviewFootprintGraphicsItem);
         mUi->viewDevice->zoomAll();
       }
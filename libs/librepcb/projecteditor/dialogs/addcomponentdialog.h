@@ -31,6 +31,8 @@
 #include <QtCore>
 #include <QtWidgets>
 
+#include <memory>
+
 /*******************************************************************************
  *  Namespace / Forward Declarations
  ******************************************************************************/
@@ -116,9 +118,9 @@ private:
   void         searchComponents(const QString& input);
   SearchResult searchComponentsAndDevices(const QString& input);
   void         setSelectedCategory(const tl::optional<Uuid>& categoryUuid);
-  void         setSelectedComponent(const library::Component* cmp);
+  void setSelectedComponent(std::shared_ptr<const library::Component> cmp);
   void setSelectedSymbVar(const library::ComponentSymbolVariant* symbVar);
-  void setSelectedDevice(const library::Device* dev);
+  void setSelectedDevice(std::shared_ptr<const library::Device> dev);
   void accept() noexcept;
 
   // General
@@ -131,13 +133,14 @@ private:
   workspace::ComponentCategoryTreeModel*       mCategoryTreeModel;
 
   // Attributes
-  tl::optional<Uuid>                         mSelectedCategoryUuid;
-  const library::Component*                  mSelectedComponent;
-  const library::ComponentSymbolVariant*     mSelectedSymbVar;
-  const library::Device*                     mSelectedDevice;
-  const library::Package*                    mSelectedPackage;
-  QList<library::SymbolPreviewGraphicsItem*> mPreviewSymbolGraphicsItems;
-  library::FootprintPreviewGraphicsItem*     mPreviewFootprintGraphicsItem;
+  tl::optional<Uuid>                            mSelectedCategoryUuid;
+  std::shared_ptr<const library::Component>     mSelectedComponent;
+  const library::ComponentSymbolVariant*        mSelectedSymbVar;
+  std::shared_ptr<const library::Device>        mSelectedDevice;
+  std::shared_ptr<const library::Package>       mSelectedPackage;
+  QList<std::shared_ptr<const library::Symbol>> mPreviewSymbols;
+  QList<library::SymbolPreviewGraphicsItem*>    mPreviewSymbolGraphicsItems;
+  library::FootprintPreviewGraphicsItem*        mPreviewFootprintGraphicsItem;
 };
 
 /*******************************************************************************
@@ -110,6 +110,10 @@ SchematicEditor::SchematicEditor(ProjectEditor& projectEditor, Project& project)
   mGraphicsView = new GraphicsView(nullptr, this);
   mGraphicsView->setUseOpenGl(
       mProjectEditor.getWorkspace().getSettings().useOpenGl.get());
+  mGraphicsView->setLevelOfDetail(
+      mProjectEditor.getWorkspace().getSettings().getLevelOfDetail());
+  mGraphicsView->setBackgroundTileCacheEnabled(
+      mProjectEditor.getWorkspace().getSettings().useBackgroundTileCache.get());
   setCentralWidget(mGraphicsView);
 
   // Add actions to toggle visibility of dock widgets
@@ -0,0 +1,145 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "workspacelibraryelementcache.h"
+
+#include "workspacelibrarydb.h"
+
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/cmp/component.h>
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/library/sym/symbol.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+using namespace library;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+WorkspaceLibraryElementCache::WorkspaceLibraryElementCache(
+    const WorkspaceLibraryDb& db, int maxCost) noexcept
+  : mDb(db), mCache(maxCost), mHits(0), mMisses(0) {
+}
+
+WorkspaceLibraryElementCache::~WorkspaceLibraryElementCache() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+std::shared_ptr<const Symbol> WorkspaceLibraryElementCache::getSymbol(
+    const FilePath& dir) {
+  return getElement<Symbol>(dir);
+}
+
+std::shared_ptr<const Package> WorkspaceLibraryElementCache::getPackage(
+    const FilePath& dir) {
+  return getElement<Package>(dir);
+}
+
+std::shared_ptr<const Component> WorkspaceLibraryElementCache::getComponent(
+    const FilePath& dir) {
+  return getElement<Component>(dir);
+}
+
+std::shared_ptr<const Device> WorkspaceLibraryElementCache::getDevice(
+    const FilePath& dir) {
+  return getElement<Device>(dir);
+}
+
+void WorkspaceLibraryElementCache::clear() noexcept {
+  mCache.clear();
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+template <typename ElementType>
+std::shared_ptr<const ElementType> WorkspaceLibraryElementCache::getElement(
+    const FilePath& dir) {
+  auto load = [](std::shared_ptr<TransactionalFileSystem> fs) {
+    return std::make_shared<ElementType>(
+        std::unique_ptr<TransactionalDirectory>(
+            new TransactionalDirectory(fs)));  // can throw
+  };
+
+  // determine the identity of the element
+  Uuid    uuid    = Uuid::createRandom();        // just for initialization
+  Version version = Version::fromString("0.1");  // just for initialization
+  try {
+    mDb.getElementMetadata<ElementType>(dir, &uuid, &version);  // can throw
+  } catch (const Exception&) {
+    qDebug() << "Element not cached since it's not in the library database:"
+             << dir.toNative();
+    return load(TransactionalFileSystem::openRO(dir));  // can throw
+  }
+  QString   fileName = ElementType::getLongElementName() % ".lp";
+  QFileInfo fileInfo(dir.getPathTo(fileName).toStr());
+  Stamp     stamp{uuid, version, fileInfo.lastModified(), fileInfo.size()};
+  Key       key{ElementType::getShortElementName(), dir.toStr()};
+
+  // return the cached element if it is still up to date
+  Entry* entry = mCache.object(key);
+  if (entry && (entry->stamp == stamp)) {
+    ++mHits;
+    return std::static_pointer_cast<const ElementType>(entry->element);
+  }
+
+  // otherwise compare the content of the files to avoid reloading elements
+  // which were only touched
+  std::shared_ptr<TransactionalFileSystem> fs =
+      TransactionalFileSystem::openRO(dir);  // can throw
+  QByteArray         content = fs->read(fileName);  // can throw
+  QCryptographicHash hashGenerator(QCryptographicHash::Sha256);
+  hashGenerator.addData(
+      fs->read(".librepcb-" % ElementType::getShortElementName()));
+  hashGenerator.addData(content);
+  QByteArray hash = hashGenerator.result();
+  if (entry && (entry->hash == hash)) {
+    ++mHits;
+    entry->stamp = stamp;
+    return std::static_pointer_cast<const ElementType>(entry->element);
+  }
+  ++mMisses;
+  std::shared_ptr<const ElementType> element = load(fs);  // can throw
+  mCache.insert(key, new Entry{stamp, hash, element},
+                qMax(content.size(), 1));
+  return element;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace workspace
+}  // namespace librepcb
@@ -0,0 +1,160 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_WORKSPACE_WORKSPACELIBRARYELEMENTCACHE_H
+#define LIBREPCB_WORKSPACE_WORKSPACELIBRARYELEMENTCACHE_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/uuid.h>
+#include <librepcb/common/version.h>
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+namespace library {
+class LibraryBaseElement;
+class Symbol;
+class Package;
+class Component;
+class Device;
+}  // namespace library
+
+namespace workspace {
+
+class WorkspaceLibraryDb;
+
+/*******************************************************************************
+ *  Class WorkspaceLibraryElementCache
+ ******************************************************************************/
+
+/**
+ * @brief The WorkspaceLibraryElementCache class shares read-only instances of
+ *        workspace library elements
+ *
+ * Loading a library element means parsing its whole file, which is too slow
+ * to be done again every time an element is previewed (e.g. when stepping
+ * through search results). This cache keeps the most recently used elements
+ * in memory and hands out shared, immutable instances of them.
+ *
+ * Elements are identified by their type and directory. A cached element is
+ * returned as long as its UUID and version in the ::librepcb::workspace::
+ * WorkspaceLibraryDb and the modification time and size of its main file are
+ * unchanged, so a hit doesn't need to read any files. Otherwise the files are
+ * read and hashed, and the element is only loaded again if their content has
+ * actually changed. So an element which was modified on disk (or replaced by
+ * another version) is loaded again, while stale instances are never returned.
+ * Elements which are not (yet) known by the library database are loaded
+ * without caching them.
+ *
+ * The memory is bounded by #getMaxCost(), which is the sum of the file sizes
+ * of all cached elements. If the limit is exceeded, the least recently used
+ * elements are dropped. Instances which are still in use stay valid since
+ * they are reference counted.
+ *
+ * @note This class is not thread-safe, use it from the GUI thread only.
+ */
+class WorkspaceLibraryElementCache final {
+public:
+  // Constructors / Destructor
+  WorkspaceLibraryElementCache() = delete;
+  WorkspaceLibraryElementCache(const WorkspaceLibraryElementCache& other) =
+      delete;
+  explicit WorkspaceLibraryElementCache(
+      const WorkspaceLibraryDb& db, int maxCost = 16 * 1024 * 1024) noexcept;
+  ~WorkspaceLibraryElementCache() noexcept;
+
+  // Getters
+  int getMaxCost() const noexcept { return mCache.maxCost(); }
+  int getTotalCost() const noexcept { return mCache.totalCost(); }
+  int getCount() const noexcept { return mCache.count(); }
+  int getHits() const noexcept { return mHits; }
+  int getMisses() const noexcept { return mMisses; }
+
+  // Setters
+  void setMaxCost(int cost) noexcept { mCache.setMaxCost(cost); }
+
+  // General Methods
+  std::shared_ptr<const library::Symbol>    getSymbol(const FilePath& dir);
+  std::shared_ptr<const library::Package>   getPackage(const FilePath& dir);
+  std::shared_ptr<const library::Component> getComponent(const FilePath& dir);
+  std::shared_ptr<const library::Device>    getDevice(const FilePath& dir);
+  void                                      clear() noexcept;
+
+  // Operator Overloadings
+  WorkspaceLibraryElementCache& operator=(
+      const WorkspaceLibraryElementCache& rhs) = delete;
+
+private:  // Types
+  struct Key {
+    QString type;
+    QString dir;
+
+    bool operator==(const Key& rhs) const noexcept {
+      return (type == rhs.type) && (dir == rhs.dir);
+    }
+    friend uint qHash(const Key& key, uint seed) noexcept {
+      return ::qHash(key.dir, seed) ^ ::qHash(key.type, seed);
+    }
+  };
+  struct Stamp {
+    Uuid      uuid;          ///< UUID according to the library database
+    Version   version;       ///< Version according to the library database
+    QDateTime lastModified;  ///< Modification time of the main file
+    qint64    size;          ///< Size of the main file
+
+    bool operator==(const Stamp& rhs) const noexcept {
+      return (uuid == rhs.uuid) && (version == rhs.version) &&
+             (lastModified == rhs.lastModified) && (size == rhs.size);
+    }
+  };
+  typedef std::shared_ptr<const library::LibraryBaseElement> Element;
+  struct Entry {
+    Stamp      stamp;
+    QByteArray hash;  ///< Hash of the files the element was loaded from
+    Element    element;
+  };
+
+private:  // Methods
+  template <typename ElementType>
+  std::shared_ptr<const ElementType> getElement(const FilePath& dir);
+
+private:  // Data
+  const WorkspaceLibraryDb& mDb;
+  QCache<Key, Entry>        mCache;
+  int                       mHits;
+  int                       mMisses;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace workspace
+}  // namespace librepcb
+
+#endif  // LIBREPCB_WORKSPACE_WORKSPACELIBRARYELEMENTCACHE_H
@@ -47,6 +47,10 @@ WorkspaceSettings::WorkspaceSettings(const FilePath& fp, QObject* parent)
     defaultLengthUnit("default_length_unit", LengthUnit::millimeters(), this),
     projectAutosaveIntervalSeconds("project_autosave_interval", 600U, this),
     useOpenGl("use_opengl", false, this),
+    useBackgroundTileCache("use_background_tile_cache", false, this),
+    useLevelOfDetail("use_level_of_detail", true, this),
+    levelOfDetailMinTextHeight("level_of_detail_min_text_height", 8U, this),
+    levelOfDetailMinItemSize("level_of_detail_min_item_size", 4U, this),
     libraryLocaleOrder("library_locale_order", "locale", QStringList(), this),
     libraryNormOrder("library_norm_order", "norm", QStringList(), this),
     repositoryUrls("repositories", "repository",
@@ -90,6 +94,12 @@ void WorkspaceSettings::saveToFile() const {
   FileUtils::writeFile(mFilePath, doc.toByteArray());  // can throw
 }
 
+GraphicsLevelOfDetail WorkspaceSettings::getLevelOfDetail() const noexcept {
+  return GraphicsLevelOfDetail(useLevelOfDetail.get(),
+                               levelOfDetailMinTextHeight.get(),
+                               levelOfDetailMinItemSize.get());
+}
+
 /*******************************************************************************
  *  Private Methods
  ******************************************************************************/
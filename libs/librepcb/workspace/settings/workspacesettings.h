@@ -28,6 +28,7 @@
 
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/graphics/graphicslevelofdetail.h>
 #include <librepcb/common/units/lengthunit.h>
 
 #include <QtCore>
@@ -84,6 +85,13 @@ public:
    */
   void saveToFile() const;
 
+  /**
+   * @brief Get the level of detail settings for graphics views
+   *
+   * @return Level of detail built from the corresponding settings items
+   */
+  GraphicsLevelOfDetail getLevelOfDetail() const noexcept;
+
   // Operator Overloadings
   WorkspaceSettings& operator=(const WorkspaceSettings& rhs) = delete;
 
@@ -149,6 +157,40 @@ public:
    */
   WorkspaceSettingsItem_GenericValue<bool> useOpenGl;
 
+  /**
+   * @brief Render the background grid of the editors into cached image tiles
+   *
+   * @see ::librepcb::GraphicsViewTileCache
+   *
+   * Default: False
+   */
+  WorkspaceSettingsItem_GenericValue<bool> useBackgroundTileCache;
+
+  /**
+   * @brief Simplify the rendering of small items when zoomed out
+   *
+   * @see ::librepcb::GraphicsLevelOfDetail
+   *
+   * Default: True
+   */
+  WorkspaceSettingsItem_GenericValue<bool> useLevelOfDetail;
+
+  /**
+   * @brief Minimum on-screen text height [pixels] to render texts in detail
+   *
+   * Default: 8
+   */
+  WorkspaceSettingsItem_GenericValue<uint> levelOfDetailMinTextHeight;
+
+  /**
+   * @brief Minimum on-screen size [pixels] to render items in detail
+   *
+   * Smaller footprints and symbols are rendered as boxes.
+   *
+   * Default: 4
+   */
+  WorkspaceSettingsItem_GenericValue<uint> levelOfDetailMinItemSize;
+
   /**
    * @brief Preferred library locales (like "de_CH") in the right order
    *
@@ -267,6 +267,16 @@ void WorkspaceSettingsDialog::loadSettings() noexcept {
   // Use OpenGL
   mUi->cbxUseOpenGl->setChecked(mSettings.useOpenGl.get());
 
+  // Background Tile Cache
+  mUi->cbxUseBackgroundTileCache->setChecked(
+      mSettings.useBackgroundTileCache.get());
+
+  // Level of Detail
+  mUi->cbxUseLevelOfDetail->setChecked(mSettings.useLevelOfDetail.get());
+  mUi->spbLodMinTextHeight->setValue(
+      mSettings.levelOfDetailMinTextHeight.get());
+  mUi->spbLodMinItemSize->setValue(mSettings.levelOfDetailMinItemSize.get());
+
   // Library Locale Order
   mLibLocaleOrderModel->setValues(mSettings.libraryLocaleOrder.get());
 
@@ -312,6 +322,16 @@ void WorkspaceSettingsDialog::saveSettings() noexcept {
     // Use OpenGL
     mSettings.useOpenGl.set(mUi->cbxUseOpenGl->isChecked());
 
+    // Background Tile Cache
+    mSettings.useBackgroundTileCache.set(
+        mUi->cbxUseBackgroundTileCache->isChecked());
+
+    // Level of Detail
+    mSettings.useLevelOfDetail.set(mUi->cbxUseLevelOfDetail->isChecked());
+    mSettings.levelOfDetailMinTextHeight.set(
+        mUi->spbLodMinTextHeight->value());
+    mSettings.levelOfDetailMinItemSize.set(mUi->spbLodMinItemSize->value());
+
     // Library Locale Order
     mSettings.libraryLocaleOrder.set(mLibLocaleOrderModel->getValues());
 
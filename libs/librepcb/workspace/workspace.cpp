@@ -24,6 +24,7 @@
 
 #include "favoriteprojectsmodel.h"
 #include "library/workspacelibrarydb.h"
+#include "library/workspacelibraryelementcache.h"
 #include "projecttreemodel.h"
 #include "recentprojectsmodel.h"
 #include "settings/workspacesettings.h"
@@ -118,6 +119,7 @@ Workspace::Workspace(const FilePath& wsPath)
 
   // load library database
   mLibraryDb.reset(new WorkspaceLibraryDb(*this));  // can throw
+  mLibraryElementCache.reset(new WorkspaceLibraryElementCache(*mLibraryDb));
 
   // load project models
   mRecentProjectsModel.reset(new RecentProjectsModel(*this));
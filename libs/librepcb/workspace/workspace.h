@@ -48,6 +48,7 @@ class RecentProjectsModel;
 class FavoriteProjectsModel;
 class WorkspaceSettings;
 class WorkspaceLibraryDb;
+class WorkspaceLibraryElementCache;
 
 /*******************************************************************************
  *  Class Workspace
@@ -134,6 +135,13 @@ public:
    */
   WorkspaceLibraryDb& getLibraryDb() const { return *mLibraryDb; }
 
+  /**
+   * @brief Get the cache of loaded workspace library elements
+   */
+  WorkspaceLibraryElementCache& getLibraryElementCache() const {
+    return *mLibraryElementCache;
+  }
+
   // Project Management
 
   /**
@@ -253,6 +261,9 @@ private:  // Data
   /// the library database
   QScopedPointer<WorkspaceLibraryDb> mLibraryDb;
 
+  /// shared instances of recently used library elements
+  QScopedPointer<WorkspaceLibraryElementCache> mLibraryElementCache;
+
   /// a tree model for the whole projects directory
   QScopedPointer<ProjectTreeModel> mProjectTreeModel;
 
@@ -31,6 +31,7 @@ SOURCES += \
     library/cat/categorytreeitem.cpp \
     library/cat/categorytreemodel.cpp \
     library/workspacelibrarydb.cpp \
+    library/workspacelibraryelementcache.cpp \
     library/workspacelibraryscanner.cpp \
     projecttreemodel.cpp \
     recentprojectsmodel.cpp \
@@ -45,6 +46,7 @@ HEADERS += \
     library/cat/categorytreeitem.h \
     library/cat/categorytreemodel.h \
     library/workspacelibrarydb.h \
+    library/workspacelibraryelementcache.h \
     library/workspacelibraryscanner.h \
     projecttreemodel.h \
     recentprojectsmodel.h \
@@ -0,0 +1,84 @@
+#-------------------------------------------------
+# App: LibrePCB benchmarks
+#-------------------------------------------------
+
+TEMPLATE = app
+TARGET = librepcb-benchmarks
+
+# Use common project definitions
+include(../../common.pri)
+
+QT += core widgets network printsupport xml opengl sql concurrent
+
+CONFIG += console
+CONFIG -= app_bundle
+
+LIBS += \
+    -L$${DESTDIR} \
+    -llibrepcbworkspace \
+    -llibrepcbproject \
+    -llibrepcblibrary \    # Note: The order of the libraries is very important for the linker!
+    -llibrepcbcommon \     # Another order could end up in "undefined reference" errors!
+    -lsexpresso \
+    -lmuparser \
+
+# Solaris based systems need to link against libproc
+solaris:LIBS += -lproc
+
+INCLUDEPATH += \
+    ../../libs \
+    ../../libs/type_safe/include \
+    ../../libs/type_safe/external/debug_assert \
+
+DEPENDPATH += \
+    ../../libs/librepcb/workspace \
+    ../../libs/librepcb/project \
+    ../../libs/librepcb/library \
+    ../../libs/librepcb/common \
+    ../../libs/sexpresso \
+    ../../libs/muparser \
+
+PRE_TARGETDEPS += \
+    $${DESTDIR}/libsexpresso.a \
+    $${DESTDIR}/libmuparser.a \
+
+isEmpty(UNBUNDLE) {
+    # These libraries will only be linked statically when not unbundling
+    PRE_TARGETDEPS += \
+        $${DESTDIR}/liblibrepcbworkspace.a \
+        $${DESTDIR}/liblibrepcbproject.a \
+        $${DESTDIR}/liblibrepcblibrary.a \
+        $${DESTDIR}/liblibrepcbcommon.a \
+        $${DESTDIR}/libquazip.a \
+        $${DESTDIR}/libpolyclipping.a \
+}
+
+SOURCES += \
+    hoverbenchmark.cpp \
+    main.cpp \
+    padlistbenchmark.cpp \
+    planebenchmark.cpp \
+    renderingbenchmark.cpp \
+    uuidbenchmark.cpp \
+
+HEADERS += \
+    hoverbenchmark.h \
+    padlistbenchmark.h \
+    planebenchmark.h \
+    renderingbenchmark.h \
+    uuidbenchmark.h \
+
+FORMS += \
+
+# QuaZIP
+!contains(UNBUNDLE, quazip) {
+    LIBS += -lquazip -lz
+    INCLUDEPATH += ../../libs/quazip
+    DEPENDPATH += ../../libs/quazip
+}
+
+# polyclipping
+!contains(UNBUNDLE, polyclipping) {
+    LIBS += -lpolyclipping
+    DEPENDPATH += ../../libs/polyclipping
+}
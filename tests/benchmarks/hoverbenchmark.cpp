@@ -0,0 +1,238 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "hoverbenchmark.h"
+
+#include <librepcb/common/exceptions.h>
+#include <librepcb/library/cmp/component.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/componentinstance.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/schematics/items/si_netlabel.h>
+#include <librepcb/project/schematics/items/si_netline.h>
+#include <librepcb/project/schematics/items/si_netpoint.h>
+#include <librepcb/project/schematics/items/si_netsegment.h>
+#include <librepcb/project/schematics/items/si_symbol.h>
+#include <librepcb/project/schematics/items/si_symbolpin.h>
+#include <librepcb/project/schematics/schematic.h>
+#include <librepcb/project/settings/projectsettings.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+using namespace project;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+HoverBenchmark::HoverBenchmark(const Options& options) noexcept
+  : mOptions(options) {
+}
+
+HoverBenchmark::~HoverBenchmark() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+HoverBenchmark::Result HoverBenchmark::run(const QString&   name,
+                                           const Schematic& schematic) const
+    noexcept {
+  Result result;
+  result.name        = name;
+  result.symbolCount = schematic.getSymbols().count();
+  result.itemCount   = schematic.getGraphicsScene().items().count();
+
+  QList<Point> positions =
+      getPositions(schematic.getGraphicsScene().itemsBoundingRect());
+  result.queries.append(
+      measure("getItemsAtScenePos()", positions, [&](const Point& pos) {
+        return schematic.getItemsAtScenePos(pos).count();
+      }));
+  result.queries.append(
+      measure("getNetPointsAtScenePos()", positions, [&](const Point& pos) {
+        return schematic.getNetPointsAtScenePos(pos).count();
+      }));
+  result.queries.append(
+      measure("getNetLinesAtScenePos()", positions, [&](const Point& pos) {
+        return schematic.getNetLinesAtScenePos(pos).count();
+      }));
+  result.queries.append(
+      measure("getNetLabelsAtScenePos()", positions, [&](const Point& pos) {
+        return schematic.getNetLabelsAtScenePos(pos).count();
+      }));
+  result.queries.append(
+      measure("getPinsAtScenePos()", positions, [&](const Point& pos) {
+        return schematic.getPinsAtScenePos(pos).count();
+      }));
+  result.queries.append(measure(
+      "Linear scan (reference)", positions,
+      [&](const Point& pos) { return linearScan(schematic, pos); }));
+  return result;
+}
+
+void HoverBenchmark::populate(Schematic& schematic, int symbolCount) {
+  QList<SI_Symbol*> templates = schematic.getSymbols();
+  if (templates.isEmpty()) {
+    throw RuntimeError(__FILE__, __LINE__,
+                       QString("The schematic '%1' does not contain any "
+                               "symbols to copy.")
+                           .arg(*schematic.getName()));
+  }
+
+  // place the copies on a grid below the existing items
+  Circuit&    circuit = schematic.getProject().getCircuit();
+  QRectF      bounds  = schematic.getGraphicsScene().itemsBoundingRect();
+  Point       origin  = Point::fromPx(bounds.bottomLeft());
+  Length      pitch   = Length::fromMm(25.4);
+  int         columns = qCeil(qSqrt(qreal(symbolCount)));
+  QStringList localeOrder =
+      schematic.getProject().getSettings().getLocaleOrder();
+  for (int i = templates.count(); i < symbolCount; ++i) {
+    const SI_Symbol&          tmpl    = *templates.at(i % templates.count());
+    const ComponentInstance&  tmplCmp = tmpl.getComponentInstance();
+    const library::Component& libCmp  = tmplCmp.getLibComponent();
+    QScopedPointer<ComponentInstance> cmp(new ComponentInstance(
+        circuit, libCmp, tmplCmp.getSymbolVariant().getUuid(),
+        CircuitIdentifier(circuit.generateAutoComponentInstanceName(
+            libCmp.getPrefixes().value(localeOrder))),
+        tmplCmp.getDefaultDeviceUuid()));  // can throw
+    circuit.addComponentInstance(*cmp);    // can throw
+    ComponentInstance& cmpRef = *cmp.take();
+
+    int   index = i - templates.count();
+    Point pos   = origin + Point(pitch * (index % columns),
+                               -pitch * (1 + index / columns));
+    QScopedPointer<SI_Symbol> symbol(
+        new SI_Symbol(schematic, cmpRef, tmpl.getCompSymbVarItem().getUuid(),
+                      pos, tmpl.getRotation(), tmpl.getMirrored()));
+    schematic.addSymbol(*symbol);  // can throw
+    symbol.take();
+  }
+}
+
+void HoverBenchmark::printResult(const Result& result,
+                                 QTextStream&  stream) noexcept {
+  stream << QString("%1 (%2 symbols, %3 items)")
+                .arg(result.name)
+                .arg(result.symbolCount)
+                .arg(result.itemCount)
+         << endl;
+  stream << QString("    %1 %2 %3 %4")
+                .arg("Query", -40)
+                .arg("Count", 8)
+                .arg("Hits", 8)
+                .arg("Avg [us]", 10)
+         << endl;
+  foreach (const QueryResult& query, result.queries) {
+    stream << QString("    %1 %2 %3 %4")
+                  .arg(query.name, -40)
+                  .arg(query.queries, 8)
+                  .arg(query.hits, 8)
+                  .arg(query.avgUs, 10, 'f', 2)
+           << endl;
+  }
+  stream << endl;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QList<Point> HoverBenchmark::getPositions(const QRectF& bounds) const
+    noexcept {
+  QList<Point> positions;
+  int          count = qMax(mOptions.gridSize, 1);
+  for (int y = 0; y < count; ++y) {
+    for (int x = 0; x < count; ++x) {
+      positions.append(Point::fromPx(
+          QPointF(bounds.left() + (bounds.width() * (x + 0.5) / count),
+                  bounds.top() + (bounds.height() * (y + 0.5) / count))));
+    }
+  }
+  return positions;
+}
+
+HoverBenchmark::QueryResult HoverBenchmark::measure(
+    const QString& name, const QList<Point>& positions,
+    const std::function<int(const Point&)>& query) const noexcept {
+  QueryResult result;
+  result.name    = name;
+  result.queries = 0;
+  result.hits    = 0;
+
+  QElapsedTimer timer;
+  timer.start();
+  for (int i = 0; i < mOptions.repetitions; ++i) {
+    foreach (const Point& pos, positions) {
+      int hits = query(pos);
+      if (i == 0) {
+        result.hits += hits;
+      }
+      ++result.queries;
+    }
+  }
+  result.avgUs = (result.queries > 0)
+      ? (timer.nsecsElapsed() / qreal(1000) / result.queries)
+      : qreal(0);
+  return result;
+}
+
+int HoverBenchmark::linearScan(const Schematic& schematic,
+                               const Point&     pos) noexcept {
+  // the same checks as Schematic::getItemsAtScenePos(), but without index
+  QPointF scenePosPx = pos.toPxQPointF();
+  int     hits       = 0;
+  foreach (const SI_NetSegment* segment, schematic.getNetSegments()) {
+    foreach (const SI_NetPoint* netpoint, segment->getNetPoints()) {
+      if (netpoint->getGrabAreaScenePx().contains(scenePosPx)) ++hits;
+    }
+    foreach (const SI_NetLine* netline, segment->getNetLines()) {
+      if (netline->getGrabAreaScenePx().contains(scenePosPx)) ++hits;
+    }
+    foreach (const SI_NetLabel* netlabel, segment->getNetLabels()) {
+      if (netlabel->getGrabAreaScenePx().contains(scenePosPx)) ++hits;
+    }
+  }
+  foreach (const SI_Symbol* symbol, schematic.getSymbols()) {
+    foreach (const SI_SymbolPin* pin, symbol->getPins()) {
+      if (pin->getGrabAreaScenePx().contains(scenePosPx)) ++hits;
+    }
+    if (symbol->getGrabAreaScenePx().contains(scenePosPx)) ++hits;
+  }
+  return hits;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
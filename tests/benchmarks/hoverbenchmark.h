@@ -0,0 +1,118 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_HOVERBENCHMARK_H
+#define LIBREPCB_BENCHMARKS_HOVERBENCHMARK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/units/all_length_units.h>
+
+#include <QtCore>
+
+#include <functional>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+namespace project {
+class Schematic;
+}
+
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class HoverBenchmark
+ ******************************************************************************/
+
+/**
+ * @brief The HoverBenchmark class measures how long it takes to find the
+ *        items of a schematic at a specific position
+ *
+ * These queries are executed by the schematic editor on every mouse move
+ * (e.g. to highlight the item below the cursor), so they need to be fast even
+ * for large schematics. The positions are taken from a grid over the whole
+ * schematic. As a reference, the same positions are also checked by a linear
+ * scan over the grab areas of all items.
+ *
+ * To measure large schematics, #populate() adds copies of the existing
+ * symbols to a schematic (only in memory, the project is not saved).
+ */
+class HoverBenchmark final {
+public:
+  // Types
+  struct Options {
+    int gridSize;     ///< Number of positions per row and column
+    int repetitions;  ///< How often each position is queried
+
+    Options() noexcept : gridSize(100), repetitions(3) {}
+  };
+
+  struct QueryResult {
+    QString name;
+    int     queries;  ///< Number of executed queries
+    int     hits;     ///< Number of found items (summed up)
+    qreal   avgUs;    ///< Average time per query
+  };
+
+  struct Result {
+    QString            name;
+    int                symbolCount;
+    int                itemCount;
+    QList<QueryResult> queries;
+  };
+
+  // Constructors / Destructor
+  HoverBenchmark() = delete;
+  HoverBenchmark(const HoverBenchmark& other) = delete;
+  explicit HoverBenchmark(const Options& options) noexcept;
+  ~HoverBenchmark() noexcept;
+
+  // General Methods
+  Result run(const QString& name, const project::Schematic& schematic) const
+      noexcept;
+  static void populate(project::Schematic& schematic, int symbolCount);
+  static void printResult(const Result& result, QTextStream& stream) noexcept;
+
+  // Operator Overloadings
+  HoverBenchmark& operator=(const HoverBenchmark& rhs) = delete;
+
+private:  // Methods
+  QList<Point> getPositions(const QRectF& bounds) const noexcept;
+  QueryResult  measure(const QString& name, const QList<Point>& positions,
+                       const std::function<int(const Point&)>& query) const
+      noexcept;
+  static int linearScan(const project::Schematic& schematic,
+                        const Point&              pos) noexcept;
+
+private:  // Data
+  Options mOptions;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif  // LIBREPCB_BENCHMARKS_HOVERBENCHMARK_H
@@ -0,0 +1,259 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "hoverbenchmark.h"
+#include "padlistbenchmark.h"
+#include "planebenchmark.h"
+#include "renderingbenchmark.h"
+#include "uuidbenchmark.h"
+
+#include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/transactionaldirectory.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/schematics/schematic.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+using namespace librepcb;
+using namespace librepcb::benchmarks;
+using namespace librepcb::project;
+
+/*******************************************************************************
+ *  The Benchmark Program
+ ******************************************************************************/
+
+int main(int argc, char* argv[]) {
+  // many classes rely on a QApplication instance, so we create it here
+  // (use "-platform offscreen" or QT_QPA_PLATFORM=offscreen to run headless)
+  Application app(argc, argv);
+  Application::setOrganizationName("LibrePCB");
+  Application::setOrganizationDomain("librepcb.org");
+  Application::setApplicationName("LibrePCB-Benchmarks");
+
+  // disable the whole debug output (we want only the benchmark results)
+  Debug::instance()->setDebugLevelLogFile(Debug::DebugLevel_t::Nothing);
+  Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Nothing);
+
+  QTextStream out(stdout);
+  QTextStream err(stderr);
+
+  // parse command line arguments
+  RenderingBenchmark::Options options;
+  HoverBenchmark::Options     hoverOptions;
+  PadListBenchmark::Options   padListOptions;
+  QCommandLineParser          parser;
+  parser.setApplicationDescription(
+      "Measures the rendering performance of schematics and boards and the "
+      "performance of item queries in schematics, of UUIDs, of pad lookups "
+      "in large footprints and of plane fragments.");
+  parser.addHelpOption();
+  QCommandLineOption benchmarksOption(
+      "benchmarks", "Comma separated benchmarks to run: rendering, hover, "
+                    "uuid, padlist, planes (default: rendering,hover).",
+      "names");
+  QCommandLineOption sizeOption(
+      "size", "Size of the rendered images in pixels (default: 1920x1080).",
+      "WxH");
+  QCommandLineOption zoomOption(
+      "zoom", "Comma separated zoom levels, relative to 'zoom all' (default: "
+              "1,4,16).",
+      "levels");
+  QCommandLineOption repeatOption(
+      "repeat",
+      "How often each frame is rendered and each query is executed "
+      "(default: 3).",
+      "count");
+  QCommandLineOption noAntialiasingOption("no-antialiasing",
+                                          "Render without antialiasing.");
+  QCommandLineOption noLodOption(
+      "no-lod", "Render all items with full details, even if zoomed out.");
+  QCommandLineOption symbolsOption(
+      "symbols", "Fill each schematic with copies of its symbols up to the "
+                 "given count before running the hover benchmark.",
+      "count");
+  QCommandLineOption gridOption(
+      "grid", "Number of positions per row and column queried by the hover "
+              "benchmark (default: 100).",
+      "count");
+  QCommandLineOption padsOption(
+      "pads", "Number of pads of the footprint generated by the padlist "
+              "benchmark (default: 1000).",
+      "count");
+  parser.addOption(benchmarksOption);
+  parser.addOption(sizeOption);
+  parser.addOption(zoomOption);
+  parser.addOption(repeatOption);
+  parser.addOption(noAntialiasingOption);
+  parser.addOption(noLodOption);
+  parser.addOption(symbolsOption);
+  parser.addOption(gridOption);
+  parser.addOption(padsOption);
+  parser.addPositionalArgument(
+      "project", "Path to the project (*.lpp), not needed for padlist.");
+  parser.process(app);
+  if (parser.isSet(sizeOption)) {
+    QStringList size = parser.value(sizeOption).split('x');
+    if (size.count() == 2) {
+      options.imageSize = QSize(size.first().toInt(), size.last().toInt());
+    }
+    if (options.imageSize.isEmpty()) {
+      err << "Invalid image size: " << parser.value(sizeOption) << endl;
+      return 1;
+    }
+  }
+  if (parser.isSet(zoomOption)) {
+    options.zoomLevels.clear();
+    foreach (const QString& level, parser.value(zoomOption).split(',')) {
+      bool  ok    = false;
+      qreal value = level.toDouble(&ok);
+      if ((!ok) || (value <= 0)) {
+        err << "Invalid zoom level: " << level << endl;
+        return 1;
+      }
+      options.zoomLevels.append(value);
+    }
+  }
+  if (parser.isSet(repeatOption)) {
+    options.repetitions = qMax(parser.value(repeatOption).toInt(), 1);
+  }
+  options.antialiasing  = !parser.isSet(noAntialiasingOption);
+  options.levelOfDetail = !parser.isSet(noLodOption);
+  QStringList benchmarks = {"rendering", "hover"};
+  if (parser.isSet(benchmarksOption)) {
+    benchmarks = parser.value(benchmarksOption).split(',');
+    foreach (const QString& name, benchmarks) {
+      if ((name != "rendering") && (name != "hover") && (name != "uuid") &&
+          (name != "padlist") && (name != "planes")) {
+        err << "Invalid benchmark: " << name << endl;
+        return 1;
+      }
+    }
+  }
+  bool projectRequired = (benchmarks != QStringList{"padlist"});
+  if (parser.positionalArguments().count() != (projectRequired ? 1 : 0)) {
+    parser.showHelp(1);
+  }
+  int symbolCount = 0;
+  if (parser.isSet(symbolsOption)) {
+    bool ok     = false;
+    symbolCount = parser.value(symbolsOption).toInt(&ok);
+    if ((!ok) || (symbolCount < 1)) {
+      err << "Invalid symbol count: " << parser.value(symbolsOption) << endl;
+      return 1;
+    }
+  }
+  if (parser.isSet(gridOption)) {
+    bool ok               = false;
+    hoverOptions.gridSize = parser.value(gridOption).toInt(&ok);
+    if ((!ok) || (hoverOptions.gridSize < 1)) {
+      err << "Invalid grid size: " << parser.value(gridOption) << endl;
+      return 1;
+    }
+  }
+  if (parser.isSet(padsOption)) {
+    bool ok                 = false;
+    padListOptions.padCount = parser.value(padsOption).toInt(&ok);
+    if ((!ok) || (padListOptions.padCount < 1)) {
+      err << "Invalid pad count: " << parser.value(padsOption) << endl;
+      return 1;
+    }
+  }
+  hoverOptions.repetitions   = options.repetitions;
+  padListOptions.repetitions = options.repetitions;
+
+  try {
+    // run benchmarks which don't need a project
+    if (benchmarks.contains("padlist")) {
+      PadListBenchmark benchmark(padListOptions);
+      PadListBenchmark::printResult(benchmark.run(), out);  // can throw
+    }
+    if (!projectRequired) {
+      return 0;
+    }
+
+    // open project read-only
+    FilePath projectFp(
+        QFileInfo(parser.positionalArguments().first()).absoluteFilePath());
+    out << "Open project '" << projectFp.toNative() << "'..." << endl;
+    QElapsedTimer timer;
+    timer.start();
+    std::shared_ptr<TransactionalFileSystem> projectFs =
+        TransactionalFileSystem::openRO(projectFp.getParentDir());
+    Project project(std::unique_ptr<TransactionalDirectory>(
+                        new TransactionalDirectory(projectFs)),
+                    projectFp.getFilename());  // can throw
+    out << QString("Project loaded in %1 ms.").arg(timer.elapsed()) << endl
+        << endl;
+
+    // run benchmarks
+    if (benchmarks.contains("rendering")) {
+      RenderingBenchmark benchmark(options);
+      foreach (const Schematic* schematic, project.getSchematics()) {
+        RenderingBenchmark::printResult(
+            benchmark.run("Schematic '" % *schematic->getName() % "'",
+                          schematic->getGraphicsScene()),
+            out);
+      }
+      foreach (const Board* board, project.getBoards()) {
+        RenderingBenchmark::printResult(
+            benchmark.run("Board '" % *board->getName() % "'",
+                          board->getGraphicsScene()),
+            out);
+      }
+    }
+    if (benchmarks.contains("hover")) {
+      HoverBenchmark benchmark(hoverOptions);
+      foreach (Schematic* schematic, project.getSchematics()) {
+        if (symbolCount > 0) {
+          HoverBenchmark::populate(*schematic, symbolCount);  // can throw
+        }
+        HoverBenchmark::printResult(
+            benchmark.run("Schematic '" % *schematic->getName() % "'",
+                          *schematic),
+            out);
+      }
+    }
+    if (benchmarks.contains("uuid")) {
+      UuidBenchmark benchmark(options.repetitions * 1000);
+      UuidBenchmark::printResult(benchmark.run("Project UUIDs", project), out);
+    }
+    if (benchmarks.contains("planes")) {
+      PlaneBenchmark benchmark(options.repetitions);
+      foreach (Board* board, project.getBoards()) {
+        PlaneBenchmark::printResult(
+            benchmark.run("Board '" % *board->getName() % "'", *board), out);
+      }
+    }
+    return 0;
+  } catch (const Exception& e) {
+    err << "ERROR: " << e.getMsg() << endl;
+    return 1;
+  }
+}
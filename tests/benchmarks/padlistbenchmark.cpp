@@ -0,0 +1,175 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "padlistbenchmark.h"
+
+#include <librepcb/common/fileio/sexpression.h>
+#include <librepcb/library/pkg/footprint.h>
+#include <librepcb/library/pkg/packagepad.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+using namespace library;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+PadListBenchmark::PadListBenchmark(const Options& options) noexcept
+  : mOptions(options) {
+}
+
+PadListBenchmark::~PadListBenchmark() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+PadListBenchmark::Result PadListBenchmark::run() const {
+  Result result;
+  result.padCount = mOptions.padCount;
+
+  // create the package pads and the footprint pads on a grid
+  PackagePadList   packagePads;
+  FootprintPadList footprintPads;
+  int              columns = qCeil(qSqrt(qreal(mOptions.padCount)));
+  for (int i = 0; i < mOptions.padCount; ++i) {
+    Uuid uuid = Uuid::createRandom();
+    packagePads.append(std::make_shared<PackagePad>(
+        uuid, CircuitIdentifier(QString::number(i + 1))));
+    footprintPads.append(std::make_shared<FootprintPad>(
+        uuid, Point(Length::fromMm(i % columns), Length::fromMm(i / columns)),
+        Angle::deg0(), FootprintPad::Shape::ROUND, PositiveLength(1000000),
+        PositiveLength(1000000), UnsignedLength(500000),
+        FootprintPad::BoardSide::THT));
+  }
+  std::vector<Uuid> uuids = packagePads.getUuids();
+  QStringList       names;
+  for (const PackagePad& pad : packagePads) {
+    names.append(*pad.getName());
+  }
+  SExpression node = SExpression::createList("footprint");
+  footprintPads.serialize(node);  // can throw
+
+  // measure the operations
+  result.operations.append(measure("Load from S-Expression", 1, [&](int) {
+    FootprintPadList list(node);  // can throw
+    return list.count() == mOptions.padCount;
+  }));
+  result.operations.append(
+      measure("FootprintPadList::find(Uuid)", mOptions.padCount,
+              [&](int i) { return bool(footprintPads.find(uuids.at(i))); }));
+  result.operations.append(measure(
+      "FootprintPadList::indexOf(FootprintPad*)", mOptions.padCount,
+      [&](int i) {
+        return footprintPads.indexOf(footprintPads.at(i).get()) == i;
+      }));
+  result.operations.append(
+      measure("PackagePadList::find(QString)", mOptions.padCount,
+              [&](int i) { return bool(packagePads.find(names.at(i))); }));
+  result.operations.append(measure(
+      "FootprintPad::setPosition() + find(Uuid)", mOptions.padCount,
+      [&](int i) {
+        std::shared_ptr<FootprintPad> pad = footprintPads.find(uuids.at(i));
+        pad->setPosition(pad->getPosition() + Point(Length(1), Length(1)));
+        return bool(footprintPads.find(uuids.at(i)));
+      }));
+  result.operations.append(measure(
+      "Linear scan by UUID (reference)", mOptions.padCount, [&](int i) {
+        for (const FootprintPad& pad : footprintPads) {
+          if (pad.getUuid() == uuids.at(i)) {
+            return true;
+          }
+        }
+        return false;
+      }));
+  result.operations.append(measure(
+      "Linear scan by name (reference)", mOptions.padCount, [&](int i) {
+        for (const PackagePad& pad : packagePads) {
+          if (pad.getName() == names.at(i)) {
+            return true;
+          }
+        }
+        return false;
+      }));
+  return result;
+}
+
+void PadListBenchmark::printResult(const Result& result,
+                                   QTextStream&  stream) noexcept {
+  stream << QString("Footprint with %1 pads").arg(result.padCount) << endl;
+  stream << QString("    %1 %2 %3 %4")
+                .arg("Operation", -44)
+                .arg("Count", 8)
+                .arg("Hits", 8)
+                .arg("Avg [us]", 10)
+         << endl;
+  foreach (const OperationResult& operation, result.operations) {
+    stream << QString("    %1 %2 %3 %4")
+                  .arg(operation.name, -44)
+                  .arg(operation.operations, 8)
+                  .arg(operation.hits, 8)
+                  .arg(operation.avgUs, 10, 'f', 2)
+           << endl;
+  }
+  stream << endl;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+PadListBenchmark::OperationResult PadListBenchmark::measure(
+    const QString& name, int count,
+    const std::function<bool(int)>& operation) const {
+  OperationResult result;
+  result.name       = name;
+  result.operations = 0;
+  result.hits       = 0;
+
+  QElapsedTimer timer;
+  timer.start();
+  for (int i = 0; i < mOptions.repetitions; ++i) {
+    for (int k = 0; k < count; ++k) {
+      if (operation(k)) {  // can throw
+        ++result.hits;
+      }
+      ++result.operations;
+    }
+  }
+  result.avgUs = timer.nsecsElapsed() / (1000.0 * qMax(result.operations, 1));
+  return result;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
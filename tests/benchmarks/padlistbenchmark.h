@@ -0,0 +1,101 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_PADLISTBENCHMARK_H
+#define LIBREPCB_BENCHMARKS_PADLISTBENCHMARK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+#include <functional>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class PadListBenchmark
+ ******************************************************************************/
+
+/**
+ * @brief The PadListBenchmark class measures element lookups in
+ *        ::librepcb::SerializableObjectList with a large footprint
+ *
+ * Library elements, checks and undo commands look up pads and signals by UUID
+ * or name, often once per pad, so every lookup has to be fast even for
+ * packages with many pads. This benchmark creates a package with a footprint
+ * of #Options::padCount pads (only in memory) and measures deserialization
+ * and the different lookups of the lists. As a reference, the same lookups
+ * are also done by a linear scan over the lists.
+ */
+class PadListBenchmark final {
+public:
+  // Types
+  struct Options {
+    int padCount;     ///< Number of pads of the generated footprint
+    int repetitions;  ///< How often each operation is executed
+
+    Options() noexcept : padCount(1000), repetitions(3) {}
+  };
+
+  struct OperationResult {
+    QString name;
+    int     operations;  ///< Number of executed operations
+    int     hits;        ///< Number of successful operations (found pads)
+    qreal   avgUs;       ///< Average time per operation
+  };
+
+  struct Result {
+    int                    padCount;
+    QList<OperationResult> operations;
+  };
+
+  // Constructors / Destructor
+  PadListBenchmark() = delete;
+  PadListBenchmark(const PadListBenchmark& other) = delete;
+  explicit PadListBenchmark(const Options& options) noexcept;
+  ~PadListBenchmark() noexcept;
+
+  // General Methods
+  Result      run() const;
+  static void printResult(const Result& result, QTextStream& stream) noexcept;
+
+  // Operator Overloadings
+  PadListBenchmark& operator=(const PadListBenchmark& rhs) = delete;
+
+private:  // Methods
+  OperationResult measure(const QString& name, int count,
+                          const std::function<bool(int)>& operation) const;
+
+private:  // Data
+  Options mOptions;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif  // LIBREPCB_BENCHMARKS_PADLISTBENCHMARK_H
@@ -0,0 +1,135 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "planebenchmark.h"
+
+#include <librepcb/common/geometry/path.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+using namespace project;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+PlaneBenchmark::PlaneBenchmark(int repetitions) noexcept
+  : mRepetitions(qMax(repetitions, 1)) {
+}
+
+PlaneBenchmark::~PlaneBenchmark() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+PlaneBenchmark::Result PlaneBenchmark::run(const QString& name,
+                                           Board&         board) const
+    noexcept {
+  Result result;
+  result.name           = name;
+  result.planeCount     = board.getPlanes().count();
+  result.fragmentCount  = 0;
+  result.vertexCount    = 0;
+  result.bytesPerVertex = sizeof(Vertex);
+
+  QElapsedTimer timer;
+  timer.start();
+  for (int i = 0; i < mRepetitions; ++i) {
+    board.rebuildAllPlanes();
+  }
+  result.operations.append(
+      {"Board::rebuildAllPlanes()", timer.nsecsElapsed() / 1e6 / mRepetitions});
+
+  QVector<Path> fragments;
+  foreach (const BI_Plane* plane, board.getPlanes()) {
+    fragments += plane->getFragments();
+  }
+  result.fragmentCount = fragments.count();
+  foreach (const Path& path, fragments) {
+    result.vertexCount += path.getVertices().count();
+  }
+  result.vertexBytes = qint64(result.vertexCount) * sizeof(Vertex);
+
+  timer.restart();
+  for (int i = 0; i < mRepetitions; ++i) {
+    foreach (const Path& path, fragments) {
+      QVector<Vertex> copy = path.getVertices();
+      copy.detach();  // force a deep copy
+    }
+  }
+  result.operations.append(
+      {"Deep copy of fragments", timer.nsecsElapsed() / 1e6 / mRepetitions});
+
+  timer.restart();
+  qint64 sum = 0;  // avoid that the compiler optimizes away the loop
+  for (int i = 0; i < mRepetitions; ++i) {
+    foreach (const Path& path, fragments) {
+      for (const Vertex& vertex : path.getVertices()) {
+        sum += vertex.getPos().getX().toNm() + vertex.getPos().getY().toNm();
+      }
+    }
+  }
+  result.operations.append(
+      {"Iterate over all vertices", timer.nsecsElapsed() / 1e6 / mRepetitions});
+  Q_UNUSED(sum);
+  return result;
+}
+
+void PlaneBenchmark::printResult(const Result& result,
+                                 QTextStream&  stream) noexcept {
+  stream << QString("%1 (%2 planes, %3 fragments, %4 vertices)")
+                .arg(result.name)
+                .arg(result.planeCount)
+                .arg(result.fragmentCount)
+                .arg(result.vertexCount)
+         << endl;
+  stream << QString("    Memory of vertices: %1 kB (%2 bytes per vertex)")
+                .arg(result.vertexBytes / 1024)
+                .arg(result.bytesPerVertex)
+         << endl;
+  stream << QString("    %1 %2").arg("Operation", -40).arg("Avg [ms]", 10)
+         << endl;
+  foreach (const OperationResult& operation, result.operations) {
+    stream << QString("    %1 %2")
+                  .arg(operation.name, -40)
+                  .arg(operation.avgMs, 10, 'f', 2)
+           << endl;
+  }
+  stream << endl;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
@@ -0,0 +1,97 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_PLANEBENCHMARK_H
+#define LIBREPCB_BENCHMARKS_PLANEBENCHMARK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+namespace project {
+class Board;
+}
+
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class PlaneBenchmark
+ ******************************************************************************/
+
+/**
+ * @brief The PlaneBenchmark class measures the memory usage and processing
+ *        time of the plane fragments of a board
+ *
+ * Plane fragments are often the largest paths of a board (thousands of
+ * vertices per fragment), so they show how compact ::librepcb::Path,
+ * ::librepcb::Vertex and ::librepcb::Point are stored. This benchmark
+ * rebuilds all planes of a board, reports the memory used by the vertices of
+ * all fragments and measures how long it takes to deep-copy and to iterate
+ * over all fragments. Compare the results of two builds to see the effect of
+ * changes to these classes.
+ */
+class PlaneBenchmark final {
+public:
+  // Types
+  struct OperationResult {
+    QString name;
+    qreal   avgMs;  ///< Average time per operation
+  };
+
+  struct Result {
+    QString                name;
+    int                    planeCount;
+    int                    fragmentCount;
+    int                    vertexCount;
+    int                    bytesPerVertex;  ///< sizeof(Vertex)
+    qint64                 vertexBytes;     ///< Memory used by all vertices
+    QList<OperationResult> operations;
+  };
+
+  // Constructors / Destructor
+  PlaneBenchmark() = delete;
+  PlaneBenchmark(const PlaneBenchmark& other) = delete;
+  explicit PlaneBenchmark(int repetitions) noexcept;
+  ~PlaneBenchmark() noexcept;
+
+  // General Methods
+  Result      run(const QString& name, project::Board& board) const noexcept;
+  static void printResult(const Result& result, QTextStream& stream) noexcept;
+
+  // Operator Overloadings
+  PlaneBenchmark& operator=(const PlaneBenchmark& rhs) = delete;
+
+private:  // Data
+  int mRepetitions;  ///< How often each operation is executed
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif  // LIBREPCB_BENCHMARKS_PLANEBENCHMARK_H
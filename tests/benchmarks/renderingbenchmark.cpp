@@ -0,0 +1,283 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "renderingbenchmark.h"
+
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/common/graphics/graphicsview.h>
+#include <librepcb/common/units/length.h>
+
+#include <QtCore>
+#include <QtWidgets>
+
+#include <algorithm>
+#include <numeric>
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+RenderingBenchmark::RenderingBenchmark(const Options& options) noexcept
+  : mOptions(options) {
+}
+
+RenderingBenchmark::~RenderingBenchmark() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+RenderingBenchmark::Result RenderingBenchmark::run(const QString& name,
+                                                   GraphicsScene& scene) const
+    noexcept {
+  Result result;
+  result.name      = name;
+  result.itemCount = scene.items().count();
+
+  QRectF bounds = scene.itemsBoundingRect();
+  if (bounds.isEmpty()) {
+    return result;
+  }
+
+  // render through a view like the editors do, since the graphics items
+  // decide about their level of detail by the widget they are painted on
+  GraphicsLevelOfDetail lod;
+  lod.setEnabled(mOptions.levelOfDetail);
+  GraphicsView view;
+  view.setAttribute(Qt::WA_DontShowOnScreen);
+  view.setFrameShape(QFrame::NoFrame);
+  view.setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+  view.setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+  view.setRenderHint(QPainter::Antialiasing, mOptions.antialiasing);
+  view.setLevelOfDetail(lod);
+  view.setScene(&scene);
+  view.resize(mOptions.imageSize);
+  view.show();
+
+  foreach (qreal zoomLevel, mOptions.zoomLevels) {
+    foreach (const QRectF& rect, getSceneRects(bounds, zoomLevel)) {
+      result.frames.append(renderFrame(view, zoomLevel, rect));
+    }
+  }
+  result.itemTypes = measureItemTypes(view, bounds);
+  view.setScene(nullptr);
+  return result;
+}
+
+void RenderingBenchmark::printResult(const Result& result,
+                                     QTextStream&  stream) noexcept {
+  stream << QString("%1 (%2 items)").arg(result.name).arg(result.itemCount)
+         << endl;
+
+  stream << "  Frames:" << endl;
+  stream << QString("    %1 %2 %3 %4 %5")
+                .arg("Zoom", 6)
+                .arg("Position [mm]", -24)
+                .arg("Min [ms]", 10)
+                .arg("Avg [ms]", 10)
+                .arg("Max [ms]", 10)
+         << endl;
+  qreal totalAvgMs = 0;
+  foreach (const FrameResult& frame, result.frames) {
+    QPointF center = frame.sceneRect.center();
+    QString pos    = QString("%1 / %2")
+                      .arg(Length::fromPx(center.x()).toMm(), 0, 'f', 1)
+                      .arg(-Length::fromPx(center.y()).toMm(), 0, 'f', 1);
+    stream << QString("    %1 %2 %3 %4 %5")
+                  .arg(frame.zoomLevel, 6, 'f', 1)
+                  .arg(pos, -24)
+                  .arg(frame.minMs, 10, 'f', 2)
+                  .arg(frame.avgMs, 10, 'f', 2)
+                  .arg(frame.maxMs, 10, 'f', 2)
+           << endl;
+    totalAvgMs += frame.avgMs;
+  }
+  if (!result.frames.isEmpty()) {
+    stream << QString("    Average frame time: %1 ms")
+                  .arg(totalAvgMs / result.frames.count(), 0, 'f', 2)
+           << endl;
+  }
+
+  stream << "  Paint costs per item type:" << endl;
+  stream << QString("    %1 %2 %3 %4")
+                .arg("Type", -40)
+                .arg("Count", 8)
+                .arg("Total [ms]", 12)
+                .arg("Per item [us]", 14)
+         << endl;
+  foreach (const ItemTypeResult& type, result.itemTypes) {
+    stream << QString("    %1 %2 %3 %4")
+                  .arg(type.typeName, -40)
+                  .arg(type.count, 8)
+                  .arg(type.totalMs, 12, 'f', 3)
+                  .arg(1000 * type.totalMs / qMax(type.count, 1), 14, 'f', 2)
+           << endl;
+  }
+  stream << endl;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QList<QRectF> RenderingBenchmark::getSceneRects(const QRectF& bounds,
+                                                qreal zoomLevel) const
+    noexcept {
+  // size of the visible scene area at the given zoom level
+  QTransform transform = getTransform(bounds);
+  QSizeF     size(mOptions.imageSize.width() / (transform.m11() * zoomLevel),
+              mOptions.imageSize.height() / (transform.m22() * zoomLevel));
+
+  // scroll over the whole scene with max. 3x3 positions
+  int           steps = qBound(1, qCeil(zoomLevel), 3);
+  QList<QRectF> rects;
+  for (int x = 0; x < steps; ++x) {
+    for (int y = 0; y < steps; ++y) {
+      qreal fx = (steps > 1) ? (qreal(x) / (steps - 1)) : 0.5;
+      qreal fy = (steps > 1) ? (qreal(y) / (steps - 1)) : 0.5;
+      QRectF rect(QPointF(0, 0), size);
+      rect.moveCenter(
+          QPointF(bounds.left() + size.width() / 2 +
+                      fx * qMax(bounds.width() - size.width(), qreal(0)),
+                  bounds.top() + size.height() / 2 +
+                      fy * qMax(bounds.height() - size.height(), qreal(0))));
+      rects.append(rect);
+    }
+  }
+  return rects;
+}
+
+RenderingBenchmark::FrameResult RenderingBenchmark::renderFrame(
+    GraphicsView& view, qreal zoomLevel, const QRectF& sceneRect) const
+    noexcept {
+  FrameResult result;
+  result.zoomLevel = zoomLevel;
+  result.sceneRect = sceneRect;
+  result.minMs     = 0;
+  result.avgMs     = 0;
+  result.maxMs     = 0;
+
+  // QGraphicsView::render() would paint the items without widget (i.e. with
+  // full details), so the viewport itself needs to be rendered
+  view.setVisibleSceneRect(sceneRect);
+  QImage image(mOptions.imageSize, QImage::Format_ARGB32_Premultiplied);
+  QList<qreal> times;
+  for (int i = 0; i < qMax(mOptions.repetitions, 1); ++i) {
+    image.fill(Qt::black);
+    QElapsedTimer timer;
+    timer.start();
+    view.viewport()->render(&image);
+    times.append(timer.nsecsElapsed() / qreal(1000000));
+  }
+  result.minMs = *std::min_element(times.begin(), times.end());
+  result.maxMs = *std::max_element(times.begin(), times.end());
+  result.avgMs =
+      std::accumulate(times.begin(), times.end(), qreal(0)) / times.count();
+  return result;
+}
+
+QList<RenderingBenchmark::ItemTypeResult> RenderingBenchmark::measureItemTypes(
+    GraphicsView& view, const QRectF& bounds) const noexcept {
+  view.setVisibleSceneRect(bounds);
+  QHash<QString, ItemTypeResult> types;
+  QTransform                     transform = view.viewportTransform();
+  QImage   image(mOptions.imageSize, QImage::Format_ARGB32_Premultiplied);
+  QPainter painter(&image);
+  painter.setRenderHint(QPainter::Antialiasing, mOptions.antialiasing);
+  foreach (QGraphicsItem* item, view.scene()->items()) {
+    if ((!item->isVisible()) ||
+        (item->flags().testFlag(QGraphicsItem::ItemHasNoContents))) {
+      continue;
+    }
+    QStyleOptionGraphicsItem option;
+    option.exposedRect = item->boundingRect();
+    option.rect        = option.exposedRect.toAlignedRect();
+    qint64 ns          = 0;
+    for (int i = 0; i < qMax(mOptions.repetitions, 1); ++i) {
+      painter.save();
+      painter.setTransform(item->sceneTransform() * transform);
+      QElapsedTimer timer;
+      timer.start();
+      item->paint(&painter, &option, view.viewport());
+      ns += timer.nsecsElapsed();
+      painter.restore();
+    }
+    QString         typeName = getTypeName(*item);
+    ItemTypeResult& type     = types[typeName];
+    type.typeName            = typeName;
+    type.count += 1;
+    type.totalMs += ns / (qreal(1000000) * qMax(mOptions.repetitions, 1));
+  }
+
+  QList<ItemTypeResult> result = types.values();
+  std::sort(result.begin(), result.end(),
+            [](const ItemTypeResult& a, const ItemTypeResult& b) {
+              return a.totalMs > b.totalMs;
+            });
+  return result;
+}
+
+QTransform RenderingBenchmark::getTransform(const QRectF& sceneRect) const
+    noexcept {
+  // same as GraphicsView::setVisibleSceneRect() (without scrollbars)
+  qreal scale = qMin(mOptions.imageSize.width() / sceneRect.width(),
+                     mOptions.imageSize.height() / sceneRect.height());
+  QTransform transform;
+  transform.translate(mOptions.imageSize.width() / qreal(2),
+                      mOptions.imageSize.height() / qreal(2));
+  transform.scale(scale, scale);
+  transform.translate(-sceneRect.center().x(), -sceneRect.center().y());
+  return transform;
+}
+
+QString RenderingBenchmark::getTypeName(const QGraphicsItem& item) noexcept {
+  QString name = typeid(item).name();
+#if defined(__GNUG__)
+  int   status    = 0;
+  char* demangled = abi::__cxa_demangle(typeid(item).name(), nullptr, nullptr,
+                                        &status);
+  if (demangled && (status == 0)) {
+    name = demangled;
+  }
+  std::free(demangled);
+#endif
+  return name.remove("librepcb::").remove("project::").remove("class ");
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
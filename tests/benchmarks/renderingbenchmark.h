@@ -0,0 +1,132 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_RENDERINGBENCHMARK_H
+#define LIBREPCB_BENCHMARKS_RENDERINGBENCHMARK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+class GraphicsScene;
+class GraphicsView;
+
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class RenderingBenchmark
+ ******************************************************************************/
+
+/**
+ * @brief The RenderingBenchmark class measures how long it takes to paint a
+ *        ::librepcb::GraphicsScene
+ *
+ * The scene is rendered through a ::librepcb::GraphicsView (like in the
+ * editors, i.e. including the background, the grid and the level of detail
+ * optimizations) into an offscreen QImage at several zoom levels and scroll
+ * positions:
+ *
+ *  - Zoom level 1 shows the whole scene (like "zoom all" in the editors).
+ *  - Zoom level N shows 1/N of the scene width and height. The visible area
+ *    is moved over a grid of scroll positions to cover the whole scene.
+ *
+ * In addition, each item is painted individually to determine the paint
+ * costs per item type (e.g. footprints, traces, texts).
+ */
+class RenderingBenchmark final {
+public:
+  // Types
+  struct Options {
+    QSize        imageSize;      ///< Size of the rendered images in pixels
+    QList<qreal> zoomLevels;     ///< Zoom levels, relative to "zoom all"
+    int          repetitions;    ///< How often each frame is rendered
+    bool         antialiasing;   ///< Antialiased rendering
+    bool         levelOfDetail;  ///< Skip details when zoomed out
+
+    Options() noexcept
+      : imageSize(1920, 1080),
+        zoomLevels({1, 4, 16}),
+        repetitions(3),
+        antialiasing(true),
+        levelOfDetail(true) {}
+  };
+
+  struct FrameResult {
+    qreal  zoomLevel;
+    QRectF sceneRect;  ///< The rendered scene rect
+    qreal  minMs;      ///< Fastest repetition
+    qreal  avgMs;      ///< Average of all repetitions
+    qreal  maxMs;      ///< Slowest repetition
+  };
+
+  struct ItemTypeResult {
+    QString typeName;
+    int     count   = 0;
+    qreal   totalMs = 0;  ///< Paint time of all items of this type
+  };
+
+  struct Result {
+    QString               name;
+    int                   itemCount;
+    QList<FrameResult>    frames;
+    QList<ItemTypeResult> itemTypes;  ///< Sorted by descending total time
+  };
+
+  // Constructors / Destructor
+  RenderingBenchmark() = delete;
+  RenderingBenchmark(const RenderingBenchmark& other) = delete;
+  explicit RenderingBenchmark(const Options& options) noexcept;
+  ~RenderingBenchmark() noexcept;
+
+  // General Methods
+  Result run(const QString& name, GraphicsScene& scene) const noexcept;
+  static void printResult(const Result& result, QTextStream& stream) noexcept;
+
+  // Operator Overloadings
+  RenderingBenchmark& operator=(const RenderingBenchmark& rhs) = delete;
+
+private:  // Methods
+  QList<QRectF> getSceneRects(const QRectF& bounds, qreal zoomLevel) const
+      noexcept;
+  FrameResult renderFrame(GraphicsView& view, qreal zoomLevel,
+                          const QRectF& sceneRect) const noexcept;
+  QList<ItemTypeResult> measureItemTypes(GraphicsView& view,
+                                         const QRectF& bounds) const noexcept;
+  QTransform getTransform(const QRectF& sceneRect) const noexcept;
+  static QString getTypeName(const QGraphicsItem& item) noexcept;
+
+private:  // Data
+  Options mOptions;
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif  // LIBREPCB_BENCHMARKS_RENDERINGBENCHMARK_H
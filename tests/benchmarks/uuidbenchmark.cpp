@@ -0,0 +1,151 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "uuidbenchmark.h"
+
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/library/projectlibrary.h>
+#include <librepcb/project/project.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace benchmarks {
+
+using namespace project;
+
+/*******************************************************************************
+ *  Constructors / Destructor
+ ******************************************************************************/
+
+UuidBenchmark::UuidBenchmark(int repetitions) noexcept
+  : mRepetitions(qMax(repetitions, 1)) {
+}
+
+UuidBenchmark::~UuidBenchmark() noexcept {
+}
+
+/*******************************************************************************
+ *  General Methods
+ ******************************************************************************/
+
+UuidBenchmark::Result UuidBenchmark::run(const QString& name,
+                                         const Project& project) const
+    noexcept {
+  Result result;
+  result.name         = name;
+  result.bytesPerUuid = sizeof(Uuid);
+
+  QList<Uuid> uuids = getUuids(project);
+  result.uuidCount  = uuids.count();
+  if (uuids.isEmpty()) {
+    return result;
+  }
+  QStringList      strings;
+  QHash<Uuid, int> hash;
+  QMap<Uuid, int>  map;
+  foreach (const Uuid& uuid, uuids) {
+    strings.append(uuid.toStr());
+    hash.insert(uuid, hash.count());
+    map.insert(uuid, map.count());
+  }
+  qint64 operations = qint64(uuids.count()) * mRepetitions;
+  int    dummy      = 0;  // avoid that the compiler optimizes away the loops
+
+  QElapsedTimer timer;
+  timer.start();
+  for (int i = 0; i < mRepetitions; ++i) {
+    foreach (const QString& str, strings) {
+      dummy += Uuid::fromString(str) == uuids.first();
+    }
+  }
+  result.operations.append(
+      {"Uuid::fromString()", timer.nsecsElapsed() / qreal(operations)});
+
+  timer.restart();
+  for (int i = 0; i < mRepetitions; ++i) {
+    foreach (const Uuid& uuid, uuids) { dummy += uuid.toStr().length(); }
+  }
+  result.operations.append(
+      {"Uuid::toStr()", timer.nsecsElapsed() / qreal(operations)});
+
+  timer.restart();
+  for (int i = 0; i < mRepetitions; ++i) {
+    foreach (const Uuid& uuid, uuids) { dummy += hash.value(uuid); }
+  }
+  result.operations.append(
+      {"QHash<Uuid, int>::value()", timer.nsecsElapsed() / qreal(operations)});
+
+  timer.restart();
+  for (int i = 0; i < mRepetitions; ++i) {
+    foreach (const Uuid& uuid, uuids) { dummy += map.value(uuid); }
+  }
+  result.operations.append(
+      {"QMap<Uuid, int>::value()", timer.nsecsElapsed() / qreal(operations)});
+
+  Q_UNUSED(dummy);
+  return result;
+}
+
+void UuidBenchmark::printResult(const Result& result,
+                                QTextStream&  stream) noexcept {
+  stream << QString("%1 (%2 UUIDs, %3 bytes per Uuid object)")
+                .arg(result.name)
+                .arg(result.uuidCount)
+                .arg(result.bytesPerUuid)
+         << endl;
+  stream << QString("    %1 %2").arg("Operation", -40).arg("Avg [ns]", 10)
+         << endl;
+  foreach (const OperationResult& operation, result.operations) {
+    stream << QString("    %1 %2")
+                  .arg(operation.name, -40)
+                  .arg(operation.avgNs, 10, 'f', 1)
+           << endl;
+  }
+  stream << endl;
+}
+
+/*******************************************************************************
+ *  Private Methods
+ ******************************************************************************/
+
+QList<Uuid> UuidBenchmark::getUuids(const Project& project) noexcept {
+  QList<Uuid> uuids;
+  uuids += project.getCircuit().getNetClasses().keys();
+  uuids += project.getCircuit().getNetSignals().keys();
+  uuids += project.getCircuit().getComponentInstances().keys();
+  uuids += project.getLibrary().getSymbols().keys();
+  uuids += project.getLibrary().getPackages().keys();
+  uuids += project.getLibrary().getComponents().keys();
+  uuids += project.getLibrary().getDevices().keys();
+  return uuids;
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
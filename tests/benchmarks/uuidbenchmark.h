@@ -0,0 +1,96 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKS_UUIDBENCHMARK_H
+#define LIBREPCB_BENCHMARKS_UUIDBENCHMARK_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/uuid.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+
+namespace project {
+class Project;
+}
+
+namespace benchmarks {
+
+/*******************************************************************************
+ *  Class UuidBenchmark
+ ******************************************************************************/
+
+/**
+ * @brief The UuidBenchmark class measures the performance of ::librepcb::Uuid
+ *
+ * UUIDs are parsed for every element when loading projects and libraries,
+ * and they are used as keys of many QHash and QMap containers. This benchmark
+ * takes the UUIDs of a project (circuit and project library) and measures how
+ * long it takes to parse, format, hash and look them up.
+ */
+class UuidBenchmark final {
+public:
+  // Types
+  struct OperationResult {
+    QString name;
+    qreal   avgNs;  ///< Average time per operation
+  };
+
+  struct Result {
+    QString                name;
+    int                    uuidCount;
+    int                    bytesPerUuid;  ///< sizeof(Uuid)
+    QList<OperationResult> operations;
+  };
+
+  // Constructors / Destructor
+  UuidBenchmark() = delete;
+  UuidBenchmark(const UuidBenchmark& other) = delete;
+  explicit UuidBenchmark(int repetitions) noexcept;
+  ~UuidBenchmark() noexcept;
+
+  // General Methods
+  Result run(const QString& name, const project::Project& project) const
+      noexcept;
+  static void printResult(const Result& result, QTextStream& stream) noexcept;
+
+  // Operator Overloadings
+  UuidBenchmark& operator=(const UuidBenchmark& rhs) = delete;
+
+private:  // Methods
+  static QList<Uuid> getUuids(const project::Project& project) noexcept;
+
+private:  // Data
+  int mRepetitions;  ///< How often each operation is done per UUID
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace benchmarks
+}  // namespace librepcb
+
+#endif  // LIBREPCB_BENCHMARKS_UUIDBENCHMARK_H
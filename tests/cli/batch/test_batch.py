@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import os
+import params
+
+"""
+Test command "batch"
+"""
+
+
+def write_manifest(cli, content, path='manifest.lp'):
+    with open(cli.abspath(path), 'w') as f:
+        f.write('(librepcb_cli_batch\n{}\n)\n'.format(content))
+
+
+def test_help(cli):
+    code, stdout, stderr = cli.run('batch', '--help')
+    assert code == 0
+    assert len(stderr) == 0
+    assert len(stdout) > 5
+
+
+def test_export_pcb_fabrication_data_of_multiple_projects(cli):
+    projects = [params.EMPTY_PROJECT_LPP, params.PROJECT_WITH_TWO_BOARDS_LPP]
+    for project in projects:
+        cli.add_project(project.dir)
+    write_manifest(cli, '\n'.join([
+        ' (project "{}" (export_pcb_fabrication_data true))'.format(p.path)
+        for p in projects]))
+    code, stdout, stderr = cli.run('batch', '--jobs=2', 'manifest.lp')
+    assert code == 0
+    assert len(stderr) == 0
+    for i, project in enumerate(projects):
+        assert "[{}/2] Project '{}' finished in ".format(i + 1, project.path) \
+            in '\n'.join(stdout)
+    assert stdout[-2].startswith('Processed 2 project(s) in ')
+    assert stdout[-2].endswith(' ms: 2 succeeded, 0 failed.')
+    assert stdout[-1] == 'SUCCESS'
+    for project in projects:
+        dir = cli.abspath(project.output_dir + '/gerber')
+        assert os.path.exists(dir)
+        assert len(os.listdir(dir)) == 8 * project.board_count
+
+
+def test_project_paths_relative_to_manifest(cli):
+    project = params.EMPTY_PROJECT_LPP
+    cli.add_project(project.dir)
+    os.mkdir(cli.abspath('batch'))
+    write_manifest(cli, ' (project "../{}" (export_pcb_fabrication_data true))'
+                   .format(project.path), path='batch/manifest.lp')
+    code, stdout, stderr = cli.run('batch', 'batch/manifest.lp')
+    assert code == 0
+    assert len(stderr) == 0
+    assert stdout[0] == "Open batch manifest 'batch/manifest.lp'..."
+    assert "[1/1] Project '../{}' finished in ".format(project.path) \
+        in '\n'.join(stdout)
+    assert stdout[-1] == 'SUCCESS'
+
+
+def test_if_failing_project_fails(cli):
+    project = params.EMPTY_PROJECT_LPP
+    cli.add_project(project.dir)
+    write_manifest(cli, '\n'.join([
+        ' (project "{}" (export_pcb_fabrication_data true))'.format(
+            project.path),
+        ' (project "{}" (export_pcb_fabrication_data true) (board "foo"))'
+        .format(project.path),
+    ]))
+    code, stdout, stderr = cli.run('batch', '--jobs=1', 'manifest.lp')
+    assert code == 1
+    assert stderr == ["ERROR: No board with the name 'foo' found."]
+    assert stdout[-2].endswith(' ms: 1 succeeded, 1 failed.')
+    assert stdout[-1] == 'Finished with errors!'
+
+
+def test_invalid_job_count(cli):
+    write_manifest(cli, '')
+    code, stdout, stderr = cli.run('batch', '--jobs=0', 'manifest.lp')
+    assert code == 1
+    assert stderr[0] == "Invalid job count: '0'"
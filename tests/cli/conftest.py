@@ -47,6 +47,11 @@ class CliExecutor(object):
         else:
             shutil.copytree(src, dst)
 
+    def add_library(self, library):
+        src = os.path.join(DATA_DIR, 'libraries', library)
+        dst = os.path.join(self.tmpdir, library)
+        shutil.copytree(src, dst)
+
     def run(self, *args):
         p = subprocess.Popen([self.executable] + list(args), cwd=self.tmpdir,
                              stdout=subprocess.PIPE, stderr=subprocess.PIPE,
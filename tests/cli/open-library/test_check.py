@@ -0,0 +1,35 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import re
+import params
+
+"""
+Test command "open-library --check"
+"""
+
+
+def test_check_fails_on_warnings(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+
+    # remove the author of the library to get a warning
+    path = cli.abspath(library.dir + '/library.lp')
+    with open(path, 'r') as f:
+        content = f.read()
+    content, count = re.subn(r'\(author "[^"]*"\)', '(author "")', content)
+    assert count == 1
+    with open(path, 'w') as f:
+        f.write(content)
+
+    # without checks, the library is fine
+    code, stdout, stderr = cli.run('open-library', library.dir)
+    assert code == 0
+    assert len(stderr) == 0
+    assert stdout[-1] == 'SUCCESS'
+
+    # with checks, the warning lets the command fail
+    code, stdout, stderr = cli.run('open-library', '--check', library.dir)
+    assert code == 1
+    assert "    - [WARNING] {}: Author not set".format(library.dir) in stderr
+    assert stdout[-1] == 'Finished with errors!'
@@ -0,0 +1,42 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import params
+import pytest
+
+"""
+Test command "open-library --all --jobs"
+"""
+
+
+def run_all(cli, library, jobs):
+    code, stdout, stderr = cli.run('open-library', '--all', '--check',
+                                   '--verbose', '--jobs={}'.format(jobs),
+                                   library.dir)
+    # the throughput contains the elapsed time and the job count
+    assert stdout[-2].startswith('Processed ')
+    assert ' with {} parallel job(s) '.format(jobs) in stdout[-2]
+    # only compare the buffered verbose output of the element jobs, since
+    # other debug messages contain timestamps
+    opened = [line for line in stderr if line.startswith("Open '")]
+    messages = [line for line in stderr if line.startswith('    - ')]
+    return code, stdout[:-2] + stdout[-1:], opened, messages
+
+
+def test_parallel_output_is_ordered(cli):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    sequential = run_all(cli, library, 1)
+    parallel = run_all(cli, library, 4)
+    assert len(sequential[2]) > 0
+    assert parallel == sequential
+
+
+@pytest.mark.parametrize("jobs", ['0', '-1', 'foo'])
+def test_invalid_job_count(cli, jobs):
+    library = params.POPULATED_LIBRARY
+    cli.add_library(library.dir)
+    code, stdout, stderr = cli.run('open-library', '--all',
+                                   '--jobs={}'.format(jobs), library.dir)
+    assert code == 1
+    assert stderr[0] == "Invalid job count: '{}'".format(jobs)
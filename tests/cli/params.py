@@ -5,6 +5,11 @@ import os
 import pytest
 
 
+class Library:
+    def __init__(self, dir):
+        self.dir = dir
+
+
 class Project:
     def __init__(self, dir, path, output_dir, board_count):
         self.dir = dir
@@ -50,3 +55,5 @@ PROJECT_WITH_TWO_BOARDS_LPPZ = Project(
 )
 PROJECT_WITH_TWO_BOARDS_LPPZ_PARAM = pytest.param(PROJECT_WITH_TWO_BOARDS_LPPZ,
                                                   id='ProjectWithTwoBoards.lppz')
+
+POPULATED_LIBRARY = Library('Populated Library.lplib')
@@ -2,3 +2,4 @@ TEMPLATE = subdirs
 
 SUBDIRS = \
     unittests \
+    benchmarks \
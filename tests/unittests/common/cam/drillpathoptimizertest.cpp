@@ -0,0 +1,108 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/drillpathoptimizer.h>
+
+#include <algorithm>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class DrillPathOptimizerTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(DrillPathOptimizerTest, testTravelDistanceIsReduced) {
+  // 20x20 grid of drills in pseudo-random order
+  QList<Point> drills;
+  for (int i = 0; i < 400; ++i) {
+    int index = (i * 163) % 400;
+    drills.append(Point(Length(1000000 * (index % 20)),
+                        Length(1000000 * (index / 20))));
+  }
+
+  DrillPathOptimizer optimizer;
+  QList<Point>       result = optimizer.optimize(drills);
+
+  // all drills must still be there, exactly once
+  QList<Point> sortedDrills = drills;
+  QList<Point> sortedResult = result;
+  std::sort(sortedDrills.begin(), sortedDrills.end());
+  std::sort(sortedResult.begin(), sortedResult.end());
+  EXPECT_EQ(sortedDrills, sortedResult);
+
+  const DrillPathOptimizer::Report& report = optimizer.getReport();
+  EXPECT_EQ(400, report.drills);
+  EXPECT_NEAR(DrillPathOptimizer::calcTravelDistance(Point(), drills),
+              report.travelBefore.toNm(), 1);
+  EXPECT_NEAR(DrillPathOptimizer::calcTravelDistance(Point(), result),
+              report.travelAfter.toNm(), 1);
+  // the optimal tour is 399mm long, 2-opt should come close to it
+  EXPECT_LT(report.travelAfter.toMm(), 500);
+  EXPECT_GT(report.travelBefore.toMm(), 2000);
+}
+
+TEST_F(DrillPathOptimizerTest, testOptimalOrderIsKept) {
+  QList<Point> drills = {
+      Point(Length(1000000), Length(0)),
+      Point(Length(2000000), Length(0)),
+      Point(Length(3000000), Length(0)),
+  };
+  DrillPathOptimizer optimizer;
+  EXPECT_EQ(drills, optimizer.optimize(drills));
+  EXPECT_EQ(Length(3000000), optimizer.getReport().travelBefore);
+  EXPECT_EQ(Length(3000000), optimizer.getReport().travelAfter);
+}
+
+TEST_F(DrillPathOptimizerTest, testToolsContinueAtLastPosition) {
+  DrillPathOptimizer optimizer;
+  optimizer.optimize({Point(Length(0), Length(5000000))});
+  QList<Point> result = optimizer.optimize({
+      Point(Length(0), Length(0)),
+      Point(Length(0), Length(4000000)),
+  });
+  // the second tool starts where the first tool stopped
+  EXPECT_EQ(Point(Length(0), Length(4000000)), result.first());
+  EXPECT_EQ(3, optimizer.getReport().drills);
+  EXPECT_EQ(Length(5000000 + 5000000 + 4000000),
+            optimizer.getReport().travelBefore);
+  EXPECT_EQ(Length(5000000 + 1000000 + 4000000),
+            optimizer.getReport().travelAfter);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
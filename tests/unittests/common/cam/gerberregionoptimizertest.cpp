@@ -0,0 +1,129 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/cam/gerberregionoptimizer.h>
+#include <librepcb/common/toolbox.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GerberRegionOptimizerTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GerberRegionOptimizerTest, testCollinearVerticesAreRemoved) {
+  Path input({
+      Vertex(Point(0, 0)),
+      Vertex(Point(5000000, 0)),
+      Vertex(Point(10000000, 500)),  // within tolerance
+      Vertex(Point(20000000, 0)),
+      Vertex(Point(20000000, 10000000)),
+      Vertex(Point(10000000, 10000000)),
+      Vertex(Point(0, 10000000)),
+      Vertex(Point(0, 0)),
+  });
+  GerberRegionOptimizer optimizer;
+  Path                  output = optimizer.optimize(input);
+  Path expected({
+      Vertex(Point(0, 0)),
+      Vertex(Point(20000000, 0)),
+      Vertex(Point(20000000, 10000000)),
+      Vertex(Point(0, 10000000)),
+      Vertex(Point(0, 0)),
+  });
+  EXPECT_EQ(expected, output);
+  EXPECT_EQ(8, optimizer.getReport().inputVertices);
+  EXPECT_EQ(5, optimizer.getReport().outputVertices);
+  EXPECT_EQ(0, optimizer.getReport().fittedArcs);
+  EXPECT_EQ(Length(500), optimizer.getReport().maxDeviation);
+}
+
+TEST_F(GerberRegionOptimizerTest, testFlattenedArcIsRefitted) {
+  // quarter circle with radius 10mm around the origin, flattened with 0.5um
+  Point p1(10000000, 0);
+  Point p2(0, 10000000);
+  Path  input = Path::flatArc(p1, p2, Angle::deg90(), PositiveLength(500));
+  input.addVertex(Point(0, 0));
+  input.addVertex(p1);
+  ASSERT_GT(input.getVertices().count(), 10);
+
+  GerberRegionOptimizer optimizer;
+  Path                  output = optimizer.optimize(input);
+  ASSERT_EQ(4, output.getVertices().count());
+  EXPECT_EQ(p1, output.getVertices().at(0).getPos());
+  EXPECT_NEAR(90, output.getVertices().at(0).getAngle().toDeg(), 0.001);
+  EXPECT_EQ(p2, output.getVertices().at(1).getPos());
+  EXPECT_EQ(Point(0, 0), output.getVertices().at(2).getPos());
+  EXPECT_EQ(p1, output.getVertices().at(3).getPos());
+  EXPECT_EQ(1, optimizer.getReport().fittedArcs);
+  EXPECT_LE(optimizer.getReport().maxDeviation.toNm(), 1000);
+  Point center =
+      Toolbox::arcCenter(p1, p2, output.getVertices().at(0).getAngle());
+  EXPECT_LE(center.getLength()->toNm(), 10);
+}
+
+TEST_F(GerberRegionOptimizerTest, testCoarselyFlattenedArcIsNotRefitted) {
+  // quarter circle with radius 10mm around the origin, flattened with 5um,
+  // i.e. the vertices are on the circle but the middle of the segments is
+  // more than the tolerance away from it
+  Point p1(10000000, 0);
+  Point p2(0, 10000000);
+  Path  input = Path::flatArc(p1, p2, Angle::deg90(), PositiveLength(5000));
+  input.addVertex(Point(0, 0));
+  input.addVertex(p1);
+  ASSERT_GT(input.getVertices().count(), 10);
+  const Point& a       = input.getVertices().at(0).getPos();
+  const Point& b       = input.getVertices().at(1).getPos();
+  Length       sagitta = Length(10000000) - *((a + b) / 2).getLength();
+  ASSERT_GT(sagitta, Length(1000));
+
+  GerberRegionOptimizer optimizer;
+  EXPECT_EQ(input, optimizer.optimize(input));
+  EXPECT_EQ(0, optimizer.getReport().fittedArcs);
+  EXPECT_LE(optimizer.getReport().maxDeviation.toNm(), 1000);
+}
+
+TEST_F(GerberRegionOptimizerTest, testPolygonCornersAreNotRefitted) {
+  Path                  input = Path::octagon(PositiveLength(1000000),
+                                              PositiveLength(1000000));
+  GerberRegionOptimizer optimizer;
+  EXPECT_EQ(input, optimizer.optimize(input));
+  EXPECT_EQ(0, optimizer.getReport().fittedArcs);
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
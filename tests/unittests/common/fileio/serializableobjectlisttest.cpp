@@ -26,6 +26,7 @@
 #include <gtest/gtest.h>
 #include <librepcb/common/fileio/serializableobjectlist.h>
 
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore>
 
 /*******************************************************************************
@@ -50,6 +51,14 @@ using MinimalList =
 using List =
     SerializableObjectList<Mock, SerializableObjectListTagNameProvider>;
 
+/// Provides access to the lookup indices
+class IndexedList : public List {
+public:
+  using List::List;
+  int getUuidIndexCount() const noexcept { return mUuidIndex.count(); }
+  int getNameIndexCount() const noexcept { return mNameIndex.count(); }
+};
+
 /*******************************************************************************
  *  Test Class
  ******************************************************************************/
@@ -179,6 +188,108 @@ TEST_F(SerializableObjectListTest, testContainsName) {
   EXPECT_FALSE(l.contains(QString()));
 }
 
+TEST_F(SerializableObjectListTest, testIndexOfAfterInsert) {
+  List l{mMocks[0], mMocks[1], mMocks[2]};
+  EXPECT_EQ(2, l.indexOf(mMocks[2]->mUuid));  // builds the index
+  EXPECT_EQ(1, l.indexOf(QString("bar")));    // builds the index
+  std::shared_ptr<Mock> mock =
+      std::make_shared<Mock>(Uuid::createRandom(), "bar");
+  l.insert(1, mock);
+  EXPECT_EQ(1, l.indexOf(mock->mUuid));
+  EXPECT_EQ(3, l.indexOf(mMocks[2]->mUuid));
+  EXPECT_EQ(1, l.indexOf(QString("bar")));  // first occurrence
+  EXPECT_EQ(3, l.indexOf(mMocks[2].get()));
+}
+
+TEST_F(SerializableObjectListTest, testIndexOfAfterRemove) {
+  List l{mMocks[0], mMocks[1], mMocks[2]};
+  EXPECT_EQ(0, l.indexOf(mMocks[0]->mUuid));  // builds the index
+  EXPECT_EQ(2, l.indexOf(mMocks[2]->mUuid));  // builds the index
+  l.remove(0);
+  EXPECT_EQ(-1, l.indexOf(mMocks[0]->mUuid));
+  EXPECT_EQ(0, l.indexOf(mMocks[1]->mUuid));
+  EXPECT_EQ(1, l.indexOf(mMocks[2]->mUuid));
+  EXPECT_EQ(-1, l.indexOf(mMocks[0].get()));
+  EXPECT_EQ(1, l.indexOf(mMocks[2].get()));
+}
+
+TEST_F(SerializableObjectListTest, testIndexOfAfterSwap) {
+  List l{mMocks[0], mMocks[1], mMocks[2]};
+  EXPECT_EQ(2, l.indexOf(QString("pcb")));  // builds the index
+  l.swap(0, 2);
+  EXPECT_EQ(0, l.indexOf(QString("pcb")));
+  EXPECT_EQ(2, l.indexOf(QString("foo")));
+  EXPECT_EQ(2, l.indexOf(mMocks[0]->mUuid));
+}
+
+TEST_F(SerializableObjectListTest, testIndexOfAfterEdit) {
+  Uuid uuid = Uuid::createRandom();
+  List l{mMocks[0], mMocks[1], mMocks[2]};
+  EXPECT_EQ(1, l.indexOf(QString("bar")));    // builds the index
+  EXPECT_EQ(1, l.indexOf(mMocks[1]->mUuid));  // builds the index
+  mMocks[1]->mName = "baz";
+  mMocks[1]->mUuid = uuid;
+  mMocks[1]->onEdited.notify();
+  EXPECT_EQ(-1, l.indexOf(QString("bar")));
+  EXPECT_EQ(1, l.indexOf(QString("baz")));
+  EXPECT_EQ(2, l.indexOf(QString("pcb")));
+  EXPECT_EQ(1, l.indexOf(uuid));
+}
+
+TEST_F(SerializableObjectListTest, testIndexIsKeptOnEditsWithoutKeyChange) {
+  IndexedList l;
+  for (int i = 0; i < 100; ++i) {
+    l.append(std::make_shared<Mock>(Uuid::createRandom(), QString::number(i)));
+  }
+  EXPECT_EQ(99, l.indexOf(l.at(99)->mUuid));  // builds the whole index
+  EXPECT_EQ(99, l.indexOf(QString("99")));    // builds the whole index
+
+  // edits which don't change the UUID or name (e.g. moving elements) between
+  // lookups must not shrink the indices
+  for (int i = 0; i < l.count(); ++i) {
+    l.value(i)->onEdited.notify();
+    EXPECT_EQ(100, l.getUuidIndexCount());
+    EXPECT_EQ(100, l.getNameIndexCount());
+    EXPECT_EQ(i, l.indexOf(l.at(i)->mUuid));
+  }
+
+  // renaming an element shrinks the name index only
+  l.value(50)->mName = "foo";
+  l.value(50)->onEdited.notify();
+  EXPECT_EQ(100, l.getUuidIndexCount());
+  EXPECT_EQ(50, l.getNameIndexCount());
+  EXPECT_EQ(-1, l.indexOf(QString("50")));
+  EXPECT_EQ(50, l.indexOf(QString("foo")));
+}
+
+TEST_F(SerializableObjectListTest, testConcurrentConstLookups) {
+  List l;
+  for (int i = 0; i < 1000; ++i) {
+    l.append(std::make_shared<Mock>(Uuid::createRandom(), QString::number(i)));
+  }
+  const List& constList = l;
+
+  // all threads extend the lazily built indices at the same time
+  QList<QFuture<int>> futures;
+  for (int t = 0; t < 8; ++t) {
+    futures.append(QtConcurrent::run([&constList]() {
+      int errors = 0;
+      for (int i = constList.count() - 1; i >= 0; --i) {
+        const Mock& mock = *constList.at(i);
+        if ((constList.indexOf(mock.mUuid) != i) ||
+            (constList.indexOf(mock.mName) != i) ||
+            (constList.indexOf(&mock) != i)) {
+          ++errors;
+        }
+      }
+      return errors;
+    }));
+  }
+  foreach (const QFuture<int>& future, futures) {
+    EXPECT_EQ(0, future.result());
+  }
+}
+
 TEST_F(SerializableObjectListTest, testDataAccess) {
   List l{mMocks[0], mMocks[1], mMocks[2]};
   EXPECT_EQ(mMocks[0], l.first());
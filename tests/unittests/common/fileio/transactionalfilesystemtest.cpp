@@ -721,6 +721,39 @@ TEST_F(TransactionalFileSystemTest, testCheckForModifications) {
   EXPECT_EQ(0, fs.checkForModifications().count());
 }
 
+TEST_F(TransactionalFileSystemTest, testCheckForModificationsOfReadFiles) {
+  TransactionalFileSystem fs(mPopulatedDir, true);
+
+  // write back the read content (compared by hash) and unread files (compared
+  // with the files on the disk)
+  fs.write("1.txt", fs.read("1.txt"));    // unchanged read file
+  fs.write("2.txt", fs.read("2.txt"));    // overwrite read file
+  fs.write("2.txt", "new 2");             // overwrite read file
+  fs.write("1/1a.txt", "1a");             // unchanged unread file
+  fs.write("1/1b.txt", "new 1b");         // overwrite unread file
+  fs.write("a/b/c", fs.read("a/b/c"));    // unchanged read file
+  fs.removeDirRecursively("a");           // remove existing directory
+  std::list<std::string> modified;
+  foreach (const QString& str, fs.checkForModifications()) {
+    modified.push_back(str.toStdString());
+  }
+  modified.sort();
+  std::list<std::string> expected = {"1/1b.txt", "2.txt", "a/"};
+  EXPECT_EQ(expected, modified);
+
+  // after saving, the written content is known to be on the disk
+  fs.save();
+  fs.write("2.txt", "new 2");
+  fs.write("1/1b.txt", "new 1b");
+  fs.write("a/b/c", "c");  // removed file, must not be considered as unchanged
+  modified.clear();
+  foreach (const QString& str, fs.checkForModifications()) {
+    modified.push_back(str.toStdString());
+  }
+  expected = {"a/b/c"};
+  EXPECT_EQ(expected, modified);
+}
+
 /*******************************************************************************
  *  Parametrized getSubDirs() Tests
  ******************************************************************************/
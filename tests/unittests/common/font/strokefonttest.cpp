@@ -0,0 +1,118 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <librepcb/common/application.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/font/strokefont.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class StrokeFontTest : public ::testing::Test {
+protected:
+  static FilePath getFontFilePath() noexcept {
+    return qApp->getResourcesFilePath("fontobene")
+        .getPathTo(qApp->getDefaultStrokeFontName());
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(StrokeFontTest, testCachedGlyphsAreEqualToUncachedGlyphs) {
+  FilePath   fp      = getFontFilePath();
+  QByteArray content = FileUtils::readFile(fp);  // can throw
+  QString    text    = "R1 100nF/50V";
+  QList<PositiveLength> heights = {PositiveLength(100000),
+                                   PositiveLength(1000000),
+                                   PositiveLength(2540000)};
+  foreach (const PositiveLength& height, heights) {
+    // use a new font for each height to start with an empty cache
+    StrokeFont    font(fp, content);
+    Length        uncachedWidth;
+    QVector<Path> uncached =
+        font.strokeLine(text, height, Length(0), uncachedWidth);
+    int misses = font.getGlyphCacheMisses();
+    EXPECT_GT(misses, 0);
+
+    Length        cachedWidth;
+    QVector<Path> cached =
+        font.strokeLine(text, height, Length(0), cachedWidth);
+    EXPECT_EQ(misses, font.getGlyphCacheMisses());
+    EXPECT_FALSE(cached.isEmpty());
+    EXPECT_EQ(uncached, cached);
+    EXPECT_EQ(uncachedWidth, cachedWidth);
+  }
+}
+
+TEST_F(StrokeFontTest, testRepeatedTextIsCached) {
+  FilePath   fp = getFontFilePath();
+  StrokeFont font(fp, FileUtils::readFile(fp));  // can throw
+  EXPECT_EQ(0, font.getGlyphCacheSize());
+  EXPECT_EQ(0, font.getGlyphCacheHits());
+  EXPECT_EQ(0, font.getGlyphCacheMisses());
+
+  Length width;
+  font.strokeLine("ABC", PositiveLength(1000000), Length(0), width);
+  EXPECT_EQ(3, font.getGlyphCacheSize());
+  EXPECT_EQ(0, font.getGlyphCacheHits());
+  EXPECT_EQ(3, font.getGlyphCacheMisses());
+
+  font.strokeLine("ABC", PositiveLength(1000000), Length(0), width);
+  font.strokeLine("CBA", PositiveLength(1000000), Length(0), width);
+  EXPECT_EQ(3, font.getGlyphCacheSize());
+  EXPECT_EQ(6, font.getGlyphCacheHits());
+  EXPECT_EQ(3, font.getGlyphCacheMisses());
+}
+
+TEST_F(StrokeFontTest, testDifferentHeightIsNotCached) {
+  FilePath   fp = getFontFilePath();
+  StrokeFont font(fp, FileUtils::readFile(fp));  // can throw
+
+  Length width;
+  font.strokeLine("A", PositiveLength(1000000), Length(0), width);
+  EXPECT_EQ(1, font.getGlyphCacheSize());
+  EXPECT_EQ(0, font.getGlyphCacheHits());
+  EXPECT_EQ(1, font.getGlyphCacheMisses());
+
+  font.strokeLine("A", PositiveLength(1000001), Length(0), width);
+  EXPECT_EQ(2, font.getGlyphCacheSize());
+  EXPECT_EQ(0, font.getGlyphCacheHits());
+  EXPECT_EQ(2, font.getGlyphCacheMisses());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
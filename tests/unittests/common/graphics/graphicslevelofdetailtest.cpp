@@ -0,0 +1,141 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicslevelofdetail.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GraphicsLevelOfDetailTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GraphicsLevelOfDetailTest, testTextThreshold) {
+  GraphicsLevelOfDetail lod(true, 8, 4);
+  EXPECT_TRUE(lod.isTextDetailed(1, 8));
+  EXPECT_TRUE(lod.isTextDetailed(0.5, 16));
+  EXPECT_FALSE(lod.isTextDetailed(0.5, 15.9));
+  EXPECT_FALSE(lod.isTextDetailed(0.01, 100));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testItemThreshold) {
+  GraphicsLevelOfDetail lod(true, 8, 4);
+  EXPECT_TRUE(lod.isItemDetailed(1, QRectF(0, 0, 4, 1)));
+  EXPECT_TRUE(lod.isItemDetailed(1, QRectF(0, 0, 1, 4)));
+  EXPECT_TRUE(lod.isItemDetailed(0.1, QRectF(-20, -20, 40, 10)));
+  EXPECT_FALSE(lod.isItemDetailed(1, QRectF(0, 0, 3.9, 3.9)));
+  EXPECT_FALSE(lod.isItemDetailed(0.1, QRectF(0, 0, 30, 30)));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testLineThreshold) {
+  GraphicsLevelOfDetail lod(true, 8, 4);
+  EXPECT_TRUE(lod.isLineDetailed(1, 1));
+  EXPECT_TRUE(lod.isLineDetailed(0.25, 4));
+  EXPECT_FALSE(lod.isLineDetailed(0.25, 3.9));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testModifiedThresholds) {
+  GraphicsLevelOfDetail lod;
+  lod.setMinTextHeightPx(20);
+  lod.setMinItemSizePx(10);
+  EXPECT_FALSE(lod.isTextDetailed(1, 19));
+  EXPECT_TRUE(lod.isTextDetailed(1, 20));
+  EXPECT_FALSE(lod.isItemDetailed(1, QRectF(0, 0, 9, 9)));
+  EXPECT_TRUE(lod.isItemDetailed(1, QRectF(0, 0, 10, 10)));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testDisabled) {
+  GraphicsLevelOfDetail lod(false, 8, 4);
+  EXPECT_TRUE(lod.isTextDetailed(0.001, 1));
+  EXPECT_TRUE(lod.isItemDetailed(0.001, QRectF(0, 0, 1, 1)));
+  EXPECT_TRUE(lod.isLineDetailed(0.001, 1));
+  EXPECT_EQ(0, lod.getOutlineTolerancePx(0.001));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testFromWidgetWithoutView) {
+  const GraphicsLevelOfDetail& lod = GraphicsLevelOfDetail::fromWidget(nullptr);
+  EXPECT_FALSE(lod.isEnabled());
+  EXPECT_TRUE(lod.isTextDetailed(0.001, 1));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testOutlineTolerance) {
+  GraphicsLevelOfDetail lod(true, 8, 4);
+  EXPECT_EQ(0.5, lod.getOutlineTolerancePx(1));
+  EXPECT_EQ(1, lod.getOutlineTolerancePx(0.5));
+  EXPECT_EQ(1, lod.getOutlineTolerancePx(0.3));  // rounded down
+  EXPECT_EQ(2, lod.getOutlineTolerancePx(0.25));
+  EXPECT_EQ(64, lod.getOutlineTolerancePx(0.005));
+  EXPECT_EQ(0, lod.getOutlineTolerancePx(0));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testSimplifyPolygonRemovesCloseVertices) {
+  QPolygonF polygon;
+  polygon << QPointF(0, 0) << QPointF(5, 0.4) << QPointF(10, 0)
+          << QPointF(10, 10) << QPointF(0, 10) << QPointF(0, 0);
+  QPolygonF expected;
+  expected << QPointF(0, 0) << QPointF(10, 0) << QPointF(10, 10)
+           << QPointF(0, 10) << QPointF(0, 0);
+  EXPECT_EQ(expected, GraphicsLevelOfDetail::simplifyPolygon(polygon, 0.5));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testSimplifyPolygonKeepsFarVertices) {
+  QPolygonF polygon;
+  polygon << QPointF(0, 0) << QPointF(5, 0.6) << QPointF(10, 0)
+          << QPointF(10, 10) << QPointF(0, 10) << QPointF(0, 0);
+  EXPECT_EQ(polygon, GraphicsLevelOfDetail::simplifyPolygon(polygon, 0.5));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testSimplifyPolygonWithZeroTolerance) {
+  QPolygonF polygon;
+  polygon << QPointF(0, 0) << QPointF(5, 0) << QPointF(10, 0);
+  EXPECT_EQ(polygon, GraphicsLevelOfDetail::simplifyPolygon(polygon, 0));
+}
+
+TEST_F(GraphicsLevelOfDetailTest, testSimplifyFlattenedArc) {
+  // a circle with radius 1000px, flattened into 360 segments
+  QPolygonF polygon;
+  for (int i = 0; i <= 360; ++i) {
+    qreal angle = qDegreesToRadians(qreal(i));
+    polygon << QPointF(1000 * qCos(angle), 1000 * qSin(angle));
+  }
+  QPolygonF simplified = GraphicsLevelOfDetail::simplifyPolygon(polygon, 4);
+  EXPECT_LT(simplified.count(), polygon.count() / 4);
+  EXPECT_EQ(polygon.first(), simplified.first());
+  EXPECT_EQ(polygon.last(), simplified.last());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
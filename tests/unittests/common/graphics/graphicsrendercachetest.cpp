@@ -0,0 +1,116 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/defaultgraphicslayerprovider.h>
+#include <librepcb/common/graphics/graphicsrendercache.h>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GraphicsRenderCacheTest : public ::testing::Test {
+protected:
+  DefaultGraphicsLayerProvider mLayers;
+  int                          mBuildCounter = 0;
+
+  GraphicsRenderCache::Builder builder(GraphicsRenderCache& cache) {
+    return [this, &cache](GraphicsRenderCache::Entry& entry) {
+      ++mBuildCounter;
+      QPainterPath path;
+      path.addRect(0, 0, 10, 10);
+      entry.primitives.append(GraphicsRenderCache::Primitive(
+          path, cache.getLayer(GraphicsLayer::sSymbolOutlines), 1,
+          cache.getLayer(GraphicsLayer::sSymbolGrabAreas)));
+      entry.boundingRect = path.boundingRect();
+    };
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GraphicsRenderCacheTest, testEntryIsSharedBetweenItems) {
+  GraphicsRenderCache cache(mLayers);
+  int                 element = 0;
+  auto                entry1  = cache.get(&element, 0, builder(cache));
+  auto                entry2  = cache.get(&element, 0, builder(cache));
+  EXPECT_EQ(entry1.get(), entry2.get());
+  EXPECT_EQ(1, mBuildCounter);
+  EXPECT_EQ(1, cache.getHitCount());
+  EXPECT_EQ(1, cache.getMissCount());
+  EXPECT_EQ(QRectF(0, 0, 10, 10), entry1->boundingRect);
+}
+
+TEST_F(GraphicsRenderCacheTest, testVariantsAreCachedSeparately) {
+  GraphicsRenderCache cache(mLayers);
+  int                 element = 0;
+  auto                entry1  = cache.get(&element, 0, builder(cache));
+  auto                entry2  = cache.get(&element, 1, builder(cache));
+  EXPECT_NE(entry1.get(), entry2.get());
+  EXPECT_EQ(2, mBuildCounter);
+  EXPECT_EQ(2, cache.getEntryCount());
+}
+
+TEST_F(GraphicsRenderCacheTest, testUnusedEntriesAreReleased) {
+  GraphicsRenderCache cache(mLayers);
+  int                 element = 0;
+  cache.get(&element, 0, builder(cache));
+  EXPECT_EQ(0, cache.getEntryCount());
+  cache.get(&element, 0, builder(cache));
+  EXPECT_EQ(2, mBuildCounter);
+}
+
+TEST_F(GraphicsRenderCacheTest, testLayerColorChangeInvalidatesEntries) {
+  GraphicsRenderCache cache(mLayers);
+  int                 element = 0;
+  auto                entry1  = cache.get(&element, 0, builder(cache));
+  mLayers.getLayer(GraphicsLayer::sSymbolOutlines)->setColor(Qt::green);
+  auto entry2 = cache.get(&element, 0, builder(cache));
+  EXPECT_NE(entry1.get(), entry2.get());
+  EXPECT_EQ(2, mBuildCounter);
+  EXPECT_EQ(QColor(Qt::green), entry2->primitives.first().pen.color());
+}
+
+TEST_F(GraphicsRenderCacheTest, testLayerVisibilityChangeInvalidatesEntries) {
+  GraphicsRenderCache cache(mLayers);
+  int                 element = 0;
+  auto                entry1  = cache.get(&element, 0, builder(cache));
+  EXPECT_EQ(Qt::SolidPattern, entry1->primitives.first().brush.style());
+  mLayers.getLayer(GraphicsLayer::sSymbolGrabAreas)->setVisible(false);
+  auto entry2 = cache.get(&element, 0, builder(cache));
+  EXPECT_EQ(Qt::NoBrush, entry2->primitives.first().brush.style());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -0,0 +1,183 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicsviewtilecache.h>
+
+#include <QtConcurrent/QtConcurrent>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class GraphicsViewTileCacheTest : public ::testing::Test {
+protected:
+  GridProperties mGrid = GridProperties(GridProperties::Type_t::Lines,
+                                        PositiveLength(2540000),
+                                        LengthUnit::millimeters());
+
+  void draw(GraphicsViewTileCache& cache, const QRectF& rect) {
+    QImage   image(256, 256, QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+    cache.draw(painter, rect);
+  }
+
+  void finishRendering() {
+    // wait for the worker threads, then deliver their results
+    QThreadPool::globalInstance()->waitForDone();
+    for (int i = 0; i < 10; ++i) {
+      QCoreApplication::processEvents();
+    }
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(GraphicsViewTileCacheTest, testTileSceneRect) {
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 1, 1);
+  EXPECT_EQ(QRectF(0, 0, 256, 256), cache.getTileSceneRect(QPoint(0, 0)));
+  EXPECT_EQ(QRectF(-256, 512, 256, 256),
+            cache.getTileSceneRect(QPoint(-1, 2)));
+}
+
+TEST_F(GraphicsViewTileCacheTest, testTileSceneRectWithScale) {
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 4, 1);
+  EXPECT_EQ(QRectF(64, 0, 64, 64), cache.getTileSceneRect(QPoint(1, 0)));
+}
+
+TEST_F(GraphicsViewTileCacheTest, testTileSceneRectWithDevicePixelRatio) {
+  // a tile has 256 device pixels, i.e. 128 logical pixels
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 2, 2);
+  EXPECT_EQ(QRectF(64, 0, 64, 64), cache.getTileSceneRect(QPoint(1, 0)));
+}
+
+TEST_F(GraphicsViewTileCacheTest, testTileRange) {
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 1, 1);
+  EXPECT_EQ(QRect(QPoint(0, 0), QPoint(0, 0)),
+            cache.getTileRange(QRectF(0, 0, 256, 256)));
+  EXPECT_EQ(QRect(QPoint(0, 0), QPoint(1, 0)),
+            cache.getTileRange(QRectF(0, 0, 257, 256)));
+  EXPECT_EQ(QRect(QPoint(-1, -1), QPoint(0, 0)),
+            cache.getTileRange(QRectF(-1, -1, 2, 2)));
+  EXPECT_EQ(QRect(QPoint(0, 0), QPoint(2, 0)),
+            cache.getTileRange(QRectF(10, 10, 600, 100)));
+  EXPECT_EQ(QRect(QPoint(-2, 0), QPoint(-2, 0)),
+            cache.getTileRange(QRectF(-300, 0, 0, 0)));
+}
+
+TEST_F(GraphicsViewTileCacheTest, testDrawRendersVisibleAndSurroundingTiles) {
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 1, 1);
+  draw(cache, QRectF(0, 0, 256, 256));
+  EXPECT_EQ(0, cache.getTileCount());
+  EXPECT_EQ(9, cache.getPendingTileCount());  // visible tile + ring around
+  finishRendering();
+  EXPECT_EQ(9, cache.getTileCount());
+  EXPECT_EQ(0, cache.getPendingTileCount());
+
+  // drawing the same region again does not render anything
+  draw(cache, QRectF(0, 0, 256, 256));
+  EXPECT_EQ(0, cache.getPendingTileCount());
+
+  // scrolling by one tile only renders the new tiles
+  draw(cache, QRectF(256, 0, 256, 256));
+  EXPECT_EQ(3, cache.getPendingTileCount());
+}
+
+TEST_F(GraphicsViewTileCacheTest, testUnchangedParametersKeepTiles) {
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 1, 1);
+  draw(cache, QRectF(0, 0, 256, 256));
+  finishRendering();
+  cache.setParameters(Qt::black, mGrid, 1, 1);
+  EXPECT_EQ(9, cache.getTileCount());
+}
+
+TEST_F(GraphicsViewTileCacheTest, testChangedParametersInvalidateTiles) {
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 1, 1);
+  draw(cache, QRectF(0, 0, 256, 256));
+  finishRendering();
+  cache.setParameters(Qt::white, mGrid, 1, 1);
+  EXPECT_EQ(0, cache.getTileCount());
+
+  draw(cache, QRectF(0, 0, 256, 256));
+  finishRendering();
+  cache.setParameters(Qt::white, mGrid, 1, 2);  // device pixel ratio
+  EXPECT_EQ(0, cache.getTileCount());
+
+  draw(cache, QRectF(0, 0, 256, 256));
+  finishRendering();
+  GridProperties grid = mGrid;
+  grid.setType(GridProperties::Type_t::Dots);
+  cache.setParameters(Qt::white, grid, 1, 2);
+  EXPECT_EQ(0, cache.getTileCount());
+}
+
+TEST_F(GraphicsViewTileCacheTest, testInvalidate) {
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 1, 1);
+  draw(cache, QRectF(0, 0, 256, 256));
+  finishRendering();
+  cache.invalidate();
+  EXPECT_EQ(0, cache.getTileCount());
+  EXPECT_EQ(0, cache.getPendingTileCount());
+}
+
+TEST_F(GraphicsViewTileCacheTest, testOutdatedTilesAreDiscarded) {
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 1, 1);
+  draw(cache, QRectF(0, 0, 256, 256));
+  cache.setParameters(Qt::black, mGrid, 2, 1);  // while jobs are running
+  finishRendering();
+  EXPECT_EQ(0, cache.getTileCount());
+}
+
+TEST_F(GraphicsViewTileCacheTest, testLeastRecentlyUsedTilesAreRemoved) {
+  GraphicsViewTileCache cache;
+  cache.setParameters(Qt::black, mGrid, 1, 1);
+  for (int i = 0; i < 30; ++i) {
+    draw(cache, QRectF(i * 3 * 256, 0, 256, 256));  // 9 new tiles each time
+    finishRendering();
+  }
+  draw(cache, QRectF(0, 0, 1, 1));  // triggers the cleanup
+  EXPECT_EQ(GraphicsViewTileCache::sMaxTiles, cache.getTileCount());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
@@ -98,6 +98,76 @@ TEST(SignalSlotTest, testDuringCallbackDetachedSlotsAreNotCalled) {
   EXPECT_EQ(1, callbackCounter);
 }
 
+TEST(SignalSlotTest, testDuringCallbackDestroyedSlotsAreNotCalled) {
+  int                                callbackCounter = 0;
+  Sender                             sender;
+  std::unique_ptr<Slot<Sender, int>> receiver;
+  Slot<Sender, int>                  slot([&](const Sender&, int) {
+    ++callbackCounter;
+    receiver.reset();
+  });
+  receiver.reset(new Slot<Sender, int>(
+      [&](const Sender&, int) { ++callbackCounter; }));
+  sender.signal.attach(slot);
+  sender.signal.attach(*receiver);
+
+  EXPECT_EQ(2, sender.signal.getSlotCount());
+  sender.signal.notify(42);
+  EXPECT_EQ(1, sender.signal.getSlotCount());
+  EXPECT_EQ(1, callbackCounter);
+  sender.signal.notify(42);
+  EXPECT_EQ(2, callbackCounter);
+}
+
+TEST(SignalSlotTest, testAttachSlotTwice) {
+  Sender   sender;
+  Receiver receiver;
+  sender.signal.attach(receiver.slot);
+  sender.signal.attach(receiver.slot);
+  EXPECT_EQ(1, sender.signal.getSlotCount());
+  EXPECT_EQ(1, receiver.slot.getSignalCount());
+  EXPECT_CALL(receiver, callback(testing::_, 42)).Times(1);
+  sender.signal.notify(42);
+}
+
+TEST(SignalSlotTest, testBatchCoalescesEqualNotifications) {
+  Sender   sender;
+  Receiver receiver;
+  sender.signal.attach(receiver.slot);
+  EXPECT_CALL(receiver, callback(testing::_, testing::_)).Times(0);
+  {
+    SignalBatch<Sender, int> batch(sender.signal);
+    sender.signal.notify(2);
+    sender.signal.notify(1);
+    sender.signal.notify(2);
+    sender.signal.notify(1);
+    testing::Mock::VerifyAndClearExpectations(&receiver);
+    testing::InSequence s;  // in order of their first occurrence
+    EXPECT_CALL(receiver, callback(testing::_, 2)).Times(1);
+    EXPECT_CALL(receiver, callback(testing::_, 1)).Times(1);
+  }
+}
+
+TEST(SignalSlotTest, testNestedBatchesEmitNotificationsOnce) {
+  Sender   sender;
+  Receiver receiver;
+  sender.signal.attach(receiver.slot);
+  EXPECT_CALL(receiver, callback(testing::_, testing::_)).Times(0);
+  {
+    SignalBatch<Sender, int> outerBatch(sender.signal);
+    {
+      SignalBatch<Sender, int> innerBatch(sender.signal);
+      sender.signal.notify(42);
+    }
+    sender.signal.notify(42);
+    testing::Mock::VerifyAndClearExpectations(&receiver);
+    EXPECT_CALL(receiver, callback(testing::_, 42)).Times(1);
+  }
+  testing::Mock::VerifyAndClearExpectations(&receiver);
+  EXPECT_CALL(receiver, callback(testing::_, 42)).Times(1);
+  sender.signal.notify(42);  // not batched anymore
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
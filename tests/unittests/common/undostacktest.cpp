@@ -0,0 +1,218 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/undocommand.h>
+#include <librepcb/common/undostack.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*******************************************************************************
+ *  Helpers
+ ******************************************************************************/
+
+class CmdSetValue final : public UndoCommand {
+public:
+  CmdSetValue(int& value, int newValue, qint64 memoryUsage = 0) noexcept
+    : UndoCommand("Set value"),
+      mValue(value),
+      mOldValue(value),
+      mNewValue(newValue),
+      mMemoryUsage(memoryUsage) {}
+  qint64 getApproxMemoryUsage() const noexcept override {
+    return mMemoryUsage;
+  }
+  bool canMergeWith(const UndoCommand& other) const noexcept override {
+    const CmdSetValue* cmd = dynamic_cast<const CmdSetValue*>(&other);
+    return cmd && (&cmd->mValue == &mValue) && (cmd->mOldValue == mNewValue);
+  }
+
+private:
+  bool performExecute() override {
+    performRedo();
+    return true;
+  }
+  void performUndo() override { mValue = mOldValue; }
+  void performRedo() override { mValue = mNewValue; }
+  void performMerge(const UndoCommand& other) override {
+    mNewValue = dynamic_cast<const CmdSetValue&>(other).mNewValue;
+  }
+
+  int&   mValue;
+  int    mOldValue;
+  int    mNewValue;
+  qint64 mMemoryUsage;
+};
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class UndoStackTest : public ::testing::Test {};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(UndoStackTest, testMaxCommandCountDropsOldestCommands) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMergeInterval(-1);
+  stack.setMaxCommandCount(3);
+  for (int i = 1; i <= 5; ++i) {
+    stack.execCmd(new CmdSetValue(value, i));
+  }
+  EXPECT_EQ(3, stack.getCommandCount());
+  stack.undo();
+  stack.undo();
+  stack.undo();
+  EXPECT_FALSE(stack.canUndo());
+  EXPECT_EQ(2, value);
+}
+
+TEST_F(UndoStackTest, testMaxMemoryUsageDropsOldestCommands) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMergeInterval(-1);
+  stack.setMaxMemoryUsage(250);
+  for (int i = 1; i <= 5; ++i) {
+    stack.execCmd(new CmdSetValue(value, i, 100));
+  }
+  EXPECT_EQ(2, stack.getCommandCount());
+  EXPECT_EQ(200, stack.getMemoryUsage());
+  stack.undo();
+  EXPECT_EQ(200, stack.getMemoryUsage());  // redo commands are still counted
+  stack.execCmd(new CmdSetValue(value, 42, 100));
+  EXPECT_EQ(2, stack.getCommandCount());
+  EXPECT_EQ(200, stack.getMemoryUsage());
+}
+
+TEST_F(UndoStackTest, testTopCommandIsNeverDropped) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMergeInterval(-1);
+  stack.setMaxMemoryUsage(10);
+  stack.execCmd(new CmdSetValue(value, 1, 100));
+  stack.execCmd(new CmdSetValue(value, 2, 100));
+  EXPECT_EQ(1, stack.getCommandCount());
+  stack.undo();
+  EXPECT_EQ(1, value);
+}
+
+TEST_F(UndoStackTest, testCleanStateIsKeptWhenDroppingCommands) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMergeInterval(-1);
+  stack.setMaxCommandCount(2);
+  stack.execCmd(new CmdSetValue(value, 1));
+  stack.setClean();
+  stack.execCmd(new CmdSetValue(value, 2));
+  stack.execCmd(new CmdSetValue(value, 3));
+  EXPECT_EQ(2, stack.getCommandCount());
+  stack.undo();
+  stack.undo();
+  EXPECT_FALSE(stack.canUndo());
+  EXPECT_TRUE(stack.isClean());
+  EXPECT_EQ(1, value);
+}
+
+TEST_F(UndoStackTest, testDroppedCleanStateIsInvalid) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMergeInterval(-1);
+  stack.setMaxCommandCount(2);
+  stack.execCmd(new CmdSetValue(value, 1));
+  stack.execCmd(new CmdSetValue(value, 2));
+  stack.execCmd(new CmdSetValue(value, 3));
+  stack.undo();
+  stack.undo();
+  EXPECT_FALSE(stack.canUndo());
+  EXPECT_FALSE(stack.isClean());
+  EXPECT_EQ(1, value);
+}
+
+TEST_F(UndoStackTest, testConsecutiveCommandsAreMerged) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMergeInterval(60000);
+  stack.execCmd(new CmdSetValue(value, 1));
+  stack.execCmd(new CmdSetValue(value, 2));
+  stack.execCmd(new CmdSetValue(value, 3));
+  EXPECT_EQ(1, stack.getCommandCount());
+  EXPECT_EQ(3, value);
+  stack.undo();
+  EXPECT_EQ(0, value);
+  stack.redo();
+  EXPECT_EQ(3, value);
+}
+
+TEST_F(UndoStackTest, testNoMergeAfterUndo) {
+  int       value1 = 0;
+  int       value2 = 0;
+  UndoStack stack;
+  stack.setMergeInterval(60000);
+  stack.execCmd(new CmdSetValue(value1, 1));
+  stack.execCmd(new CmdSetValue(value2, 1));
+  stack.undo();
+  stack.execCmd(new CmdSetValue(value1, 2));
+  EXPECT_EQ(2, stack.getCommandCount());
+  stack.execCmd(new CmdSetValue(value1, 3));
+  EXPECT_EQ(2, stack.getCommandCount());
+  stack.undo();
+  EXPECT_EQ(1, value1);
+}
+
+TEST_F(UndoStackTest, testNoMergeIntoCleanState) {
+  int       value = 0;
+  UndoStack stack;
+  stack.setMergeInterval(60000);
+  stack.execCmd(new CmdSetValue(value, 1));
+  stack.setClean();
+  stack.execCmd(new CmdSetValue(value, 2));
+  EXPECT_EQ(2, stack.getCommandCount());
+  stack.undo();
+  EXPECT_TRUE(stack.isClean());
+  EXPECT_EQ(1, value);
+}
+
+TEST_F(UndoStackTest, testNoMergeOfUnrelatedCommands) {
+  int       value1 = 0;
+  int       value2 = 0;
+  UndoStack stack;
+  stack.setMergeInterval(60000);
+  stack.execCmd(new CmdSetValue(value1, 1));
+  stack.execCmd(new CmdSetValue(value2, 1));
+  EXPECT_EQ(2, stack.getCommandCount());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace librepcb
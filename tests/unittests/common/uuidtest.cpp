@@ -153,6 +153,29 @@ TEST(UuidTest, testCreateRandom) {
   }
 }
 
+TEST(UuidTest, testCreateRandomRoundTrip) {
+  for (int i = 0; i < 1000; i++) {
+    Uuid uuid = Uuid::createRandom();
+    EXPECT_EQ(uuid, Uuid::fromString(uuid.toStr()));
+    EXPECT_EQ(QUuid(uuid.toStr()).toString().remove("{").remove("}"),
+              uuid.toStr());
+  }
+}
+
+TEST_P(UuidTest, testQHash) {
+  const UuidTestData& data = GetParam();
+  if (data.valid) {
+    Uuid uuid1 = Uuid::fromString(data.uuid);
+    Uuid uuid2 = Uuid::fromString(data.uuid);
+    EXPECT_EQ(qHash(uuid1, 0), qHash(uuid2, 0));
+    EXPECT_EQ(qHash(uuid1, 42), qHash(uuid2, 42));
+    QHash<Uuid, int> hash;
+    hash.insert(Uuid::fromString("d2c30518-5cd1-4ce9-a569-44f783a3f66a"), 1);
+    hash.insert(uuid1, 2);
+    EXPECT_EQ(2, hash.value(uuid2));
+  }
+}
+
 TEST_P(UuidTest, testIsValid) {
   const UuidTestData& data = GetParam();
   EXPECT_EQ(data.valid, Uuid::isValid(data.uuid));
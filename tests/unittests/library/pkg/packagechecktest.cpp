@@ -0,0 +1,119 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/library/pkg/msg/msgpadoverlapswithplacement.h>
+#include <librepcb/library/pkg/package.h>
+#include <librepcb/library/pkg/packagecheck.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace library {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class PackageCheckTest : public ::testing::Test {
+protected:
+  QScopedPointer<Package>       mPackage;
+  std::shared_ptr<FootprintPad> mPad;
+
+  PackageCheckTest() {
+    mPackage.reset(new Package(Uuid::createRandom(), Version::fromString("1.0"),
+                               "test", ElementName("Test"), "", ""));
+    Uuid padUuid = Uuid::createRandom();
+    mPackage->getPads().append(
+        std::make_shared<PackagePad>(padUuid, CircuitIdentifier("1")));
+    std::shared_ptr<Footprint> footprint = std::make_shared<Footprint>(
+        Uuid::createRandom(), ElementName("default"), "");
+    footprint->getPolygons().append(std::make_shared<Polygon>(
+        Uuid::createRandom(), GraphicsLayerName(GraphicsLayer::sTopPlacement),
+        UnsignedLength(200000), false, false,
+        Path::centeredRect(PositiveLength(2000000), PositiveLength(2000000))));
+    mPad = std::make_shared<FootprintPad>(
+        padUuid, Point(1000000, 0), Angle::deg0(), FootprintPad::Shape::RECT,
+        PositiveLength(500000), PositiveLength(500000), UnsignedLength(0),
+        FootprintPad::BoardSide::TOP);
+    footprint->getPads().append(mPad);
+    mPackage->getFootprints().append(footprint);
+  }
+
+  static int countPadOverlaps(const LibraryElementCheckMessageList& msgs) {
+    int count = 0;
+    foreach (const auto& msg, msgs) {
+      if (msg->as<MsgPadOverlapsWithPlacement>()) {
+        ++count;
+      }
+    }
+    return count;
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(PackageCheckTest, testPadOverlapsWithPlacement) {
+  PackageCheck check(*mPackage);
+  EXPECT_EQ(1, countPadOverlaps(check.runChecks()));
+}
+
+TEST_F(PackageCheckTest, testFootprintCacheIsUsed) {
+  PackageCheck::FootprintCache cache;
+  PackageCheck                 check(*mPackage);
+  check.setFootprintCache(&cache);
+  EXPECT_EQ(1, countPadOverlaps(check.runChecks()));
+  ASSERT_EQ(1, cache.count());
+
+  // the cached result is returned as long as the footprint is not modified
+  cache.begin().value().clear();
+  EXPECT_EQ(0, countPadOverlaps(check.runChecks()));
+  EXPECT_EQ(1, cache.count());
+}
+
+TEST_F(PackageCheckTest, testModifiedFootprintIsCheckedAgain) {
+  PackageCheck::FootprintCache cache;
+  PackageCheck                 check(*mPackage);
+  check.setFootprintCache(&cache);
+  EXPECT_EQ(1, countPadOverlaps(check.runChecks()));
+  QByteArray oldKey = cache.keys().value(0);
+
+  mPad->setPosition(Point(0, 0));
+  EXPECT_EQ(0, countPadOverlaps(check.runChecks()));
+  EXPECT_EQ(1, cache.count());  // outdated entry removed
+  EXPECT_FALSE(cache.contains(oldKey));
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace library
+}  // namespace librepcb
@@ -55,13 +55,33 @@ namespace tests {
  * with Git (i.e. verify if the diff is as expected and makes sense) and then
  * commit those changes.
  */
-class BoardGerberExportTest : public ::testing::Test {};
+class BoardGerberExportTest : public ::testing::Test {
+protected:
+  static void replaceVolatileData(const QVector<FilePath>& files) {
+    // replace volatile data in exported files with well-known, constant data
+    foreach (const FilePath& fp, files) {
+      QString content = FileUtils::readFile(fp);
+      content.replace(
+          QRegularExpression(
+              "%TF\\.GenerationSoftware,LibrePCB,LibrePCB,(.*)\\*%"),
+          "%TF.GenerationSoftware,LibrePCB,LibrePCB,0.1.2*%");
+      content.replace(QRegularExpression("%TF\\.CreationDate,(.*)\\*%"),
+                      "%TF.CreationDate,2019-01-02T03:04:05*%");
+      content.replace(QRegularExpression("%TF\\.MD5,.*\\*%"), "");
+      content.replace(QRegularExpression(";Creation Date: .*"),
+                      ";Creation Date: 2019-01-02T03:04:05");
+      content.replace(QRegularExpression(";Generated by LibrePCB .*"),
+                      ";Generated by LibrePCB 0.1.2");
+      FileUtils::writeFile(fp, content.toUtf8());
+    }
+  }
+};
 
 /*******************************************************************************
  *  Test Methods
  ******************************************************************************/
 
-TEST(BoardGerberExportTest, test) {
+TEST_F(BoardGerberExportTest, test) {
   FilePath testDataDir(TEST_DATA_DIR
                        "/unittests/librepcbproject/BoardGerberExportTest");
 
@@ -85,21 +105,7 @@ TEST(BoardGerberExportTest, test) {
   BoardGerberExport grbExport(*board, config);
   grbExport.exportAllLayers();
 
-  // replace volatile data in exported files with well-known, constant data
-  foreach (const FilePath& fp, grbExport.getWrittenFiles()) {
-    QString content = FileUtils::readFile(fp);
-    content.replace(QRegularExpression(
-                        "%TF\\.GenerationSoftware,LibrePCB,LibrePCB,(.*)\\*%"),
-                    "%TF.GenerationSoftware,LibrePCB,LibrePCB,0.1.2*%");
-    content.replace(QRegularExpression("%TF\\.CreationDate,(.*)\\*%"),
-                    "%TF.CreationDate,2019-01-02T03:04:05*%");
-    content.replace(QRegularExpression("%TF\\.MD5,.*\\*%"), "");
-    content.replace(QRegularExpression(";Creation Date: .*"),
-                    ";Creation Date: 2019-01-02T03:04:05");
-    content.replace(QRegularExpression(";Generated by LibrePCB .*"),
-                    ";Generated by LibrePCB 0.1.2");
-    FileUtils::writeFile(fp, content.toUtf8());
-  }
+  replaceVolatileData(grbExport.getWrittenFiles());
 
   // On Windows, abort here and skip this test because on AppVeyor the generated
   // Gerber files are slightly different. See discussion here:
@@ -117,6 +123,47 @@ TEST(BoardGerberExportTest, test) {
   }
 }
 
+TEST_F(BoardGerberExportTest, testParallelExportIsIdenticalToSerialExport) {
+  FilePath tempDir = FilePath::getRandomTempPath();
+
+  // open project from test data directory
+  FilePath projectFp(TEST_DATA_DIR "/projects/Gerber Test/project.lpp");
+  std::shared_ptr<TransactionalFileSystem> projectFs =
+      TransactionalFileSystem::openRO(projectFp.getParentDir());
+  QScopedPointer<Project> project(
+      new Project(std::unique_ptr<TransactionalDirectory>(
+                      new TransactionalDirectory(projectFs)),
+                  projectFp.getFilename()));
+  Board* board = project->getBoards().first();
+  board->rebuildAllPlanes();
+
+  // export fabrication data serial and parallel
+  BoardFabricationOutputSettings config = board->getFabricationOutputSettings();
+  config.setOutputBasePath(tempDir.getPathTo("serial").toStr() %
+                           "/{{PROJECT}}");
+  BoardGerberExport serialExport(*board, config);
+  serialExport.setParallelExportEnabled(false);
+  serialExport.exportAllLayers();
+  replaceVolatileData(serialExport.getWrittenFiles());
+  config.setOutputBasePath(tempDir.getPathTo("parallel").toStr() %
+                           "/{{PROJECT}}");
+  BoardGerberExport parallelExport(*board, config);
+  parallelExport.setParallelExportEnabled(true);
+  parallelExport.exportAllLayers();
+  replaceVolatileData(parallelExport.getWrittenFiles());
+
+  // compare generated files (incl. their order)
+  ASSERT_EQ(serialExport.getWrittenFiles().count(),
+            parallelExport.getWrittenFiles().count());
+  for (int i = 0; i < serialExport.getWrittenFiles().count(); ++i) {
+    FilePath serialFp   = serialExport.getWrittenFiles().at(i);
+    FilePath parallelFp = parallelExport.getWrittenFiles().at(i);
+    EXPECT_EQ(serialFp.getFilename(), parallelFp.getFilename());
+    EXPECT_EQ(FileUtils::readFile(serialFp), FileUtils::readFile(parallelFp));
+  }
+  QDir(tempDir.toStr()).removeRecursively();
+}
+
 /*******************************************************************************
  *  End of File
  ******************************************************************************/
@@ -0,0 +1,146 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../projecttesthelpers.h"
+
+#include <gtest/gtest.h>
+#include <librepcb/common/toolbox.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class BoardTest : public ::testing::Test {
+protected:
+  std::unique_ptr<Project> mProject;
+  Board*                   mBoard;
+  QList<BI_Base*>          mItems;
+
+  BoardTest() : mProject(ProjectTestHelpers::openProject()) {
+    mBoard = mProject->getBoards().first();
+    mItems = ProjectTestHelpers::getAllItemsRecursively(*mBoard);
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(BoardTest, testGetItemsAtScenePos) {
+  ASSERT_GT(mItems.count(), 0);
+
+  // the items found with the spatial index must be exactly the same as found
+  // by checking the grab areas of all items
+  foreach (BI_Base* item, mItems) {
+    Point pos = item->getPosition();
+    EXPECT_EQ(ProjectTestHelpers::getItemsAtScenePosSlow(mItems, pos),
+              Toolbox::toSet(mBoard->getItemsAtScenePos(pos)));
+  }
+
+  // the index must be updated when moving items
+  BI_Via* via = nullptr;
+  foreach (BI_NetSegment* segment, mBoard->getNetSegments()) {
+    if (!segment->getVias().isEmpty()) {
+      via = segment->getVias().first();
+    }
+  }
+  ASSERT_NE(nullptr, via);
+  Point oldPos = via->getPosition();
+  Point newPos = oldPos + Point(1000000000, 1000000000);  // far away
+  via->setPosition(newPos);
+  EXPECT_FALSE(mBoard->getViasAtScenePos(oldPos).contains(via));
+  EXPECT_EQ(QList<BI_Via*>{via}, mBoard->getViasAtScenePos(newPos));
+  EXPECT_EQ(QList<BI_Via*>{via}, mBoard->getViasAtScenePos(
+                                     newPos, &via->getNetSignalOfNetSegment()));
+}
+
+TEST_F(BoardTest, testCachedGrabAreasAreUpdatedWhenMovingDevices) {
+  ASSERT_FALSE(mBoard->getDeviceInstances().isEmpty());
+
+  // fill the grab area caches and remember the old positions
+  QHash<BI_Base*, QPointF> oldPositions;
+  foreach (BI_Base* item, mItems) {
+    oldPositions.insert(item, item->getPosition().toPxQPointF());
+    item->isGrabAreaAtScenePos(oldPositions.value(item));
+  }
+
+  // move and rotate all devices, the cached grab areas must be invalidated,
+  // i.e. the hit-tests must match the (uncached) current grab areas at both
+  // the old and the new positions
+  foreach (BI_Device* device, mBoard->getDeviceInstances()) {
+    device->setPosition(device->getPosition() + Point(5000000, 3000000));
+    device->setRotation(device->getRotation() + Angle::deg90());
+  }
+  foreach (BI_Base* item, mItems) {
+    QPainterPath grabArea = item->getGrabAreaScenePx();
+    QPointF      oldPos   = oldPositions.value(item);
+    QPointF      newPos   = item->getPosition().toPxQPointF();
+    EXPECT_EQ(grabArea.contains(oldPos), item->isGrabAreaAtScenePos(oldPos));
+    EXPECT_EQ(grabArea.contains(newPos), item->isGrabAreaAtScenePos(newPos));
+    QRectF rectPx = grabArea.boundingRect();
+    EXPECT_EQ(grabArea.intersects(rectPx), item->isGrabAreaInSceneRect(rectPx));
+    QRectF oldRectPx(oldPos - QPointF(1, 1), QSizeF(2, 2));
+    EXPECT_EQ(grabArea.intersects(oldRectPx),
+              item->isGrabAreaInSceneRect(oldRectPx));
+  }
+}
+
+TEST_F(BoardTest, testDeferredNetLineUpdates) {
+  BI_NetLine*  netline  = nullptr;
+  BI_NetPoint* netpoint = nullptr;
+  foreach (BI_NetSegment* segment, mBoard->getNetSegments()) {
+    foreach (BI_NetLine* line, segment->getNetLines()) {
+      if (BI_NetPoint* p = dynamic_cast<BI_NetPoint*>(&line->getStartPoint())) {
+        netline  = line;
+        netpoint = p;
+      }
+    }
+  }
+  ASSERT_NE(nullptr, netline);
+
+  // the net line must not be updated until the deferred updates are ended
+  Point oldPos = netline->getPosition();
+  mBoard->beginDeferredNetLineUpdates();
+  mBoard->beginDeferredNetLineUpdates();
+  netpoint->setPosition(netpoint->getPosition() + Point(2000000, 0));
+  mBoard->endDeferredNetLineUpdates();
+  EXPECT_EQ(oldPos, netline->getPosition());
+  mBoard->endDeferredNetLineUpdates();
+  EXPECT_EQ(oldPos + Point(1000000, 0), netline->getPosition());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
@@ -122,6 +122,49 @@ TEST_F(ProjectLibraryTest, testLoadSymbol) {
             mExistingSymbolFile.size());  // not upgraded
 }
 
+TEST_F(ProjectLibraryTest, testLoadManySymbols) {
+  for (int i = 0; i < 50; ++i) {
+    library::Symbol sym(Uuid::createRandom(), Version::fromString("1"), "",
+                        ElementName(QString("Symbol %1").arg(i)), "", "");
+    TransactionalDirectory libSymDir(mLibFs, "sym");
+    sym.saveIntoParentDirectory(libSymDir);
+  }
+  mLibFs->save();
+
+  ProjectLibrary lib(std::unique_ptr<TransactionalDirectory>(
+      new TransactionalDirectory(mLibFs)));
+  EXPECT_EQ(51, lib.getSymbols().count());
+  foreach (const library::Symbol* symbol, lib.getSymbols()) {
+    EXPECT_EQ(lib.thread(), symbol->thread());  // loaded in worker threads
+  }
+}
+
+TEST_F(ProjectLibraryTest, testLoadDuplicateUuidThrows) {
+  // copy the existing symbol into directories with other names
+  QStringList dirnames = {mExistingSymbolFile.dir().dirName()};
+  for (int i = 0; i < 3; ++i) {
+    dirnames.append(Uuid::createRandom().toStr());
+    FileUtils::copyDirRecursively(
+        FilePath(mExistingSymbolFile.absolutePath()),
+        mLibDir.getPathTo("sym/" % dirnames.last()));
+  }
+  dirnames.sort();
+
+  // the reported directories must not depend on the thread scheduling
+  for (int i = 0; i < 10; ++i) {
+    try {
+      ProjectLibrary lib(std::unique_ptr<TransactionalDirectory>(
+          new TransactionalDirectory(mLibFs)));
+      ADD_FAILURE() << "No exception thrown";
+    } catch (const Exception& e) {
+      EXPECT_TRUE(e.getMsg().contains(dirnames.at(0)))
+          << qPrintable(e.getMsg());
+      EXPECT_TRUE(e.getMsg().contains(dirnames.at(1)))
+          << qPrintable(e.getMsg());
+    }
+  }
+}
+
 TEST_F(ProjectLibraryTest, testAddSymbol) {
   {
     ProjectLibrary lib(std::unique_ptr<TransactionalDirectory>(
@@ -0,0 +1,170 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROJECTTESTHELPERS_H
+#define PROJECTTESTHELPERS_H
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/items/bi_device.h>
+#include <librepcb/project/boards/items/bi_footprint.h>
+#include <librepcb/project/boards/items/bi_footprintpad.h>
+#include <librepcb/project/boards/items/bi_hole.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netsegment.h>
+#include <librepcb/project/boards/items/bi_plane.h>
+#include <librepcb/project/boards/items/bi_polygon.h>
+#include <librepcb/project/boards/items/bi_stroketext.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/schematics/items/si_netlabel.h>
+#include <librepcb/project/schematics/items/si_netline.h>
+#include <librepcb/project/schematics/items/si_netpoint.h>
+#include <librepcb/project/schematics/items/si_netsegment.h>
+#include <librepcb/project/schematics/items/si_symbol.h>
+#include <librepcb/project/schematics/items/si_symbolpin.h>
+#include <librepcb/project/schematics/schematic.h>
+
+#include <QtCore>
+
+#include <memory>
+
+/*******************************************************************************
+ *  Namespace / Forward Declarations
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Class ProjectTestHelpers
+ ******************************************************************************/
+
+/**
+ * @brief Helpers shared by the tests of boards and schematics
+ *
+ * The brute-force methods to find items at a position are used as reference
+ * for the optimized hit-tests of ::librepcb::project::Board and
+ * ::librepcb::project::Schematic.
+ */
+class ProjectTestHelpers final {
+public:
+  ProjectTestHelpers() = delete;
+
+  /**
+   * @brief Open a project from the test data directory (read-only)
+   *
+   * @param name  Directory name within "projects" of the test data directory
+   */
+  static std::unique_ptr<Project> openProject(
+      const QString& name = "Gerber Test") {
+    FilePath projectFp(QString(TEST_DATA_DIR "/projects/%1/project.lpp")
+                           .arg(name));
+    std::shared_ptr<TransactionalFileSystem> projectFs =
+        TransactionalFileSystem::openRO(projectFp.getParentDir());
+    return std::unique_ptr<Project>(
+        new Project(std::unique_ptr<TransactionalDirectory>(
+                        new TransactionalDirectory(projectFs)),
+                    projectFp.getFilename()));
+  }
+
+  static QList<BI_Base*> getAllItemsRecursively(const Board& board) {
+    QList<BI_Base*> items;
+    foreach (BI_Device* device, board.getDeviceInstances()) {
+      items.append(&device->getFootprint());
+      foreach (BI_FootprintPad* pad, device->getFootprint().getPads()) {
+        items.append(pad);
+      }
+      foreach (BI_StrokeText* text, device->getFootprint().getStrokeTexts()) {
+        items.append(text);
+      }
+    }
+    foreach (BI_NetSegment* segment, board.getNetSegments()) {
+      foreach (BI_Via* via, segment->getVias()) { items.append(via); }
+      foreach (BI_NetPoint* point, segment->getNetPoints()) {
+        items.append(point);
+      }
+      foreach (BI_NetLine* line, segment->getNetLines()) { items.append(line); }
+    }
+    foreach (BI_Plane* plane, board.getPlanes()) { items.append(plane); }
+    foreach (BI_Polygon* polygon, board.getPolygons()) {
+      items.append(polygon);
+    }
+    foreach (BI_StrokeText* text, board.getStrokeTexts()) {
+      items.append(text);
+    }
+    foreach (BI_Hole* hole, board.getHoles()) { items.append(hole); }
+    return items;
+  }
+
+  static QList<SI_Base*> getAllItemsRecursively(const Schematic& schematic) {
+    QList<SI_Base*> items;
+    foreach (SI_Symbol* symbol, schematic.getSymbols()) {
+      items.append(symbol);
+      foreach (SI_SymbolPin* pin, symbol->getPins()) { items.append(pin); }
+    }
+    foreach (SI_NetSegment* segment, schematic.getNetSegments()) {
+      foreach (SI_NetPoint* point, segment->getNetPoints()) {
+        items.append(point);
+      }
+      foreach (SI_NetLine* line, segment->getNetLines()) { items.append(line); }
+      foreach (SI_NetLabel* label, segment->getNetLabels()) {
+        items.append(label);
+      }
+    }
+    return items;
+  }
+
+  static QSet<BI_Base*> getItemsAtScenePosSlow(const QList<BI_Base*>& items,
+                                               const Point&           pos) {
+    QSet<BI_Base*> result;
+    foreach (BI_Base* item, items) {
+      if (item->isSelectable() &&
+          item->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
+        result.insert(item);
+      }
+    }
+    return result;
+  }
+
+  static QSet<SI_Base*> getItemsAtScenePosSlow(const QList<SI_Base*>& items,
+                                               const Point&           pos) {
+    QSet<SI_Base*> result;
+    foreach (SI_Base* item, items) {
+      if (item->getGrabAreaScenePx().contains(pos.toPxQPointF())) {
+        result.insert(item);
+      }
+    }
+    return result;
+  }
+};
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
+
+#endif  // PROJECTTESTHELPERS_H
@@ -0,0 +1,103 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include "../projecttesthelpers.h"
+
+#include <gtest/gtest.h>
+#include <librepcb/common/toolbox.h>
+
+#include <QtCore>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace project {
+namespace tests {
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class SchematicTest : public ::testing::Test {
+protected:
+  std::unique_ptr<Project> mProject;
+  Schematic*               mSchematic;
+  QList<SI_Base*>          mItems;
+
+  SchematicTest() : mProject(ProjectTestHelpers::openProject()) {
+    mSchematic = mProject->getSchematics().first();
+    mItems     = ProjectTestHelpers::getAllItemsRecursively(*mSchematic);
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(SchematicTest, testGetItemsAtScenePos) {
+  ASSERT_GT(mItems.count(), 0);
+
+  // the items found with the spatial index must be exactly the same as found
+  // by checking the grab areas of all items
+  auto checkAllItems = [&]() {
+    foreach (SI_Base* item, mItems) {
+      Point pos = item->getPosition();
+      EXPECT_EQ(ProjectTestHelpers::getItemsAtScenePosSlow(mItems, pos),
+                Toolbox::toSet(mSchematic->getItemsAtScenePos(pos)));
+    }
+  };
+  checkAllItems();
+
+  // the index must be updated when moving items
+  SI_Symbol* symbol = mSchematic->getSymbols().first();
+  Point      oldPos = symbol->getPosition();
+  Point      newPos = oldPos + Point(1000000000, 1000000000);  // far away
+  symbol->setPosition(newPos);
+  EXPECT_FALSE(mSchematic->getItemsAtScenePos(oldPos).contains(symbol));
+  checkAllItems();
+}
+
+TEST_F(SchematicTest, testSetSelectionRect) {
+  ASSERT_GT(mItems.count(), 0);
+
+  // select the left half of the schematic
+  QRectF bounds = mSchematic->getGraphicsScene().itemsBoundingRect();
+  QRectF rectPx(bounds.topLeft(), QSizeF(bounds.width() / 2, bounds.height()));
+  mSchematic->setSelectionRect(Point::fromPx(rectPx.topLeft()),
+                               Point::fromPx(rectPx.bottomRight()), true);
+  foreach (SI_Base* item, mItems) {
+    bool expected = item->getGrabAreaScenePx().intersects(rectPx);
+    if (SI_SymbolPin* pin = qobject_cast<SI_SymbolPin*>(item)) {
+      expected = expected || pin->getSymbol().isSelected();
+    }
+    EXPECT_EQ(expected, item->isSelected());
+  }
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace project
+}  // namespace librepcb
@@ -72,6 +72,8 @@ SOURCES += \
     common/applicationtest.cpp \
     common/attributes/attributekeytest.cpp \
     common/attributes/attributesubstitutortest.cpp \
+    common/cam/drillpathoptimizertest.cpp \
+    common/cam/gerberregionoptimizertest.cpp \
     common/circuitidentifiertest.cpp \
     common/fileio/csvfiletest.cpp \
     common/fileio/directorylocktest.cpp \
@@ -79,9 +81,13 @@ SOURCES += \
     common/fileio/serializableobjectlisttest.cpp \
     common/fileio/transactionaldirectorytest.cpp \
     common/fileio/transactionalfilesystemtest.cpp \
+    common/font/strokefonttest.cpp \
     common/geometry/pathmodeltest.cpp \
     common/geometry/pathtest.cpp \
     common/graphics/graphicslayernametest.cpp \
+    common/graphics/graphicslevelofdetailtest.cpp \
+    common/graphics/graphicsrendercachetest.cpp \
+    common/graphics/graphicsviewtilecachetest.cpp \
     common/network/filedownloadtest.cpp \
     common/network/networkrequesttest.cpp \
     common/pnp/pickplacecsvwritertest.cpp \
@@ -90,6 +96,7 @@ SOURCES += \
     common/sqlitedatabasetest.cpp \
     common/systeminfotest.cpp \
     common/toolboxtest.cpp \
+    common/undostacktest.cpp \
     common/units/angletest.cpp \
     common/units/lengthsnaptest.cpp \
     common/units/lengthtest.cpp \
@@ -110,12 +117,16 @@ SOURCES += \
     library/cmp/componentsymbolvariantitemsuffixtest.cpp \
     library/cmp/componentsymbolvariantitemtest.cpp \
     library/librarybaseelementtest.cpp \
+    library/pkg/packagechecktest.cpp \
     main.cpp \
     project/boards/boardgerberexporttest.cpp \
     project/boards/boardpickplacegeneratortest.cpp \
     project/boards/boardplanefragmentsbuildertest.cpp \
+    project/boards/boardtest.cpp \
     project/library/projectlibrarytest.cpp \
     project/projecttest.cpp \
+    project/schematics/schematictest.cpp \
+    workspace/library/workspacelibraryelementcachetest.cpp \
     workspace/workspacetest.cpp \
 
 HEADERS += \
@@ -123,6 +134,7 @@ HEADERS += \
     common/fileio/serializableobjectmock.h \
     common/network/networkrequestbasesignalreceiver.h \
     common/widgets/editabletablewidgetreceiver.h \
+    project/projecttesthelpers.h \
 
 FORMS += \
 
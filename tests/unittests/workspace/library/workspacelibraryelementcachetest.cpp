@@ -0,0 +1,183 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * https://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*******************************************************************************
+ *  Includes
+ ******************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/fileio/transactionalfilesystem.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/library/workspacelibraryelementcache.h>
+#include <librepcb/workspace/workspace.h>
+
+#include <QtCore>
+#include <QtTest>
+
+/*******************************************************************************
+ *  Namespace
+ ******************************************************************************/
+namespace librepcb {
+namespace workspace {
+namespace tests {
+
+using namespace library;
+
+/*******************************************************************************
+ *  Test Class
+ ******************************************************************************/
+
+class WorkspaceLibraryElementCacheTest : public ::testing::Test {
+protected:
+  FilePath                  mWsDir;
+  QScopedPointer<Workspace> mWorkspace;
+  FilePath                  mLibDir;
+  QList<FilePath>           mSymbolDirs;
+
+  WorkspaceLibraryElementCacheTest() {
+    mWsDir = FilePath::getRandomTempPath().getPathTo("workspace");
+    Workspace::createNewWorkspace(mWsDir);
+    mWorkspace.reset(new Workspace(mWsDir));
+    mLibDir = mWorkspace->getLibrariesPath().getPathTo("local/Test.lplib");
+
+    // create a library with two symbols
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(mLibDir);
+    Library library(Uuid::createRandom(), Version::fromString("1.0"), "test",
+                    ElementName("Test"), "", "");
+    TransactionalDirectory libDir(fs);
+    library.moveTo(libDir);
+    for (int i = 0; i < 2; ++i) {
+      Symbol symbol(Uuid::createRandom(), Version::fromString("1.0"), "test",
+                    ElementName(QString("Symbol %1").arg(i)), "", "");
+      QString                path = "sym/" % symbol.getUuid().toStr();
+      TransactionalDirectory symbolDir(fs, path);
+      symbol.moveTo(symbolDir);
+      mSymbolDirs.append(mLibDir.getPathTo(path));
+    }
+    fs->save();
+
+    // add the symbols to the library database
+    QSignalSpy spy(&mWorkspace->getLibraryDb(), SIGNAL(scanSucceeded(int)));
+    mWorkspace->getLibraryDb().startLibraryRescan();
+    if (!spy.wait(10000)) {
+      qCritical() << "Library scan did not succeed within 10 seconds.";
+    }
+  }
+
+  virtual ~WorkspaceLibraryElementCacheTest() {
+    mWorkspace.reset();
+    QDir(mWsDir.getParentDir().toStr()).removeRecursively();
+  }
+
+  WorkspaceLibraryDb& db() const noexcept {
+    return mWorkspace->getLibraryDb();
+  }
+
+  static int getFileSize(const FilePath& dir) {
+    return QFileInfo(dir.getPathTo("symbol.lp").toStr()).size();
+  }
+};
+
+/*******************************************************************************
+ *  Test Methods
+ ******************************************************************************/
+
+TEST_F(WorkspaceLibraryElementCacheTest, testHit) {
+  WorkspaceLibraryElementCache cache(db());
+  std::shared_ptr<const Symbol> s1 = cache.getSymbol(mSymbolDirs[0]);
+  std::shared_ptr<const Symbol> s2 = cache.getSymbol(mSymbolDirs[0]);
+  EXPECT_EQ(s1, s2);
+  EXPECT_EQ(1, cache.getCount());
+  EXPECT_EQ(1, cache.getHits());
+  EXPECT_EQ(1, cache.getMisses());
+}
+
+TEST_F(WorkspaceLibraryElementCacheTest, testMissAfterModification) {
+  WorkspaceLibraryElementCache  cache(db());
+  std::shared_ptr<const Symbol> s1 = cache.getSymbol(mSymbolDirs[0]);
+
+  // modify the file on disk (this changes its size, so it's detected even if
+  // the modification time has a low resolution)
+  FilePath fp = mSymbolDirs[0].getPathTo("symbol.lp");
+  FileUtils::writeFile(fp, FileUtils::readFile(fp).append('\n'));
+  std::shared_ptr<const Symbol> s2 = cache.getSymbol(mSymbolDirs[0]);
+  EXPECT_NE(s1, s2);
+  EXPECT_EQ(1, cache.getCount());
+  EXPECT_EQ(0, cache.getHits());
+  EXPECT_EQ(2, cache.getMisses());
+
+  // the reloaded element is cached again
+  EXPECT_EQ(s2, cache.getSymbol(mSymbolDirs[0]));
+  EXPECT_EQ(1, cache.getHits());
+}
+
+TEST_F(WorkspaceLibraryElementCacheTest, testElementNotInDbIsNotCached) {
+  // create a symbol outside of the workspace libraries
+  FilePath dir = mWsDir.getParentDir().getPathTo("symbol");
+  {
+    std::shared_ptr<TransactionalFileSystem> fs =
+        TransactionalFileSystem::openRW(dir);
+    Symbol symbol(Uuid::createRandom(), Version::fromString("1.0"), "test",
+                  ElementName("Foo"), "", "");
+    TransactionalDirectory symbolDir(fs);
+    symbol.moveTo(symbolDir);
+    fs->save();
+  }
+
+  WorkspaceLibraryElementCache  cache(db());
+  std::shared_ptr<const Symbol> s1 = cache.getSymbol(dir);
+  std::shared_ptr<const Symbol> s2 = cache.getSymbol(dir);
+  ASSERT_NE(nullptr, s1);
+  ASSERT_NE(nullptr, s2);
+  EXPECT_NE(s1, s2);  // loaded again
+  EXPECT_EQ(QString("Foo"), *s2->getNames().getDefaultValue());
+  EXPECT_EQ(0, cache.getCount());
+  EXPECT_EQ(0, cache.getHits());
+  EXPECT_EQ(0, cache.getMisses());
+}
+
+TEST_F(WorkspaceLibraryElementCacheTest, testEvictionByCost) {
+  // the cache has room for only one of the symbols
+  int size = qMax(getFileSize(mSymbolDirs[0]), getFileSize(mSymbolDirs[1]));
+  WorkspaceLibraryElementCache  cache(db(), size + 1);
+  std::shared_ptr<const Symbol> s1 = cache.getSymbol(mSymbolDirs[0]);
+  EXPECT_EQ(1, cache.getCount());
+  cache.getSymbol(mSymbolDirs[1]);
+  EXPECT_EQ(1, cache.getCount());
+  EXPECT_LE(cache.getTotalCost(), cache.getMaxCost());
+
+  // the first symbol was dropped, but the handed out instance stays valid
+  std::shared_ptr<const Symbol> s2 = cache.getSymbol(mSymbolDirs[0]);
+  EXPECT_NE(s1, s2);
+  EXPECT_EQ(*s1->getNames().getDefaultValue(),
+            *s2->getNames().getDefaultValue());
+  EXPECT_EQ(0, cache.getHits());
+  EXPECT_EQ(3, cache.getMisses());
+}
+
+/*******************************************************************************
+ *  End of File
+ ******************************************************************************/
+
+}  // namespace tests
+}  // namespace workspace
+}  // namespace librepcb